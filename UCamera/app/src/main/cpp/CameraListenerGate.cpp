@@ -0,0 +1,60 @@
+// Copyright 2026 URAV ADVANCED LEARNING SYSTEMS PRIVATE LIMITED
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "CameraListenerGate.h"
+
+using namespace std;
+
+// The gate whose listener is being called on this thread, if any.
+static thread_local const CameraListenerGate* t_callingGate = nullptr;
+
+CameraListenerGate::CameraListenerGate()
+    : _listener(nullptr), _activeCalls(0) {
+}
+
+void CameraListenerGate::open(CameraListener* listener) {
+    lock_guard<mutex> lock(_mutex);
+    _listener = listener;
+}
+
+bool CameraListenerGate::close() {
+    unique_lock<mutex> lock(_mutex);
+    bool wasOpen = _listener != nullptr;
+    _listener = nullptr;
+
+    // A listener stopping its own camera is still in its callback, so only calls on other threads are waited for.
+    uint32_t ownCalls = t_callingGate == this ? 1 : 0;
+    _callsDone.wait(lock, [this, ownCalls] { return _activeCalls <= ownCalls; });
+    return wasOpen;
+}
+
+CameraListener* CameraListenerGate::begin() {
+    lock_guard<mutex> lock(_mutex);
+    if (_listener == nullptr) {
+        return nullptr;
+    }
+
+    _activeCalls++;
+    t_callingGate = this;
+    return _listener;
+}
+
+void CameraListenerGate::end() {
+    t_callingGate = nullptr;
+
+    lock_guard<mutex> lock(_mutex);
+    _activeCalls--;
+    _callsDone.notify_all();
+}
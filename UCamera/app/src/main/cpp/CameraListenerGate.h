@@ -0,0 +1,50 @@
+// Copyright 2026 URAV ADVANCED LEARNING SYSTEMS PRIVATE LIMITED
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef UXR_QUESTCAMERA_CAMERALISTENERGATE_H
+#define UXR_QUESTCAMERA_CAMERALISTENERGATE_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+
+#include "NativeCamera.h"
+
+// Guards the calls a camera makes into its listener from its own threads. Each callback takes the listener under
+// the gate's lock, and calls it after the lock is released, so the listener may stop the camera from within a callback.
+// Closing the gate waits for calls on other threads to finish, but not for the closing thread's own call.
+class CameraListenerGate {
+
+public:
+    CameraListenerGate();
+
+    void open(CameraListener* listener);
+
+    // Clears the listener, so no new calls begin, and waits for calls in progress. Returns false if it was already closed.
+    bool close();
+
+    // Returns the listener, or nullptr if the gate is closed. Every non-null result must be passed to end().
+    CameraListener* begin();
+    void end();
+
+private:
+    std::mutex _mutex;
+    std::condition_variable _callsDone;
+    CameraListener* _listener;
+    uint32_t _activeCalls;
+};
+
+
+#endif //UXR_QUESTCAMERA_CAMERALISTENERGATE_H
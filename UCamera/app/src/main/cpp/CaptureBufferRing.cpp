@@ -0,0 +1,190 @@
+// Copyright 2026 URAV ADVANCED LEARNING SYSTEMS PRIVATE LIMITED
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "CaptureBufferRing.h"
+#include "NativeLog.h"
+#include <cstdlib>
+#include <cstring>
+
+#define TAG "UXRQC.CaptureRing"
+#define LOGI(...) NATIVE_LOG(ANDROID_LOG_INFO,  TAG, __VA_ARGS__)
+#define LOGE(...) NATIVE_LOG(ANDROID_LOG_ERROR, TAG, __VA_ARGS__)
+
+using namespace std;
+
+static size_t alignUp(size_t value, size_t alignment) {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+CaptureBufferRing::CaptureBufferRing(uint32_t id, int32_t width, int32_t height, uint32_t slotCount, CaptureBufferCallback onCapture) {
+    _id = id;
+    _width = width;
+    _height = height;
+    _slotCount = slotCount;
+    _onCapture = onCapture;
+
+    // Padded Y rows, plus two chroma planes of half as many padded rows, plus alignment between the planes.
+    _capacity = alignUp((size_t)width, CAPTURE_MAX_ROW_ALIGNMENT) * (size_t)height * 2 + CAPTURE_BUFFER_ALIGNMENT * 2;
+
+    for (auto& slot : _slots) {
+        slot.state.store(SLOT_FREE, memory_order_relaxed);
+        slot.buffer = nullptr;
+        slot.image = {};
+    }
+
+    _armedHead = 0;
+    _armedCount = 0;
+    _captures = 0;
+    _dropped = 0;
+}
+
+CaptureBufferRing::~CaptureBufferRing() {
+    for (auto& slot : _slots) {
+        free(slot.buffer);
+    }
+}
+
+bool CaptureBufferRing::initialize() {
+    if (_slotCount == 0 || _slotCount > CAPTURE_RING_MAX_SLOTS || _width <= 0 || _height <= 0) {
+        LOGE("Invalid capture ring size.");
+        return false;
+    }
+
+    size_t allocationSize = alignUp(_capacity, CAPTURE_BUFFER_ALIGNMENT);
+    for (uint32_t i = 0; i < _slotCount; i++) {
+        _slots[i].buffer = static_cast<uint8_t*>(aligned_alloc(CAPTURE_BUFFER_ALIGNMENT, allocationSize));
+        if (_slots[i].buffer == nullptr) {
+            LOGE("Could not allocate capture buffer.");
+            return false;
+        }
+
+        // Touching every page now keeps page faults out of the first capture.
+        memset(_slots[i].buffer, 0, allocationSize);
+    }
+
+    LOGI("Capture ring created with %u slots of %zu bytes.", _slotCount, allocationSize);
+    return true;
+}
+
+int32_t CaptureBufferRing::reserve() {
+    lock_guard<mutex> lock(_armedMutex);
+    for (uint32_t i = 0; i < _slotCount; i++) {
+        uint32_t expected = SLOT_FREE;
+        if (_slots[i].state.compare_exchange_strong(expected, SLOT_ARMED, memory_order_acquire)) {
+            _slots[i].image.sequenceId = -1;
+            _armed[(_armedHead + _armedCount) % CAPTURE_RING_MAX_SLOTS] = (int32_t)i;
+            _armedCount++;
+            return (int32_t)i;
+        }
+    }
+
+    return -1;
+}
+
+void CaptureBufferRing::arm(int32_t slot, int32_t sequenceId) {
+    lock_guard<mutex> lock(_armedMutex);
+    if (slot >= 0 && slot < (int32_t)_slotCount && _slots[slot].state.load(memory_order_relaxed) == SLOT_ARMED) {
+        _slots[slot].image.sequenceId = sequenceId;
+    }
+}
+
+void CaptureBufferRing::cancel(int32_t slot, int32_t sequenceId) {
+    lock_guard<mutex> lock(_armedMutex);
+    if (slot < 0 || slot >= (int32_t)_slotCount || (sequenceId != -1 && _slots[slot].image.sequenceId != sequenceId)) {
+        return;
+    }
+
+    for (uint32_t i = 0; i < _armedCount; i++) {
+        uint32_t index = (_armedHead + i) % CAPTURE_RING_MAX_SLOTS;
+        if (_armed[index] != slot) {
+            continue;
+        }
+
+        // Shifts the newer armed slots down, keeping their order.
+        for (uint32_t j = i; j + 1 < _armedCount; j++) {
+            _armed[(_armedHead + j) % CAPTURE_RING_MAX_SLOTS] = _armed[(_armedHead + j + 1) % CAPTURE_RING_MAX_SLOTS];
+        }
+
+        _armedCount--;
+        _slots[slot].state.store(SLOT_FREE, memory_order_release);
+        return;
+    }
+}
+
+bool CaptureBufferRing::fill(const uint8_t* yPlane, size_t yPlaneSize, const uint8_t* uPlane, const uint8_t* vPlane, size_t uvPlaneSize,
+                             int32_t yRowStride, int32_t uvRowStride, int32_t uvPixelStride, int32_t width, int32_t height, int64_t timestamp) {
+    size_t uOffset = alignUp(yPlaneSize, CAPTURE_BUFFER_ALIGNMENT);
+    size_t vOffset = uOffset + alignUp(uvPlaneSize, CAPTURE_BUFFER_ALIGNMENT);
+
+    Slot* slot;
+    {
+        lock_guard<mutex> lock(_armedMutex);
+        if (_armedCount == 0) {
+            _dropped.fetch_add(1, memory_order_relaxed);
+            return false;
+        }
+
+        slot = &_slots[_armed[_armedHead]];
+        _armedHead = (_armedHead + 1) % CAPTURE_RING_MAX_SLOTS;
+        _armedCount--;
+
+        slot->state.store(SLOT_WRITING, memory_order_relaxed);
+    }
+
+    if (vOffset + uvPlaneSize > _capacity) {
+        LOGE("Captured image does not fit in the ring's buffers.");
+        slot->state.store(SLOT_FREE, memory_order_release);
+
+        _dropped.fetch_add(1, memory_order_relaxed);
+        return false;
+    }
+
+    memcpy(slot->buffer, yPlane, yPlaneSize);
+    memcpy(slot->buffer + uOffset, uPlane, uvPlaneSize);
+    memcpy(slot->buffer + vOffset, vPlane, uvPlaneSize);
+
+    CaptureBufferImage& image = slot->image;
+    image.yPlane = slot->buffer;
+    image.uPlane = slot->buffer + uOffset;
+    image.vPlane = slot->buffer + vOffset;
+    image.yPlaneSize = (int64_t)yPlaneSize;
+    image.uvPlaneSize = (int64_t)uvPlaneSize;
+    image.yRowStride = yRowStride;
+    image.uvRowStride = uvRowStride;
+    image.uvPixelStride = uvPixelStride;
+    image.width = width;
+    image.height = height;
+    image.timestamp = timestamp;
+    image.slot = (int32_t)(slot - _slots);
+
+    slot->state.store(SLOT_HELD, memory_order_release);
+    _captures.fetch_add(1, memory_order_relaxed);
+
+    _onCapture(_id, &image);
+    return true;
+}
+
+bool CaptureBufferRing::release(int32_t slot) {
+    if (slot < 0 || slot >= (int32_t)_slotCount) {
+        return false;
+    }
+
+    uint32_t expected = SLOT_HELD;
+    return _slots[slot].state.compare_exchange_strong(expected, SLOT_FREE, memory_order_release);
+}
+
+void CaptureBufferRing::stats(CaptureBufferStats* stats) const {
+    stats->captures = _captures.load(memory_order_relaxed);
+    stats->dropped = _dropped.load(memory_order_relaxed);
+}
@@ -0,0 +1,123 @@
+// Copyright 2026 URAV ADVANCED LEARNING SYSTEMS PRIVATE LIMITED
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef UXR_QUESTCAMERA_CAPTUREBUFFERRING_H
+#define UXR_QUESTCAMERA_CAPTUREBUFFERRING_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+#define CAPTURE_RING_MAX_SLOTS      8
+
+// Plane starts are aligned to cache lines, and rows of camera images are padded to at most this many bytes.
+#define CAPTURE_BUFFER_ALIGNMENT    64
+#define CAPTURE_MAX_ROW_ALIGNMENT   256
+
+// A captured YUV_420_888 image in a ring's buffer. Mirrored in C#.
+struct CaptureBufferImage {
+    const uint8_t* yPlane;
+    const uint8_t* uPlane;
+    const uint8_t* vPlane;
+    int64_t yPlaneSize;
+    int64_t uvPlaneSize;
+    int32_t yRowStride;
+    int32_t uvRowStride;
+    int32_t uvPixelStride;
+    int32_t width;
+    int32_t height;
+    int64_t timestamp;
+
+    // The sequence ID of the single request which captured the image, or -1 if it was not known yet.
+    int32_t sequenceId;
+    int32_t slot;
+};
+
+// Mirrored in C#.
+struct CaptureBufferStats {
+    uint64_t captures;
+
+    // Images which arrived without an armed slot, or did not fit in one.
+    uint64_t dropped;
+};
+
+// Called on the camera's image thread. The image stays valid until its slot is released.
+typedef void (*CaptureBufferCallback)(uint32_t ringId, const CaptureBufferImage* image);
+
+// Preallocated buffers for on-demand captures. A slot is reserved and armed before each single request is sent,
+// and the request's image is copied into the oldest armed slot when it arrives, so nothing is allocated between
+// sending the request and its data being available.
+class CaptureBufferRing {
+
+public:
+    CaptureBufferRing(uint32_t id, int32_t width, int32_t height, uint32_t slotCount, CaptureBufferCallback onCapture);
+    ~CaptureBufferRing();
+
+    bool initialize();
+
+    // Reserves a free slot for the next request. Returns the slot, or -1 if every slot is armed or held.
+    int32_t reserve();
+
+    // Tags a reserved slot with the sequence ID of its request, once it has been sent.
+    void arm(int32_t slot, int32_t sequenceId);
+
+    // Frees a reserved slot whose request could not be sent, or whose image will never arrive. If sequenceId
+    // is not -1, the slot is only freed if it is still armed for that request.
+    void cancel(int32_t slot, int32_t sequenceId = -1);
+
+    // Copies an image into the oldest armed slot and reports it. Called from the camera's image thread.
+    bool fill(const uint8_t* yPlane, size_t yPlaneSize, const uint8_t* uPlane, const uint8_t* vPlane, size_t uvPlaneSize,
+              int32_t yRowStride, int32_t uvRowStride, int32_t uvPixelStride, int32_t width, int32_t height, int64_t timestamp);
+
+    // Returns a reported slot to the ring. Can be called from any thread.
+    bool release(int32_t slot);
+
+    void stats(CaptureBufferStats* stats) const;
+
+private:
+    enum SlotState : uint32_t {
+        SLOT_FREE,
+        SLOT_ARMED,
+        SLOT_WRITING,
+        SLOT_HELD
+    };
+
+    struct Slot {
+        std::atomic<uint32_t> state;
+        uint8_t* buffer;
+        CaptureBufferImage image;
+    };
+
+    uint32_t _id;
+    int32_t _width;
+    int32_t _height;
+    uint32_t _slotCount;
+    size_t _capacity;
+    CaptureBufferCallback _onCapture;
+
+    Slot _slots[CAPTURE_RING_MAX_SLOTS];
+
+    // Armed slots, in the order their requests were sent.
+    std::mutex _armedMutex;
+    int32_t _armed[CAPTURE_RING_MAX_SLOTS];
+    uint32_t _armedHead;
+    uint32_t _armedCount;
+
+    std::atomic<uint64_t> _captures;
+    std::atomic<uint64_t> _dropped;
+};
+
+
+#endif //UXR_QUESTCAMERA_CAPTUREBUFFERRING_H
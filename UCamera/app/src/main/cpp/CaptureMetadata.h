@@ -0,0 +1,34 @@
+// Copyright 2026 URAV ADVANCED LEARNING SYSTEMS PRIVATE LIMITED
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef UXR_QUESTCAMERA_CAPTUREMETADATA_H
+#define UXR_QUESTCAMERA_CAPTUREMETADATA_H
+
+#include <cstdint>
+#include "TimestampedHistory.h"
+
+// Per-frame values from a camera CaptureResult. Durations are in nanoseconds, values the camera did not report are -1.
+struct CaptureMetadata {
+    int64_t frameNumber;
+    int64_t exposureTime;
+    int64_t frameDuration;
+    int64_t rollingShutterSkew;
+    int32_t sensitivity;
+};
+
+// Capture results of one camera stream, keyed by SENSOR_TIMESTAMP, which matches the SurfaceTexture timestamp of the frame.
+typedef TimestampedHistory<CaptureMetadata, 64> CaptureMetadataHistory;
+
+
+#endif //UXR_QUESTCAMERA_CAPTUREMETADATA_H
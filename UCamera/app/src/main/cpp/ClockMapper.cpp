@@ -0,0 +1,374 @@
+// Copyright 2026 URAV ADVANCED LEARNING SYSTEMS PRIVATE LIMITED
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ClockMapper.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+
+using namespace std;
+
+// Residuals below this are never rejected, so very consistent samples don't reject ordinary scheduling noise.
+#define MIN_REJECTION_THRESHOLD  50000.0
+
+// If this many of the newest samples are rejected in a row, the clocks are assumed to have stepped.
+#define STEP_SAMPLE_COUNT        8
+
+// Clocks drifting more than 1000 ppm apart are assumed to be a bad fit.
+#define MAX_DRIFT                0.001
+
+// Drift is only estimated once samples span at least 100 ms, before that only the offset is.
+#define MIN_DRIFT_SPAN           100000000.0
+
+// Camera frames are latched well within a second of capture, and the boot and monotonic clocks are
+// only told apart once the device has been suspended for longer than that.
+#define CLOCK_DETECTION_WINDOW   1000000000LL
+
+static void fitLine(const double* xs, const double* ys, const bool* inliers, uint32_t count, double* slope, double* intercept) {
+    double meanX = 0.0, meanY = 0.0;
+    double minX = 0.0, maxX = 0.0;
+    uint32_t inlierCount = 0;
+
+    for (uint32_t i = 0; i < count; i++) {
+        if (!inliers[i]) {
+            continue;
+        }
+
+        minX = inlierCount == 0 ? xs[i] : min(minX, xs[i]);
+        maxX = inlierCount == 0 ? xs[i] : max(maxX, xs[i]);
+        meanX += xs[i];
+        meanY += ys[i];
+        inlierCount++;
+    }
+
+    if (inlierCount == 0) {
+        *slope = 1.0;
+        *intercept = 0.0;
+        return;
+    }
+
+    meanX /= inlierCount;
+    meanY /= inlierCount;
+
+    double sxx = 0.0, sxy = 0.0;
+    for (uint32_t i = 0; i < count; i++) {
+        if (inliers[i]) {
+            double dx = xs[i] - meanX;
+            sxx += dx * dx;
+            sxy += dx * (ys[i] - meanY);
+        }
+    }
+
+    *slope = maxX - minX >= MIN_DRIFT_SPAN && sxx > 0.0
+            ? clamp(sxy / sxx, 1.0 - MAX_DRIFT, 1.0 + MAX_DRIFT)
+            : 1.0;
+
+    *intercept = meanY - *slope * meanX;
+}
+
+static double median(double* values, uint32_t count) {
+    nth_element(values, values + count / 2, values + count);
+    return values[count / 2];
+}
+
+static void computeStats(const int64_t* values, uint32_t count, JitterStats* stats) {
+    double sum = 0.0, sumSquares = 0.0;
+    int32_t validCount = 0;
+
+    stats->minimum = 0;
+    stats->maximum = 0;
+
+    for (uint32_t i = 0; i < count; i++) {
+        if (values[i] < 0) {
+            continue;
+        }
+
+        stats->minimum = validCount == 0 ? values[i] : min(stats->minimum, values[i]);
+        stats->maximum = validCount == 0 ? values[i] : max(stats->maximum, values[i]);
+        sum += (double)values[i];
+        sumSquares += (double)values[i] * (double)values[i];
+        validCount++;
+    }
+
+    stats->count = validCount;
+    if (validCount == 0) {
+        stats->mean = 0;
+        stats->standardDeviation = 0;
+        return;
+    }
+
+    double mean = sum / validCount;
+    stats->mean = llround(mean);
+    stats->standardDeviation = llround(sqrt(max(sumSquares / validCount - mean * mean, 0.0)));
+}
+
+//region ClockMapper
+
+ClockMapper::ClockMapper() {
+    _count = 0;
+    _next = 0;
+    _fit = { 0, 0, 1.0, 0, 0, 0, 0 };
+}
+
+void ClockMapper::addSample(int64_t source, int64_t target) {
+    lock_guard<mutex> lock(_mutex);
+
+    _sources[_next] = source;
+    _targets[_next] = target;
+    _next = (_next + 1) % WINDOW;
+    _count = min(_count + 1, WINDOW);
+
+    refit();
+}
+
+void ClockMapper::refit() {
+    uint32_t count = _count;
+    uint32_t newest = (_next + WINDOW - 1) % WINDOW;
+
+    // Fitting relative to the newest sample keeps nanosecond precision in doubles.
+    int64_t sourceReference = _sources[newest];
+    int64_t targetReference = _targets[newest];
+
+    double xs[WINDOW], ys[WINDOW], residuals[WINDOW], scratch[WINDOW];
+    bool inliers[WINDOW];
+
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t index = (_next + WINDOW - count + i) % WINDOW;
+        xs[i] = (double)(_sources[index] - sourceReference);
+        ys[i] = (double)(_targets[index] - targetReference);
+        inliers[i] = true;
+    }
+
+    double slope, intercept;
+    fitLine(xs, ys, inliers, count, &slope, &intercept);
+
+    for (uint32_t i = 0; i < count; i++) {
+        residuals[i] = ys[i] - (intercept + slope * xs[i]);
+        scratch[i] = residuals[i];
+    }
+
+    double residualMedian = median(scratch, count);
+    for (uint32_t i = 0; i < count; i++) {
+        scratch[i] = fabs(residuals[i] - residualMedian);
+    }
+
+    // 1.4826 * MAD estimates the standard deviation of normally distributed residuals.
+    double threshold = max(3.0 * 1.4826 * median(scratch, count), MIN_REJECTION_THRESHOLD);
+    for (uint32_t i = 0; i < count; i++) {
+        inliers[i] = fabs(residuals[i] - residualMedian) <= threshold;
+    }
+
+    uint32_t rejectedNewest = 0;
+    while (rejectedNewest < count && !inliers[count - 1 - rejectedNewest]) {
+        rejectedNewest++;
+    }
+
+    if (rejectedNewest >= STEP_SAMPLE_COUNT && rejectedNewest < count) {
+        _count = rejectedNewest;
+        refit();
+        return;
+    }
+
+    fitLine(xs, ys, inliers, count, &slope, &intercept);
+
+    double sumSquares = 0.0, maxResidual = 0.0;
+    int32_t inlierCount = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        if (inliers[i]) {
+            double residual = fabs(ys[i] - (intercept + slope * xs[i]));
+            sumSquares += residual * residual;
+            maxResidual = max(maxResidual, residual);
+            inlierCount++;
+        }
+    }
+
+    _fit.sourceReference = sourceReference;
+    _fit.targetReference = targetReference + llround(intercept);
+    _fit.slope = slope;
+    _fit.residualRms = inlierCount > 0 ? llround(sqrt(sumSquares / inlierCount)) : 0;
+    _fit.residualMax = llround(maxResidual);
+    _fit.sampleCount = (int32_t)count;
+    _fit.inlierCount = inlierCount;
+}
+
+bool ClockMapper::map(int64_t source, int64_t* target) const {
+    lock_guard<mutex> lock(_mutex);
+    if (_count == 0) {
+        return false;
+    }
+
+    *target = _fit.targetReference + llround(_fit.slope * (double)(source - _fit.sourceReference));
+    return true;
+}
+
+bool ClockMapper::unmap(int64_t target, int64_t* source) const {
+    lock_guard<mutex> lock(_mutex);
+    if (_count == 0) {
+        return false;
+    }
+
+    *source = _fit.sourceReference + llround((double)(target - _fit.targetReference) / _fit.slope);
+    return true;
+}
+
+bool ClockMapper::fit(ClockFit* fit) const {
+    lock_guard<mutex> lock(_mutex);
+    if (_count == 0) {
+        return false;
+    }
+
+    *fit = _fit;
+    return true;
+}
+
+//endregion
+
+//region FrameTimingStats
+
+FrameTimingStats::FrameTimingStats() {
+    _count = 0;
+    _next = 0;
+    _lastCaptureTime = -1;
+}
+
+void FrameTimingStats::addFrame(int64_t captureTime, int64_t latchTime) {
+    lock_guard<mutex> lock(_mutex);
+
+    // Negative values mark durations which could not be measured.
+    _latencies[_next] = latchTime - captureTime;
+    _intervals[_next] = _lastCaptureTime >= 0 && captureTime > _lastCaptureTime ? captureTime - _lastCaptureTime : -1;
+    _next = (_next + 1) % WINDOW;
+    _count = min(_count + 1, WINDOW);
+
+    _lastCaptureTime = captureTime;
+}
+
+void FrameTimingStats::get(JitterStats* latency, JitterStats* interval) const {
+    lock_guard<mutex> lock(_mutex);
+    computeStats(_latencies, _count, latency);
+    computeStats(_intervals, _count, interval);
+}
+
+//endregion
+
+//region Clock domains
+
+static ClockMapper g_boottimeToMonotonic;
+static ClockMapper g_unityToMonotonic;
+
+// CLOCK_BOOTTIME or CLOCK_MONOTONIC once detected, -1 before that.
+static atomic<int32_t> g_cameraClock(-1);
+
+int64_t clockNow(clockid_t clock) {
+    timespec time {};
+    clock_gettime(clock, &time);
+    return (int64_t)time.tv_sec * 1000000000LL + time.tv_nsec;
+}
+
+void observeCameraFrame(int64_t timestamp) {
+    int64_t monotonicBefore = clockNow(CLOCK_MONOTONIC);
+    int64_t boottime = clockNow(CLOCK_BOOTTIME);
+    int64_t monotonicAfter = clockNow(CLOCK_MONOTONIC);
+
+    int64_t monotonic = monotonicBefore + (monotonicAfter - monotonicBefore) / 2;
+    g_boottimeToMonotonic.addSample(boottime, monotonic);
+
+    // Until the device has been suspended for a while, both clocks agree and either can be assumed.
+    if (g_cameraClock.load(memory_order_relaxed) != -1 || boottime - monotonic < CLOCK_DETECTION_WINDOW) {
+        return;
+    }
+
+    if (boottime >= timestamp && boottime - timestamp < CLOCK_DETECTION_WINDOW) {
+        g_cameraClock.store(CLOCK_BOOTTIME, memory_order_relaxed);
+    } else if (monotonic >= timestamp && monotonic - timestamp < CLOCK_DETECTION_WINDOW) {
+        g_cameraClock.store(CLOCK_MONOTONIC, memory_order_relaxed);
+    }
+}
+
+void observeUnityTime(int64_t unityTime) {
+    g_unityToMonotonic.addSample(unityTime, clockNow(CLOCK_MONOTONIC));
+}
+
+// Camera2 timestamps are usually CLOCK_BOOTTIME (SENSOR_INFO_TIMESTAMP_SOURCE_REALTIME), which is assumed until detected otherwise.
+static bool isCameraClockMonotonic() {
+    return g_cameraClock.load(memory_order_relaxed) == CLOCK_MONOTONIC;
+}
+
+bool convertTimestamp(int64_t timestamp, int32_t fromDomain, int32_t toDomain, int64_t* result) {
+    int64_t monotonic;
+    switch (fromDomain) {
+        case CLOCKDOMAIN_CAMERA:
+            if (isCameraClockMonotonic()) {
+                monotonic = timestamp;
+            } else if (!g_boottimeToMonotonic.map(timestamp, &monotonic)) {
+                return false;
+            }
+
+            break;
+
+        case CLOCKDOMAIN_MONOTONIC:
+            monotonic = timestamp;
+            break;
+
+        case CLOCKDOMAIN_UNITY:
+            if (!g_unityToMonotonic.map(timestamp, &monotonic)) {
+                return false;
+            }
+
+            break;
+
+        default:
+            return false;
+    }
+
+    switch (toDomain) {
+        case CLOCKDOMAIN_CAMERA:
+            if (isCameraClockMonotonic()) {
+                *result = monotonic;
+                return true;
+            }
+
+            return g_boottimeToMonotonic.unmap(monotonic, result);
+
+        case CLOCKDOMAIN_MONOTONIC:
+            *result = monotonic;
+            return true;
+
+        case CLOCKDOMAIN_UNITY:
+            return g_unityToMonotonic.unmap(monotonic, result);
+
+        default:
+            return false;
+    }
+}
+
+bool clockFit(int32_t domain, ClockFit* fit) {
+    if (domain == CLOCKDOMAIN_MONOTONIC || (domain == CLOCKDOMAIN_CAMERA && isCameraClockMonotonic())) {
+        *fit = { 0, 0, 1.0, 0, 0, 0, 0 };
+        return true;
+    }
+
+    switch (domain) {
+        case CLOCKDOMAIN_CAMERA:
+            return g_boottimeToMonotonic.fit(fit);
+
+        case CLOCKDOMAIN_UNITY:
+            return g_unityToMonotonic.fit(fit);
+
+        default:
+            return false;
+    }
+}
+
+//endregion
@@ -0,0 +1,114 @@
+// Copyright 2026 URAV ADVANCED LEARNING SYSTEMS PRIVATE LIMITED
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef UXR_QUESTCAMERA_CLOCKMAPPER_H
+#define UXR_QUESTCAMERA_CLOCKMAPPER_H
+
+#include <cstdint>
+#include <ctime>
+#include <mutex>
+
+#define CLOCKDOMAIN_CAMERA     0
+#define CLOCKDOMAIN_MONOTONIC  1
+#define CLOCKDOMAIN_UNITY      2
+
+// Linear mapping from one clock to another: target = targetReference + slope * (source - sourceReference).
+struct ClockFit {
+    int64_t sourceReference;
+    int64_t targetReference;
+    double slope;
+
+    // Of the samples used for the fit, in nanoseconds.
+    int64_t residualRms;
+    int64_t residualMax;
+
+    int32_t sampleCount;
+    int32_t inlierCount;
+};
+
+// Summary of a window of durations, in nanoseconds.
+struct JitterStats {
+    int64_t mean;
+    int64_t standardDeviation;
+    int64_t minimum;
+    int64_t maximum;
+    int32_t count;
+};
+
+// Continuously estimates the offset and drift between two clocks from pairs of simultaneous readings.
+// Samples far from the fit are rejected, and a run of rejected samples is treated as a clock step.
+class ClockMapper {
+
+public:
+    static constexpr uint32_t WINDOW = 64;
+
+    ClockMapper();
+
+    void addSample(int64_t source, int64_t target);
+
+    bool map(int64_t source, int64_t* target) const;
+    bool unmap(int64_t target, int64_t* source) const;
+    bool fit(ClockFit* fit) const;
+
+private:
+    mutable std::mutex _mutex;
+
+    int64_t _sources[WINDOW];
+    int64_t _targets[WINDOW];
+    uint32_t _count;
+    uint32_t _next;
+
+    ClockFit _fit;
+
+    void refit();
+};
+
+// Latency (capture to latch) and interval (capture to capture) statistics of a camera stream, in CLOCK_MONOTONIC.
+class FrameTimingStats {
+
+public:
+    static constexpr uint32_t WINDOW = 120;
+
+    FrameTimingStats();
+
+    void addFrame(int64_t captureTime, int64_t latchTime);
+    void get(JitterStats* latency, JitterStats* interval) const;
+
+private:
+    mutable std::mutex _mutex;
+
+    int64_t _latencies[WINDOW];
+    int64_t _intervals[WINDOW];
+    uint32_t _count;
+    uint32_t _next;
+
+    int64_t _lastCaptureTime;
+};
+
+int64_t clockNow(clockid_t clock);
+
+// Samples the clocks when a camera frame is latched, to track the camera clock.
+void observeCameraFrame(int64_t timestamp);
+
+// Samples the clocks when Unity's realtime clock, in nanoseconds, reads unityTime.
+void observeUnityTime(int64_t unityTime);
+
+// Converts a timestamp between CLOCKDOMAIN_* values. Returns false if either clock has not been observed yet.
+bool convertTimestamp(int64_t timestamp, int32_t fromDomain, int32_t toDomain, int64_t* result);
+
+// Gets the mapping from a CLOCKDOMAIN_* value to CLOCKDOMAIN_MONOTONIC.
+bool clockFit(int32_t domain, ClockFit* fit);
+
+
+#endif //UXR_QUESTCAMERA_CLOCKMAPPER_H
@@ -0,0 +1,46 @@
+// Copyright 2026 URAV ADVANCED LEARNING SYSTEMS PRIVATE LIMITED
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef UXR_QUESTCAMERA_CONVERTERBACKEND_H
+#define UXR_QUESTCAMERA_CONVERTERBACKEND_H
+
+#include "RenderJobData.h"
+#include "IUnityInterface.h"
+
+// Backends selected from Unity's active renderer. Mirrored in C#.
+#define BACKEND_NONE    0
+#define BACKEND_GLES    1
+#define BACKEND_VULKAN  2
+
+// Implements the render job events for one graphics API. Every backend identifies jobs by the renderTexture
+// field of their event data, and completes events through the same onDone callbacks, so C# jobs do not depend
+// on which backend runs them. All functions are called on Unity's render thread.
+class ConverterBackend {
+
+public:
+    virtual ~ConverterBackend() = default;
+
+    virtual int32_t type() const = 0;
+
+    virtual void setupJob(JobSetupData* setupData) = 0;
+    virtual void runJob(JobRunData* runData) = 0;
+    virtual void disposeJob(JobDisposeData* disposeData) = 0;
+};
+
+// Return nullptr if the backend cannot run on Unity's graphics device.
+ConverterBackend* createGLESConverterBackend();
+ConverterBackend* createVulkanConverterBackend(IUnityInterfaces* unityInterfaces);
+
+
+#endif //UXR_QUESTCAMERA_CONVERTERBACKEND_H
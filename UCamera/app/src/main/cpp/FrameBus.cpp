@@ -0,0 +1,302 @@
+// Copyright 2026 URAV ADVANCED LEARNING SYSTEMS PRIVATE LIMITED
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "FrameBus.h"
+#include "NativeLog.h"
+
+#define TAG "UXRQC.FrameBus"
+#define LOGI(...) NATIVE_LOG(ANDROID_LOG_INFO,  TAG, __VA_ARGS__)
+#define LOGE(...) NATIVE_LOG(ANDROID_LOG_ERROR, TAG, __VA_ARGS__)
+
+using namespace std;
+
+// The frame is the first member, so handles are passed across the C ABI as plain frame pointers.
+struct FrameHandle {
+    FrameBusFrame frame;
+    atomic<int32_t> references;
+
+    FrameBusReleaseCallback onRelease;
+    void* userData;
+};
+
+static FrameHandle* handleOf(const FrameBusFrame* frame) {
+    return reinterpret_cast<FrameHandle*>(const_cast<FrameBusFrame*>(frame));
+}
+
+// The callback target being called on this thread, if any, so a callback can unsubscribe itself without waiting on itself.
+static thread_local const void* t_runningTarget = nullptr;
+
+bool FrameBus::isTextureFormat(int32_t format) {
+    switch (format) {
+        case FRAMEBUS_FORMAT_EXTERNAL_OES:
+        case FRAMEBUS_FORMAT_RGBA:
+        case FRAMEBUS_FORMAT_RGB10A2:
+        case FRAMEBUS_FORMAT_RGBA16F:
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+bool FrameBus::Subscriber::matches(const FrameBusFrame& frame) const {
+    return (camera == FRAMEBUS_ANY_CAMERA || camera == frame.camera)
+        && (format == FRAMEBUS_ANY_FORMAT || format == frame.format);
+}
+
+FrameBus::FrameBus() {
+    _nextId = 1;
+    _subscriberCount = 0;
+}
+
+uint32_t FrameBus::subscribe(uint32_t camera, int32_t format, int32_t policy, uint32_t queueDepth) {
+    if (policy != FRAMEBUS_POLICY_DROP_OLDEST && policy != FRAMEBUS_POLICY_DROP_NEWEST) {
+        LOGE("Unknown queue policy '%i'", policy);
+        return 0;
+    }
+
+    if (queueDepth == 0 || queueDepth > MAX_QUEUE_DEPTH) {
+        LOGE("Queue depth must be in the range [1, %u].", MAX_QUEUE_DEPTH);
+        return 0;
+    }
+
+    if (isTextureFormat(format)) {
+        LOGE("Texture frames can only be subscribed to with a callback.");
+        return 0;
+    }
+
+    lock_guard<mutex> lock(_mutex);
+
+    Subscriber subscriber = { _nextId++, camera, format, nullptr, policy, queueDepth, {}, 0, 0 };
+    subscriber.queue.reserve(queueDepth);
+
+    _subscribers.push_back(move(subscriber));
+    _subscriberCount++;
+    return _subscribers.back().id;
+}
+
+uint32_t FrameBus::subscribe(uint32_t camera, int32_t format, FrameBusCallback callback, void* userData) {
+    if (callback == nullptr) {
+        LOGE("Subscriber callback must not be null.");
+        return 0;
+    }
+
+    auto target = make_shared<CallbackTarget>(CallbackTarget { callback, userData, 0, false });
+
+    lock_guard<mutex> lock(_mutex);
+
+    _subscribers.push_back({ _nextId++, camera, format, move(target), FRAMEBUS_POLICY_DROP_OLDEST, 0, {}, 0, 0 });
+    _subscriberCount++;
+    return _subscribers.back().id;
+}
+
+bool FrameBus::unsubscribe(uint32_t subscriber) {
+    vector<const FrameBusFrame*> queued;
+
+    {
+        unique_lock<mutex> lock(_mutex);
+
+        auto it = _subscribers.begin();
+        while (it != _subscribers.end() && it->id != subscriber) {
+            it++;
+        }
+
+        if (it == _subscribers.end()) {
+            LOGE("Unknown subscriber ID provided.");
+            return false;
+        }
+
+        queued = move(it->queue);
+        shared_ptr<CallbackTarget> target = move(it->target);
+        _subscribers.erase(it);
+        _subscriberCount--;
+
+        // Publishers check removed before calling, so only calls which already started are waited for.
+        if (target != nullptr) {
+            target->removed = true;
+
+            uint32_t ownCalls = t_runningTarget == target.get() ? 1 : 0;
+            _callbackReturned.wait(lock, [&target, ownCalls] { return target->running <= ownCalls; });
+        }
+    }
+
+    for (const FrameBusFrame* frame : queued) {
+        removeReference(frame);
+    }
+
+    return true;
+}
+
+bool FrameBus::hasSubscribers(uint32_t camera, int32_t format) const {
+    if (_subscriberCount.load(memory_order_relaxed) == 0) {
+        return false;
+    }
+
+    FrameBusFrame topic = {};
+    topic.camera = camera;
+    topic.format = format;
+
+    // Queued subscribers never receive texture frames.
+    bool isTexture = isTextureFormat(format);
+
+    lock_guard<mutex> lock(_mutex);
+    for (const Subscriber& subscriber : _subscribers) {
+        if (subscriber.matches(topic) && (!isTexture || subscriber.target != nullptr)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void FrameBus::publish(const FrameBusFrame& frame, FrameBusReleaseCallback onRelease, void* userData) {
+    // The publisher holds one reference until every subscriber has been given the frame.
+    auto handle = new FrameHandle();
+    handle->frame = frame;
+    handle->references = 1;
+    handle->onRelease = onRelease;
+    handle->userData = userData;
+
+    vector<shared_ptr<CallbackTarget>> targets;
+    vector<const FrameBusFrame*> dropped;
+
+    {
+        lock_guard<mutex> lock(_mutex);
+        for (Subscriber& subscriber : _subscribers) {
+            if (!subscriber.matches(frame)) {
+                continue;
+            }
+
+            if (subscriber.target != nullptr) {
+                targets.push_back(subscriber.target);
+                subscriber.delivered++;
+                continue;
+            }
+
+            if (isTextureFrame(frame)) {
+                continue;
+            }
+
+            if (subscriber.queue.size() >= subscriber.queueDepth) {
+                subscriber.dropped++;
+                if (subscriber.policy == FRAMEBUS_POLICY_DROP_NEWEST) {
+                    continue;
+                }
+
+                dropped.push_back(subscriber.queue.front());
+                subscriber.queue.erase(subscriber.queue.begin());
+            }
+
+            addReference(&handle->frame);
+            subscriber.queue.push_back(&handle->frame);
+            subscriber.delivered++;
+        }
+    }
+
+    // Released frames and callbacks may call back into the bus, so they run without holding the subscriber lock.
+    for (const FrameBusFrame* droppedFrame : dropped) {
+        removeReference(droppedFrame);
+    }
+
+    for (const shared_ptr<CallbackTarget>& target : targets) {
+        {
+            lock_guard<mutex> lock(_mutex);
+            if (target->removed) {
+                continue;
+            }
+
+            target->running++;
+        }
+
+        const void* previousTarget = t_runningTarget;
+        t_runningTarget = target.get();
+        target->callback(&handle->frame, target->userData);
+        t_runningTarget = previousTarget;
+
+        lock_guard<mutex> lock(_mutex);
+        target->running--;
+        _callbackReturned.notify_all();
+    }
+
+    removeReference(&handle->frame);
+}
+
+const FrameBusFrame* FrameBus::poll(uint32_t subscriber) {
+    lock_guard<mutex> lock(_mutex);
+    for (Subscriber& current : _subscribers) {
+        if (current.id != subscriber) {
+            continue;
+        }
+
+        if (current.queue.empty()) {
+            return nullptr;
+        }
+
+        // The queue's reference is handed to the caller.
+        const FrameBusFrame* frame = current.queue.front();
+        current.queue.erase(current.queue.begin());
+        return frame;
+    }
+
+    LOGE("Unknown subscriber ID provided.");
+    return nullptr;
+}
+
+bool FrameBus::stats(uint32_t subscriber, FrameBusStats* stats) const {
+    lock_guard<mutex> lock(_mutex);
+    for (const Subscriber& current : _subscribers) {
+        if (current.id == subscriber) {
+            stats->delivered = current.delivered;
+            stats->dropped = current.dropped;
+            stats->queued = static_cast<uint32_t>(current.queue.size());
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void FrameBus::retain(const FrameBusFrame* frame) {
+    if (!isTextureFrame(*frame)) {
+        addReference(frame);
+    }
+}
+
+void FrameBus::release(const FrameBusFrame* frame) {
+    if (!isTextureFrame(*frame)) {
+        removeReference(frame);
+    }
+}
+
+void FrameBus::addReference(const FrameBusFrame* frame) {
+    handleOf(frame)->references.fetch_add(1, memory_order_relaxed);
+}
+
+void FrameBus::removeReference(const FrameBusFrame* frame) {
+    FrameHandle* handle = handleOf(frame);
+    if (handle->references.fetch_sub(1, memory_order_acq_rel) != 1) {
+        return;
+    }
+
+    if (handle->onRelease != nullptr) {
+        handle->onRelease(&handle->frame, handle->userData);
+    }
+
+    delete handle;
+}
+
+FrameBus& frameBus() {
+    static FrameBus bus;
+    return bus;
+}
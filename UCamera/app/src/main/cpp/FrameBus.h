@@ -0,0 +1,108 @@
+// Copyright 2026 URAV ADVANCED LEARNING SYSTEMS PRIVATE LIMITED
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef UXR_QUESTCAMERA_FRAMEBUS_H
+#define UXR_QUESTCAMERA_FRAMEBUS_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "UXRQC_NativeAPI.h"
+
+// Passes reference-counted frame handles from producers to subscribers without copying them.
+// Queued subscribers poll frames from a bounded queue from any thread, and must release every polled frame.
+// Callback subscribers are called synchronously on the publishing thread, and must retain frames they keep.
+// Texture frames are overwritten when their producer renders again, which a reference cannot prevent, so they
+// are only given to callback subscribers, and retaining or releasing them does nothing.
+// That thread may be a camera callback thread, so callbacks must not re-enter the producer, such as by disposing
+// the job which published the frame. Such work should be handed to another thread. Native capture sessions are
+// the exception, and may be stopped from the callbacks of their own frames.
+class FrameBus {
+
+public:
+    static constexpr uint32_t MAX_QUEUE_DEPTH = 16;
+
+    FrameBus();
+
+    uint32_t subscribe(uint32_t camera, int32_t format, int32_t policy, uint32_t queueDepth);
+    uint32_t subscribe(uint32_t camera, int32_t format, FrameBusCallback callback, void* userData);
+    bool unsubscribe(uint32_t subscriber);
+
+    // Returns true if any subscriber would receive a frame of the topic, so producers can skip building it.
+    bool hasSubscribers(uint32_t camera, int32_t format) const;
+
+    // Publishes a copy of frame. onRelease is called when the last reference to the published frame is released.
+    void publish(const FrameBusFrame& frame, FrameBusReleaseCallback onRelease = nullptr, void* userData = nullptr);
+
+    // Returns the oldest queued frame, which the caller must release, or nullptr if the queue is empty.
+    const FrameBusFrame* poll(uint32_t subscriber);
+    bool stats(uint32_t subscriber, FrameBusStats* stats) const;
+
+    // Do nothing for texture frames.
+    static void retain(const FrameBusFrame* frame);
+    static void release(const FrameBusFrame* frame);
+
+    static bool isTextureFrame(const FrameBusFrame& frame) { return frame.textureId != 0; }
+    static bool isTextureFormat(int32_t format);
+
+private:
+    // Shared with publishers calling it, so it can be called without holding _mutex.
+    struct CallbackTarget {
+        FrameBusCallback callback;
+        void* userData;
+
+        // Guarded by _mutex.
+        uint32_t running;
+        bool removed;
+    };
+
+    struct Subscriber {
+        uint32_t id;
+        uint32_t camera;
+        int32_t format;
+
+        // Null for queued subscribers.
+        std::shared_ptr<CallbackTarget> target;
+
+        int32_t policy;
+        uint32_t queueDepth;
+        std::vector<const FrameBusFrame*> queue;
+
+        uint64_t delivered;
+        uint64_t dropped;
+
+        bool matches(const FrameBusFrame& frame) const;
+    };
+
+    static void addReference(const FrameBusFrame* frame);
+    static void removeReference(const FrameBusFrame* frame);
+
+    mutable std::mutex _mutex;
+    std::vector<Subscriber> _subscribers;
+    uint32_t _nextId;
+    std::atomic<uint32_t> _subscriberCount;
+
+    // Notified as callbacks return, so unsubscribe() never returns while its callback is still being called on another thread.
+    std::condition_variable _callbackReturned;
+};
+
+// The bus shared by all native stages and external plugins.
+FrameBus& frameBus();
+
+
+#endif //UXR_QUESTCAMERA_FRAMEBUS_H
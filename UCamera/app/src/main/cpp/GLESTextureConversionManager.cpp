@@ -12,33 +12,179 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
-#include <android/log.h>
 #include <mutex>
 #include <map>
+#include <memory>
+#include <cstring>
 #include <GLES3/gl3.h>
-#include <android/surface_texture_jni.h>
+#include <GLES2/gl2ext.h>
+#include <jni.h>
 
+#include "ConverterBackend.h"
+#include "GLES_CameraSource.h"
 #include "GLES_YUVConverter.h"
+#include "GLES_FrameProbe.h"
+#include "ClockMapper.h"
+#include "FrameBus.h"
+#include "GLES_FrameReadback.h"
+#include "GLES_Debug.h"
+#include "NativeLog.h"
+#include "RenderJobData.h"
+#include "PoseHistory.h"
+#include "Reprojection.h"
+#include "StereoSynchronizer.h"
 #include "IUnityInterface.h"
 #include "IUnityGraphics.h"
 
 #define TAG "UXRQC.GLTexConvMgr"
-#define LOGI(...) __android_log_print(ANDROID_LOG_INFO,  TAG, __VA_ARGS__)
-#define LOGE(...) __android_log_print(ANDROID_LOG_ERROR, TAG, __VA_ARGS__)
+#define LOGI(...) NATIVE_LOG(ANDROID_LOG_INFO,  TAG, __VA_ARGS__)
+#define LOGE(...) NATIVE_LOG(ANDROID_LOG_ERROR, TAG, __VA_ARGS__)
 
 using namespace std;
 
-struct RenderJob {
-    jobject srcTextureJava;
-    ASurfaceTexture* srcTextureNative;
+#define SAMPLING_ALL         0
+#define SAMPLING_EVERY_NTH   1
+#define SAMPLING_ON_CHANGE   2
+#define SAMPLING_BURST       3
+
+struct JobCounters {
+    // Run events received by the job.
+    uint64_t runs;
+
+    // Runs which processed a camera frame the job had not processed before.
+    uint64_t frames;
+
+    // Runs which processed a camera frame the job had already processed.
+    uint64_t repeatedFrames;
+
+    // Camera frames estimated to have been skipped between the job's frames.
+    uint64_t droppedFrames;
+
+    // Runs which failed after the camera delivered its first frame.
+    uint64_t failedRuns;
+
+    // New camera frames which the job's sampling mode did not convert.
+    uint64_t skippedFrames;
+};
+
+// Decides which new camera frames a job processes. Skipped frames are latched, but not converted.
+struct JobSampling {
+    int32_t mode;
+
+    // For SAMPLING_EVERY_NTH, the number of camera frames per processed frame.
+    uint32_t interval;
+
+    // For SAMPLING_ON_CHANGE, the mean luma difference in [0, 1] from the last processed frame needed to process a frame.
+    float changeThreshold;
+
+    // Remaining frames of requested bursts, processed in any mode.
+    uint32_t burstFrames;
+
+    // Camera frames since the last processed frame, including dropped frames.
+    uint32_t framesSinceSample;
+    uint32_t droppedSinceSample;
+    bool lastFrameSkipped;
+
+    // Set when the mode changes, so the next new frame is processed in any mode.
+    bool sampleNext;
+};
+
+// Frame bus resources of a job, only used on the GL thread.
+struct JobPublishing {
+    // Fence of the last published RGBA frame.
+    GLsync fence;
+
+    // Created when CPU frames are first subscribed to.
+    GLES_FrameReadback* readback;
+
+    // Frame bus formats of the job's texture and CPU frames, from its render texture's format. -1 if it is not published.
+    int32_t format;
+    int32_t cpuFormat;
+    GLint internalFormat;
+
+    // Set if the readback could not be created, so it is not retried, and logged, every frame.
+    bool readbackFailed;
+};
+
+// Frame bus formats for a render texture's internal format, or -1 for high precision formats the bus has no format for.
+static int32_t textureBusFormat(GLint internalFormat) {
+    switch (internalFormat) {
+        case GL_RGB10_A2:
+            return FRAMEBUS_FORMAT_RGB10A2;
+
+        case GL_RGBA16F:
+            return FRAMEBUS_FORMAT_RGBA16F;
+
+        case GL_RGB16F:
+        case GL_R11F_G11F_B10F:
+        case GL_RGB32F:
+        case GL_RGBA32F:
+            return -1;
+
+        default:
+            return FRAMEBUS_FORMAT_RGBA;
+    }
+}
+
+static int32_t cpuBusFormat(int32_t textureFormat) {
+    switch (textureFormat) {
+        case FRAMEBUS_FORMAT_RGBA:      return FRAMEBUS_FORMAT_RGBA_CPU;
+        case FRAMEBUS_FORMAT_RGB10A2:   return FRAMEBUS_FORMAT_RGB10A2_CPU;
+        case FRAMEBUS_FORMAT_RGBA16F:   return FRAMEBUS_FORMAT_RGBA16F_CPU;
+        default:                        return -1;
+    }
+}
 
+struct RenderJob {
+    shared_ptr<GLES_CameraSource> source;
     GLES_YUVConverter* converter;
+    int32_t mode;
+    GLint width; GLint height;
+
+    // Right eye source of stereo jobs, source is the left eye.
+    shared_ptr<GLES_CameraSource> secondSource;
+
+    uint64_t lastSeenFrame;
+    uint64_t lastSeenSecondFrame;
+    bool ownsSource;
     bool awaitingDispose;
+
+    // Incremented for every new frame processed by the job.
+    uint64_t sequence;
+    int64_t lastSeenTimestamp;
+    JobCounters counters;
+
+    JobSampling sampling;
+
+    // Created on the GL thread when the job first runs with SAMPLING_ON_CHANGE.
+    GLES_FrameProbe* probe;
+
+    JobPublishing publishing;
+
+    // Layer count of the job's texture array history ring, or 0 if the job renders into a 2D texture.
+    int32_t historyLayers;
+
+    // The ring layer holding the job's newest frame, or -1 before the first frame.
+    int32_t historyLayer;
 };
 
 static map<GLuint, RenderJob> g_renderJobs;
 static mutex g_renderJobsMutex;
 
+// Sources bound to detached SurfaceTextures before their job was set up, keyed by job ID, guarded by g_renderJobsMutex.
+// The camera is configured while the render thread sets up the job, which then takes the source.
+static map<GLuint, shared_ptr<GLES_CameraSource>> g_pendingSources;
+
+// Fed by runJob as the jobs of both eyes render new frames, so pairing needs no frame bus topic or fence.
+struct StereoSync {
+    StereoSynchronizer* synchronizer;
+    GLuint jobs[2];
+};
+
+static map<uint32_t, StereoSync> g_stereoSyncs;
+static mutex g_stereoSyncsMutex;
+static uint32_t g_nextStereoSyncId = 1;
+
 //region Kotlin interface
 
 extern "C"
@@ -46,19 +192,32 @@ JNIEXPORT jboolean JNICALL
 Java_com_uralstech_uxr_questcamera_GLESCaptureSessionManager_bindJob(JNIEnv *env,
                                                                      jobject,
                                                                      jint jobTexId,
-                                                                     jobject surfaceTexture) {
+                                                                     jobject surfaceTexture,
+                                                                     jboolean detached) {
 
     LOGI("Binding surfaceTexture to job.");
 
     lock_guard<mutex> lock(g_renderJobsMutex);
     if (g_renderJobs.find(jobTexId) == g_renderJobs.end()) {
-        LOGE("Unknown job ID provided.");
-        return false;
+        if (!detached || g_pendingSources.find(jobTexId) != g_pendingSources.end()) {
+            LOGE("Unknown job ID provided.");
+            return false;
+        }
+
+        // The job is still being set up on the render thread, which will take the source.
+        auto source = make_shared<GLES_CameraSource>();
+        if (!source->bind(env, surfaceTexture, true)) {
+            return false;
+        }
+
+        g_pendingSources[jobTexId] = source;
+        LOGI("Surface texture bound ahead of job setup.");
+        return true;
     }
 
     RenderJob& job = g_renderJobs[jobTexId];
-    if (job.srcTextureJava != nullptr || job.srcTextureNative != nullptr) {
-        LOGE("Cannot bind to job with already bound surfaceTexture.");
+    if (!job.ownsSource) {
+        LOGE("Cannot bind to job which subscribes to another job's source.");
         return false;
     }
 
@@ -67,15 +226,10 @@ Java_com_uralstech_uxr_questcamera_GLESCaptureSessionManager_bindJob(JNIEnv *env
         return false;
     }
 
-    jobject globalRef = env->NewGlobalRef(surfaceTexture);
-    if (globalRef == nullptr) {
-        LOGE("Could not create global reference for surfaceTexture.");
+    if (!job.source->bind(env, surfaceTexture, detached)) {
         return false;
     }
 
-    job.srcTextureJava = globalRef;
-    job.srcTextureNative = ASurfaceTexture_fromSurfaceTexture(env, surfaceTexture);
-
     LOGI("Surface texture bound.");
     return true;
 }
@@ -90,51 +244,119 @@ Java_com_uralstech_uxr_questcamera_GLESCaptureSessionManager_unbindJob(JNIEnv *e
     LOGI("Unbinding surfaceTexture from job.");
 
     lock_guard<mutex> lock(g_renderJobsMutex);
+    auto pendingIt = g_pendingSources.find(jobTexId);
+    if (pendingIt != g_pendingSources.end()) {
+        // The job was never set up, or failed to.
+        pendingIt->second->unbind(env);
+        g_pendingSources.erase(pendingIt);
+
+        LOGI("Pending surfaceTexture unbound.");
+        return;
+    }
+
     if (g_renderJobs.find(jobTexId) == g_renderJobs.end()) {
         LOGE("Unknown job ID provided.");
         return;
     }
 
     RenderJob& job = g_renderJobs[jobTexId];
+    if (job.ownsSource) {
+        job.source->unbind(env);
+    }
+
+    job.awaitingDispose = true;
+    LOGI("SurfaceTexture unbound, awaiting dispose.");
+}
+
+extern "C"
+JNIEXPORT void JNICALL
+Java_com_uralstech_uxr_questcamera_GLESCaptureSessionManager_notifyFrameAvailable(JNIEnv *,
+                                                                                 jobject,
+                                                                                 jint jobTexId) {
+
+    lock_guard<mutex> lock(g_renderJobsMutex);
+    auto jobIt = g_renderJobs.find(jobTexId);
+    if (jobIt != g_renderJobs.end()) {
+        jobIt->second.source->notifyFrameAvailable();
+        return;
+    }
 
-    if (job.srcTextureNative != nullptr) {
-        ASurfaceTexture_release(job.srcTextureNative);
-        job.srcTextureNative = nullptr;
+    auto pendingIt = g_pendingSources.find(jobTexId);
+    if (pendingIt != g_pendingSources.end()) {
+        pendingIt->second->notifyFrameAvailable();
     }
+}
+
+extern "C"
+JNIEXPORT void JNICALL
+Java_com_uralstech_uxr_questcamera_GLESCaptureSessionManager_pushCaptureMetadata(JNIEnv *,
+                                                                                jobject,
+                                                                                jint jobTexId,
+                                                                                jlong sensorTimestamp,
+                                                                                jlong frameNumber,
+                                                                                jlong exposureTime,
+                                                                                jlong frameDuration,
+                                                                                jlong rollingShutterSkew,
+                                                                                jint sensitivity) {
 
-    if (job.srcTextureJava != nullptr) {
-        env->DeleteGlobalRef(job.srcTextureJava);
-        job.srcTextureJava = nullptr;
+    shared_ptr<GLES_CameraSource> source;
+    {
+        lock_guard<mutex> lock(g_renderJobsMutex);
+        auto jobIt = g_renderJobs.find(jobTexId);
+        if (jobIt != g_renderJobs.end()) {
+            source = jobIt->second.source;
+        } else {
+            auto pendingIt = g_pendingSources.find(jobTexId);
+            if (pendingIt == g_pendingSources.end()) {
+                return;
+            }
+
+            source = pendingIt->second;
+        }
     }
 
-    job.awaitingDispose = true;
-    LOGI("SurfaceTexture unbound, awaiting dispose.");
+    source->captureMetadata().push(sensorTimestamp, {
+            frameNumber,
+            exposureTime,
+            frameDuration,
+            rollingShutterSkew,
+            sensitivity
+    });
 }
 
 //endregion
 
-//region Unity interface
+//region Native capture interface
 
-#define EVENTID_SETUP_JOB    1
-#define EVENTID_DISPOSE_JOB  2
-#define EVENTID_RUN_JOB      3
+shared_ptr<GLES_CameraSource> findOwnedJobSource(uint32_t jobId) {
+    lock_guard<mutex> lock(g_renderJobsMutex);
+    auto jobIt = g_renderJobs.find(jobId);
+    if (jobIt == g_renderJobs.end() || !jobIt->second.ownsSource || jobIt->second.awaitingDispose) {
+        return nullptr;
+    }
 
-struct JobSetupData {
-    GLuint renderTexture;
-    GLint width; GLint height;
+    return jobIt->second.source;
+}
 
-    void (*onDone)(GLuint nativeTexture, GLuint renderTexture);
-};
+void releaseJobSource(uint32_t jobId) {
+    lock_guard<mutex> lock(g_renderJobsMutex);
+    auto jobIt = g_renderJobs.find(jobId);
+    if (jobIt == g_renderJobs.end()) {
+        return;
+    }
 
-struct JobRunData {
-    GLuint renderTexture;
-    void (*onDone)(int64_t timestamp, GLuint renderTexture);
-};
+    RenderJob& job = jobIt->second;
+    if (job.ownsSource) {
+        job.source->unbindImageReader();
+    }
 
-struct JobDisposeData {
-    GLuint renderTexture;
-    void (*onDone)(bool result, GLuint renderTexture);
-};
+    job.awaitingDispose = true;
+    LOGI("Image reader unbound, awaiting dispose.");
+}
+
+//endregion
+
+//region Unity interface
 
 static void setupJob(void* data) {
     auto setupData = reinterpret_cast<JobSetupData*>(data);
@@ -147,81 +369,580 @@ static void setupJob(void* data) {
         return;
     }
 
-    auto converter = new GLES_YUVConverter(
-            renderTexture,
-            setupData->width,
-            setupData->height
-    );
+    if (setupData->mode < JOBMODE_CONVERT || setupData->mode > JOBMODE_PLANAR) {
+        LOGE("Unknown job mode '%i'", setupData->mode);
+        setupData->onDone(0, renderTexture);
+        return;
+    }
 
-    GLuint newTexture;
-    if (!converter->initialize(&newTexture)) {
-        LOGE("Could not initialize converter.");
-        converter->dispose();
-        delete converter;
+    if (setupData->historyLayers < 0 || (setupData->historyLayers > 0 && setupData->mode != JOBMODE_CONVERT)) {
+        LOGE("History rings are only supported by converting jobs.");
+        setupData->onDone(0, renderTexture);
+        return;
+    }
+
+    // Stereo jobs combine the streams of two sessions, so they can't own either source.
+    shared_ptr<GLES_CameraSource> secondSource;
+    if (setupData->mode == JOBMODE_STEREO) {
+        auto secondSourceJobIt = g_renderJobs.find(setupData->secondSourceJob);
+        if (setupData->sourceJob == 0 || secondSourceJobIt == g_renderJobs.end() || secondSourceJobIt->second.awaitingDispose) {
+            LOGE("Stereo jobs need two valid source job IDs.");
+            setupData->onDone(0, renderTexture);
+            return;
+        }
+
+        // The same source would be held twice, so it could never be disposed, and would be latched twice per run.
+        if (setupData->sourceJob == setupData->secondSourceJob) {
+            LOGE("Stereo jobs need two different source job IDs.");
+            setupData->onDone(0, renderTexture);
+            return;
+        }
+
+        secondSource = secondSourceJobIt->second.source;
+    }
+
+    shared_ptr<GLES_CameraSource> source;
+    bool ownsSource = setupData->sourceJob == 0;
+
+    // A pending source stays pending and usable on failure, so the session can still unbind it.
+    auto pendingIt = g_pendingSources.find(renderTexture);
+    bool wasPending = ownsSource && pendingIt != g_pendingSources.end();
+
+    if (ownsSource) {
+        source = wasPending ? pendingIt->second : make_shared<GLES_CameraSource>();
+        source->setBT2020((setupData->flags & JOBFLAG_BT2020) != 0);
+    } else {
+        auto sourceJobIt = g_renderJobs.find(setupData->sourceJob);
+        if (sourceJobIt == g_renderJobs.end() || sourceJobIt->second.awaitingDispose) {
+            LOGE("Unknown or disposing source job ID provided.");
+            setupData->onDone(0, renderTexture);
+            return;
+        }
+
+        source = sourceJobIt->second.source;
+    }
+
+    // Passthrough jobs only latch camera frames, the ID is not a texture.
+    GLES_YUVConverter* converter = nullptr;
+    if (setupData->mode != JOBMODE_PASSTHROUGH) {
+        int32_t layout = setupData->mode == JOBMODE_STEREO ? LAYOUT_MULTIVIEW
+                : setupData->mode == JOBMODE_CROP_BATCH ? LAYOUT_CROP_BATCH
+                : setupData->mode == JOBMODE_PLANAR ? LAYOUT_PLANAR
+                : LAYOUT_SINGLE;
+
+        GLES_ConverterOptions options;
+        options.layout = layout;
+        options.chromaTexture = setupData->chromaTexture;
+        options.arrayLayers = setupData->historyLayers;
+        options.filter = setupData->filter;
+        options.sharpness = setupData->sharpness;
+        options.reproject = (setupData->flags & JOBFLAG_REPROJECT) != 0;
+        options.bt2020 = source->isBT2020();
+
+        converter = new GLES_YUVConverter(
+                renderTexture,
+                setupData->width,
+                setupData->height,
+                setupData->cropRect,
+                options
+        );
+
+        if (!converter->initialize()) {
+            LOGE("Could not initialize converter.");
+            converter->dispose();
+            delete converter;
+
+            setupData->onDone(0, renderTexture);
+            return;
+        }
+    }
+
+    // Initialized last, as a disposed source cannot be initialized again. initialize() cleans up after itself on failure.
+    if (ownsSource && !source->initialize()) {
+        LOGE("Could not initialize source.");
+        if (converter != nullptr) {
+            converter->dispose();
+            delete converter;
+        }
 
         setupData->onDone(0, renderTexture);
         return;
     }
 
+    GLint internalFormat = converter != nullptr ? converter->internalFormat() : 0;
+    int32_t busFormat = textureBusFormat(internalFormat);
+    if (converter != nullptr && busFormat < 0) {
+        LOGI("Render texture format 0x%x has no frame bus format, frames will not be published.", internalFormat);
+    }
+
     g_renderJobs[renderTexture] = {
-            nullptr,
-            nullptr,
+            source,
             converter,
-            false
+            setupData->mode,
+            setupData->width,
+            setupData->height,
+            secondSource,
+            0,
+            0,
+            ownsSource,
+            false,
+            0,
+            -1,
+            {},
+            { SAMPLING_ALL, 1, 0.0f, 0, 0, 0, false, false },
+            nullptr,
+            { nullptr, nullptr, busFormat, cpuBusFormat(busFormat), internalFormat, false },
+            setupData->historyLayers,
+            -1
     };
 
-    LOGI("Converter initialized.");
-    setupData->onDone(newTexture, renderTexture);
+    if (wasPending) {
+        g_pendingSources.erase(pendingIt);
+    }
+
+    LOGI("Job initialized (mode: %i).", setupData->mode);
+    setupData->onDone(source->texture(), renderTexture);
+}
+
+static void completeRunJob(JobRunData* renderData, const GLES_CameraSource* source,
+                           uint64_t sequence = 0, uint32_t droppedFrames = 0, uint32_t flags = 0, int32_t historyLayer = -1) {
+    if (source == nullptr) {
+        renderData->onDone(-1, renderData->renderTexture);
+        return;
+    }
+
+    if (renderData->frameInfo != nullptr) {
+        JobFrameInfo* frameInfo = renderData->frameInfo;
+        frameInfo->timestamp = source->timestamp();
+        frameInfo->sourceTexture = source->texture();
+        memcpy(frameInfo->transformMatrix, source->transformMatrix(), sizeof(frameInfo->transformMatrix));
+        frameInfo->sequence = sequence;
+        frameInfo->droppedFrames = droppedFrames;
+        frameInfo->flags = flags;
+        frameInfo->historyLayer = historyLayer;
+    }
+
+    renderData->onDone(source->timestamp(), renderData->renderTexture);
+}
+
+static void failRunJob(JobRunData* renderData) {
+    {
+        lock_guard<mutex> lock(g_renderJobsMutex);
+        auto jobIt = g_renderJobs.find(renderData->renderTexture);
+        if (jobIt != g_renderJobs.end()) {
+            jobIt->second.counters.failedRuns++;
+        }
+    }
+
+    completeRunJob(renderData, nullptr);
+}
+
+// Estimates the camera frames skipped between two frames, from their timestamp gap and the camera's frame period.
+static uint32_t estimateDroppedFrames(int64_t previousTimestamp, int64_t timestamp, int64_t framePeriod) {
+    if (previousTimestamp < 0 || framePeriod <= 0 || timestamp <= previousTimestamp) {
+        return 0;
+    }
+
+    int64_t periods = (timestamp - previousTimestamp + framePeriod / 2) / framePeriod;
+    return periods > 1 ? (uint32_t)(periods - 1) : 0;
+}
+
+// Decides whether a job's sampling mode processes a new camera frame. Must be called on the GL thread.
+static bool shouldSampleFrame(const JobSampling& sampling, GLES_FrameProbe* probe, const GLES_CameraSource& source, uint32_t droppedFrames) {
+    bool sampled;
+    switch (sampling.mode) {
+        case SAMPLING_EVERY_NTH:
+            sampled = sampling.framesSinceSample + 1 + droppedFrames >= sampling.interval;
+            break;
+
+        case SAMPLING_ON_CHANGE: {
+            // Thumbnails are read back a frame or two late, so the decision uses the newest finished one.
+            // After a mode change, the reference from before it is dropped, so the next thumbnail is compared fresh.
+            if (sampling.sampleNext) {
+                probe->clearReference();
+            }
+
+            probe->capture(source);
+
+            sampled = probe->poll() && probe->changeFromReference() > sampling.changeThreshold;
+            if (sampled) {
+                probe->setReference();
+            }
+
+            break;
+        }
+
+        case SAMPLING_BURST:
+            sampled = false;
+            break;
+
+        default:
+            sampled = true;
+            break;
+    }
+
+    return sampled || sampling.burstFrames > 0 || sampling.sampleNext;
+}
+
+static FrameBusFrame makeFrame(const GLES_CameraSource& source, int32_t format, GLuint producer, GLuint texture, GLenum target,
+                               GLint width, GLint height, int32_t layers, uint64_t sequence) {
+    FrameBusFrame frame = {};
+    frame.camera = source.texture();
+    frame.format = format;
+    frame.producer = producer;
+    frame.textureId = texture;
+    frame.textureTarget = target;
+    frame.width = width;
+    frame.height = height;
+    frame.layers = layers;
+    frame.timestamp = source.timestamp();
+    frame.sequence = sequence;
+    memcpy(frame.transformMatrix, source.transformMatrix(), sizeof(frame.transformMatrix));
+    return frame;
+}
+
+// Publishes a latched camera frame to the frame bus, if anything is subscribed to it. Must be called on the GL thread.
+static void publishSourceFrame(const GLES_CameraSource& source, GLuint producer) {
+    if (frameBus().hasSubscribers(source.texture(), FRAMEBUS_FORMAT_EXTERNAL_OES)) {
+        frameBus().publish(makeFrame(source, FRAMEBUS_FORMAT_EXTERNAL_OES, producer, source.texture(), GL_TEXTURE_EXTERNAL_OES,
+                                     0, 0, 1, source.frameIndex()));
+    }
+}
+
+// Publishes a job's rendered frame to the frame bus, and starts reading it back if CPU frames are subscribed to.
+// Must be called on the GL thread.
+static void publishJobFrame(const GLES_CameraSource& source, GLuint renderTexture, int32_t mode, GLint width, GLint height,
+                            uint64_t sequence, JobPublishing* publishing) {
+    if (publishing->format < 0) {
+        return;
+    }
+
+    bool isArray = mode == JOBMODE_STEREO;
+    FrameBusFrame frame = makeFrame(source, publishing->format, renderTexture, renderTexture,
+                                    isArray ? GL_TEXTURE_2D_ARRAY : GL_TEXTURE_2D, width, height, isArray ? 2 : 1, sequence);
+
+    if (frameBus().hasSubscribers(source.texture(), publishing->format)) {
+        // Lets subscribers on shared contexts wait for the render. Like the texture, it is valid until the job renders again.
+        if (publishing->fence != nullptr) {
+            glDeleteSync(publishing->fence);
+        }
+
+        publishing->fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        glFlush();
+
+        frame.fence = publishing->fence;
+        frameBus().publish(frame);
+    }
+
+    if (isArray || publishing->readbackFailed || !frameBus().hasSubscribers(source.texture(), publishing->cpuFormat)) {
+        return;
+    }
+
+    if (publishing->readback == nullptr) {
+        auto readback = new GLES_FrameReadback(renderTexture, width, height, publishing->internalFormat);
+        if (!readback->initialize()) {
+            LOGE("Could not initialize frame readback, CPU frames of this job will not be published.");
+            readback->dispose();
+            delete readback;
+
+            publishing->readbackFailed = true;
+            return;
+        }
+
+        publishing->readback = readback;
+    }
+
+    frame.format = publishing->cpuFormat;
+    frame.textureId = 0;
+    frame.textureTarget = 0;
+    frame.fence = nullptr;
+    publishing->readback->capture(frame);
+}
+
+// Passes a job's new frame to the synchronizers pairing it. Called on the GL thread.
+static void pushStereoSyncFrame(GLuint job, uint64_t sequence, int64_t timestamp) {
+    lock_guard<mutex> lock(g_stereoSyncsMutex);
+    for (auto& syncIt : g_stereoSyncs) {
+        StereoSync& sync = syncIt.second;
+        for (int32_t eye = STEREO_EYE_LEFT; eye <= STEREO_EYE_RIGHT; eye++) {
+            if (sync.jobs[eye] == job) {
+                sync.synchronizer->push(eye, { job, sequence, timestamp });
+            }
+        }
+    }
+}
+
+// Copies the published pose. A pose is only overwritten after the other one is published, so the copy is
+// complete if nothing was published while it was taken.
+static bool readReprojection(const JobReprojectionBuffer& buffer, JobReprojection* reprojection) {
+    for (int attempt = 0; attempt < 4; attempt++) {
+        uint32_t published = __atomic_load_n(&buffer.published, __ATOMIC_ACQUIRE);
+        *reprojection = buffer.poses[published & 1];
+
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        if (__atomic_load_n(&buffer.published, __ATOMIC_RELAXED) == published) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static void updateReprojection(GLES_YUVConverter* converter, const GLES_CameraSource& source, const JobReprojection& reprojection) {
+    static const GLfloat IDENTITY[9] = { 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f };
+
+    const float* displayRotation = reprojection.displayRotation;
+    bool hasDisplayPose = displayRotation[0] != 0.0f || displayRotation[1] != 0.0f
+            || displayRotation[2] != 0.0f || displayRotation[3] != 0.0f;
+
+    // Without both poses, the frame is shown as captured rather than warped by a guess.
+    Pose capturePose;
+    if (!hasDisplayPose || !headPoseHistory().sample(source.timestamp(), &capturePose)) {
+        converter->setReprojection(IDENTITY);
+        return;
+    }
+
+    GLfloat homography[9];
+    computeReprojectionHomography(
+            capturePose.rotation,
+            reprojection.displayRotation,
+            reprojection.cameraRotation,
+            reprojection.intrinsics,
+            homography
+    );
+
+    converter->setReprojection(homography);
 }
 
 static void runJob(void* data) {
     auto renderData = reinterpret_cast<JobRunData*>(data);
     GLuint renderTexture = renderData->renderTexture;
 
+    shared_ptr<GLES_CameraSource> source;
     GLES_YUVConverter* converter;
-    ASurfaceTexture* srcTexture;
+    int32_t mode;
+    GLint width; GLint height;
+    shared_ptr<GLES_CameraSource> secondSource;
+    uint64_t lastSeenFrame;
+    uint64_t lastSeenSecondFrame;
+    int64_t lastSeenTimestamp;
+    JobSampling sampling;
+    GLES_FrameProbe* probe;
+    JobPublishing publishing;
+    int32_t historyLayers;
+    int32_t historyLayer;
     bool awaitingDispose;
 
     {
         lock_guard<mutex> lock(g_renderJobsMutex);
         if (g_renderJobs.find(renderTexture) == g_renderJobs.end()) {
             LOGE("Unknown job ID provided.");
-            renderData->onDone(-1, renderTexture);
+            completeRunJob(renderData, nullptr);
             return;
         }
 
-        const RenderJob& job = g_renderJobs[renderTexture];
+        RenderJob& job = g_renderJobs[renderTexture];
+        job.counters.runs++;
+
+        source = job.source;
         converter = job.converter;
-        srcTexture = job.srcTextureNative;
+        mode = job.mode;
+        width = job.width;
+        height = job.height;
+        secondSource = job.secondSource;
+        lastSeenFrame = job.lastSeenFrame;
+        lastSeenSecondFrame = job.lastSeenSecondFrame;
+        lastSeenTimestamp = job.lastSeenTimestamp;
+        sampling = job.sampling;
+        probe = job.probe;
+        publishing = job.publishing;
+        historyLayers = job.historyLayers;
+        historyLayer = job.historyLayer;
         awaitingDispose = job.awaitingDispose;
     }
 
     if (awaitingDispose) {
         LOGE("Cannot run disposing job.");
-        renderData->onDone(-1, renderTexture);
+        failRunJob(renderData);
         return;
     }
 
-    if (srcTexture == nullptr) {
+    if (!source->isBound() || (mode == JOBMODE_STEREO && !secondSource->isBound())) {
         LOGE("Job does not have valid source srcTexture.");
-        renderData->onDone(-1, renderTexture);
+        failRunJob(renderData);
         return;
     }
 
-    if (converter == nullptr) {
+    if (mode != JOBMODE_PASSTHROUGH && converter == nullptr) {
         LOGE("Job does not have valid converter.");
-        renderData->onDone(-1, renderTexture);
+        failRunJob(renderData);
+        return;
+    }
+
+    if (sampling.mode == SAMPLING_ON_CHANGE && probe == nullptr) {
+        probe = new GLES_FrameProbe();
+        if (!probe->initialize()) {
+            LOGE("Could not initialize frame probe.");
+            probe->dispose();
+            delete probe;
+
+            failRunJob(renderData);
+            return;
+        }
+
+        lock_guard<mutex> lock(g_renderJobsMutex);
+        g_renderJobs[renderTexture].probe = probe;
+    }
+
+    // Returns false until the camera delivers its first frame, which is not an error.
+    if (!source->update() || (mode == JOBMODE_STEREO && !secondSource->update())) {
+        completeRunJob(renderData, nullptr);
         return;
     }
 
-    bool result = converter->render(srcTexture);
-    if (!result) {
-        renderData->onDone(-1, renderTexture);
+    // Whichever job first latches a frame of a shared source publishes it.
+    if (source->takeUnpublishedFrame()) {
+        publishSourceFrame(*source, renderTexture);
+    }
+
+    if (mode == JOBMODE_STEREO && secondSource->takeUnpublishedFrame()) {
+        publishSourceFrame(*secondSource, renderTexture);
+    }
+
+    // Readbacks are published as soon as they finish, even if this run skips its frame.
+    if (publishing.readback != nullptr) {
+        publishing.readback->publishFinished();
+    }
+
+    // Another job sharing the source may have already latched this frame, and this job may have already seen it.
+    uint64_t frameIndex = source->frameIndex();
+    uint64_t secondFrameIndex = mode == JOBMODE_STEREO ? secondSource->frameIndex() : 0;
+    bool isNewFrame = frameIndex != lastSeenFrame || secondFrameIndex != lastSeenSecondFrame;
+
+    uint32_t droppedFrames = isNewFrame
+            ? estimateDroppedFrames(lastSeenTimestamp, source->timestamp(), source->framePeriod())
+            : 0;
+
+    // Runs on an already seen frame are only processed again if the frame was not skipped.
+    bool sampled = isNewFrame
+            ? shouldSampleFrame(sampling, probe, *source, droppedFrames)
+            : !sampling.lastFrameSkipped;
+
+    if (!sampled) {
+        if (isNewFrame) {
+            lock_guard<mutex> lock(g_renderJobsMutex);
+            RenderJob& job = g_renderJobs[renderTexture];
+
+            job.lastSeenFrame = frameIndex;
+            job.lastSeenSecondFrame = secondFrameIndex;
+            job.lastSeenTimestamp = source->timestamp();
+            job.sampling.framesSinceSample += 1 + droppedFrames;
+            job.sampling.droppedSinceSample += droppedFrames;
+            job.sampling.lastFrameSkipped = true;
+            job.counters.skippedFrames++;
+            job.counters.droppedFrames += droppedFrames;
+        }
+
+        completeRunJob(renderData, nullptr);
         return;
     }
 
-    int64_t timestamp = ASurfaceTexture_getTimestamp(srcTexture);
-    renderData->onDone(timestamp, renderTexture);
+    // Crop regions can change between runs, so batches are rendered even if the frame has not changed.
+    // Reprojected output depends on the display pose, so it is also rendered every run.
+    bool reprojecting = mode == JOBMODE_CONVERT && renderData->reprojection != nullptr;
+    JobReprojection reprojection;
+    if (reprojecting && readReprojection(*renderData->reprojection, &reprojection)) {
+        updateReprojection(converter, *source, reprojection);
+    }
+
+    // New frames go to the ring's next layer, repeated frames which are rendered again replace the newest layer.
+    if (historyLayers > 0) {
+        if (isNewFrame) {
+            historyLayer = (historyLayer + 1) % historyLayers;
+        }
+
+        if ((reprojecting || isNewFrame) && !converter->setTargetLayer(historyLayer)) {
+            failRunJob(renderData);
+            return;
+        }
+    }
+
+    if (mode == JOBMODE_CROP_BATCH) {
+        if (renderData->cropBatch != nullptr) {
+            GLES_CropBatch batch = *renderData->cropBatch;
+            if (!converter->render(*source, batch)) {
+                failRunJob(renderData);
+                return;
+            }
+        }
+    } else if (mode != JOBMODE_PASSTHROUGH && (reprojecting || isNewFrame)) {
+        bool rendered = mode == JOBMODE_STEREO
+                ? converter->render(*source, *secondSource)
+                : converter->render(*source);
+
+        if (!rendered) {
+            failRunJob(renderData);
+            return;
+        }
+    }
+
+    uint64_t sequence;
+    uint32_t reportedDroppedFrames = 0;
+    uint32_t flags = 0;
+
+    {
+        lock_guard<mutex> lock(g_renderJobsMutex);
+        RenderJob& job = g_renderJobs[renderTexture];
+
+        if (!isNewFrame) {
+            flags |= FRAMEFLAG_REPEATED;
+            job.counters.repeatedFrames++;
+        } else {
+            // Frames skipped by sampling are not dropped, but frames dropped around them are.
+            reportedDroppedFrames = job.sampling.droppedSinceSample + droppedFrames;
+            if (reportedDroppedFrames > 0) {
+                flags |= FRAMEFLAG_DROPPED;
+            }
+
+            job.sequence++;
+            job.historyLayer = historyLayer;
+            job.lastSeenFrame = frameIndex;
+            job.lastSeenSecondFrame = secondFrameIndex;
+            job.lastSeenTimestamp = source->timestamp();
+            job.counters.frames++;
+            job.counters.droppedFrames += droppedFrames;
+
+            job.sampling.framesSinceSample = 0;
+            job.sampling.droppedSinceSample = 0;
+            job.sampling.lastFrameSkipped = false;
+            job.sampling.sampleNext = false;
+            if (job.sampling.burstFrames > 0) {
+                job.sampling.burstFrames--;
+            }
+        }
+
+        sequence = job.sequence;
+    }
+
+    // Frame bus formats are interleaved RGBA, so planar outputs are not published. History rings keep their own frames.
+    if (isNewFrame && mode != JOBMODE_PASSTHROUGH && mode != JOBMODE_PLANAR && historyLayers == 0) {
+        GLsync previousFence = publishing.fence;
+        GLES_FrameReadback* previousReadback = publishing.readback;
+        bool previousReadbackFailed = publishing.readbackFailed;
+        publishJobFrame(*source, renderTexture, mode, width, height, sequence, &publishing);
+
+        if (publishing.fence != previousFence || publishing.readback != previousReadback
+            || publishing.readbackFailed != previousReadbackFailed) {
+            lock_guard<mutex> lock(g_renderJobsMutex);
+            g_renderJobs[renderTexture].publishing = publishing;
+        }
+    }
+
+    if (isNewFrame && mode == JOBMODE_CONVERT && historyLayers == 0) {
+        pushStereoSyncFrame(renderTexture, sequence, source->timestamp());
+    }
+
+    completeRunJob(renderData, source.get(), sequence, reportedDroppedFrames, flags, historyLayer);
 }
 
 static void disposeJob(void* data) {
@@ -236,7 +957,7 @@ static void disposeJob(void* data) {
     }
 
     RenderJob& job = g_renderJobs[renderTexture];
-    if (!job.awaitingDispose) {
+    if (job.ownsSource && !job.awaitingDispose) {
         LOGE("Cannot dispose job with active source texture.");
         disposeData->onDone(false, renderTexture);
         return;
@@ -247,40 +968,331 @@ static void disposeJob(void* data) {
         delete job.converter;
     }
 
+    if (job.probe != nullptr) {
+        job.probe->dispose();
+        delete job.probe;
+    }
+
+    if (job.publishing.fence != nullptr) {
+        glDeleteSync(job.publishing.fence);
+    }
+
+    if (job.publishing.readback != nullptr) {
+        job.publishing.readback->dispose();
+        delete job.publishing.readback;
+    }
+
+    // The source's GL texture lives until the last job reading from it is gone.
+    if (job.source.use_count() == 1) {
+        job.source->dispose();
+    }
+
+    if (job.secondSource != nullptr && job.secondSource.use_count() == 1) {
+        job.secondSource->dispose();
+    }
+
     g_renderJobs.erase(renderTexture);
     LOGI("Job successfully disposed.");
 
     disposeData->onDone(true, renderTexture);
 }
 
-static void UNITY_INTERFACE_API manageConverterJob(int eventId, void* data) {
-    if (data == nullptr) {
-        LOGE("nullptr passed to manageConverterJob.");
-        return;
+class GLESConverterBackend : public ConverterBackend {
+
+public:
+    int32_t type() const override {
+        return BACKEND_GLES;
     }
 
-    switch (eventId) {
-        case EVENTID_SETUP_JOB:
-            setupJob(data);
-            break;
+    void setupJob(JobSetupData* setupData) override {
+        applyGLDebugOutput();
+        ::setupJob(setupData);
+    }
 
-        case EVENTID_RUN_JOB:
-            runJob(data);
-            break;
+    void runJob(JobRunData* runData) override {
+        applyGLDebugOutput();
+        ::runJob(runData);
+    }
 
-        case EVENTID_DISPOSE_JOB:
-            disposeJob(data);
-            break;
+    void disposeJob(JobDisposeData* disposeData) override {
+        applyGLDebugOutput();
+        ::disposeJob(disposeData);
+    }
+};
 
-        default:
-            LOGE("Unknown event '%i'", eventId);
-            break;
+ConverterBackend* createGLESConverterBackend() {
+    return new GLESConverterBackend();
+}
+
+extern "C" void UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API
+pushGLESHeadPose(int64_t timestamp, float rx, float ry, float rz, float rw, float px, float py, float pz) {
+    headPoseHistory().push(timestamp, { { rx, ry, rz, rw }, { px, py, pz } });
+}
+
+extern "C" bool UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API
+sampleGLESHeadPose(int64_t timestamp, float rotation[4], float position[3]) {
+    Pose pose;
+    if (!headPoseHistory().sample(timestamp, &pose)) {
+        return false;
+    }
+
+    memcpy(rotation, pose.rotation, sizeof(pose.rotation));
+    memcpy(position, pose.position, sizeof(pose.position));
+    return true;
+}
+
+extern "C" void UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API
+pushGLESUnityTime(int64_t unityTime) {
+    observeUnityTime(unityTime);
+}
+
+extern "C" bool UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API
+convertGLESTimestamp(int64_t timestamp, int32_t fromDomain, int32_t toDomain, int64_t* result) {
+    return convertTimestamp(timestamp, fromDomain, toDomain, result);
+}
+
+extern "C" bool UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API
+getGLESClockFit(int32_t domain, ClockFit* fit) {
+    return clockFit(domain, fit);
+}
+
+extern "C" void UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API
+setGLESDebugOutput(bool enabled) {
+    requestGLDebugOutput(enabled);
+}
+
+extern "C" void UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API
+getNativeLogStats(NativeLogStats* stats) {
+    nativeLogStats(stats);
+}
+
+extern "C" int32_t UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API
+dumpNativeLogs(char* buffer, int32_t size) {
+    return (int32_t)dumpNativeLog(buffer, size > 0 ? (size_t)size : 0);
+}
+
+extern "C" bool UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API
+setGLESJobSampling(GLuint jobId, int32_t mode, uint32_t interval, float changeThreshold) {
+    if (mode < SAMPLING_ALL || mode > SAMPLING_BURST) {
+        LOGE("Unknown sampling mode '%i'", mode);
+        return false;
+    }
+
+    if (mode == SAMPLING_EVERY_NTH && interval == 0) {
+        LOGE("Sampling interval must be at least 1.");
+        return false;
+    }
+
+    lock_guard<mutex> lock(g_renderJobsMutex);
+    auto jobIt = g_renderJobs.find(jobId);
+    if (jobIt == g_renderJobs.end()) {
+        LOGE("Unknown job ID provided.");
+        return false;
+    }
+
+    JobSampling& sampling = jobIt->second.sampling;
+    sampling.mode = mode;
+    sampling.interval = interval > 0 ? interval : 1;
+    sampling.changeThreshold = changeThreshold;
+
+    // The next new frame is processed, so the new mode counts and compares from it.
+    sampling.framesSinceSample = 0;
+    sampling.sampleNext = true;
+    return true;
+}
+
+extern "C" bool UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API
+requestGLESJobBurst(GLuint jobId, uint32_t frameCount) {
+    lock_guard<mutex> lock(g_renderJobsMutex);
+    auto jobIt = g_renderJobs.find(jobId);
+    if (jobIt == g_renderJobs.end()) {
+        LOGE("Unknown job ID provided.");
+        return false;
+    }
+
+    jobIt->second.sampling.burstFrames += frameCount;
+    return true;
+}
+
+extern "C" bool UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API
+getGLESJobCounters(GLuint jobId, JobCounters* counters) {
+    lock_guard<mutex> lock(g_renderJobsMutex);
+    auto jobIt = g_renderJobs.find(jobId);
+    if (jobIt == g_renderJobs.end()) {
+        return false;
+    }
+
+    *counters = jobIt->second.counters;
+    return true;
+}
+
+extern "C" bool UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API
+getGLESFrameTiming(GLuint jobId, JitterStats* latency, JitterStats* interval) {
+    shared_ptr<GLES_CameraSource> source;
+    {
+        lock_guard<mutex> lock(g_renderJobsMutex);
+        auto jobIt = g_renderJobs.find(jobId);
+        if (jobIt == g_renderJobs.end()) {
+            return false;
+        }
+
+        source = jobIt->second.source;
+    }
+
+    source->timing().get(latency, interval);
+    return true;
+}
+
+extern "C" bool UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API
+getGLESFirstFrameDelay(GLuint jobId, int64_t* delay) {
+    lock_guard<mutex> lock(g_renderJobsMutex);
+    auto jobIt = g_renderJobs.find(jobId);
+    if (jobIt == g_renderJobs.end()) {
+        return false;
+    }
+
+    *delay = jobIt->second.source->firstFrameDelay();
+    return true;
+}
+
+extern "C" bool UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API
+getGLESCaptureMetadata(GLuint jobId, int64_t timestamp, int64_t maxDelta, int64_t* sensorTimestamp, CaptureMetadata* metadata) {
+    shared_ptr<GLES_CameraSource> source;
+    {
+        lock_guard<mutex> lock(g_renderJobsMutex);
+        auto jobIt = g_renderJobs.find(jobId);
+        if (jobIt == g_renderJobs.end()) {
+            return false;
+        }
+
+        source = jobIt->second.source;
     }
+
+    return source->captureMetadata().nearest(timestamp, maxDelta, sensorTimestamp, metadata);
+}
+
+//endregion
+
+//region Stereo synchronizer interface
+
+// Pairs the rendered frames of two converting jobs, one per camera, by timestamp. History ring jobs are not supported.
+// Returns the synchronizer's ID, or 0 on failure.
+extern "C" uint32_t UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API
+createGLESStereoSynchronizer(GLuint leftJobId, GLuint rightJobId, int64_t tolerance, uint32_t queueDepth) {
+    if (queueDepth == 0 || queueDepth > StereoSynchronizer::MAX_QUEUE_DEPTH || tolerance < 0) {
+        LOGE("Queue depth must be in the range [1, %u], and tolerance must not be negative.", StereoSynchronizer::MAX_QUEUE_DEPTH);
+        return 0;
+    }
+
+    {
+        lock_guard<mutex> lock(g_renderJobsMutex);
+        auto leftJobIt = g_renderJobs.find(leftJobId);
+        auto rightJobIt = g_renderJobs.find(rightJobId);
+        if (leftJobIt == g_renderJobs.end() || rightJobIt == g_renderJobs.end()
+            || leftJobIt->second.mode != JOBMODE_CONVERT || rightJobIt->second.mode != JOBMODE_CONVERT) {
+            LOGE("Stereo synchronizers need two valid converting job IDs.");
+            return 0;
+        }
+
+        // History rings keep frames in layers of their own, not in the single texture a pair describes, so they are not paired.
+        if (leftJobIt->second.historyLayers > 0 || rightJobIt->second.historyLayers > 0) {
+            LOGE("Stereo synchronizers do not support history ring jobs.");
+            return 0;
+        }
+    }
+
+    StereoSync sync = { new StereoSynchronizer(tolerance, queueDepth), { leftJobId, rightJobId } };
+
+    lock_guard<mutex> lock(g_stereoSyncsMutex);
+    uint32_t syncId = g_nextStereoSyncId++;
+    g_stereoSyncs[syncId] = sync;
+    return syncId;
+}
+
+extern "C" bool UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API
+pollGLESStereoPair(uint32_t syncId, StereoFramePair* pair) {
+    lock_guard<mutex> lock(g_stereoSyncsMutex);
+    auto syncIt = g_stereoSyncs.find(syncId);
+    return syncIt != g_stereoSyncs.end() && syncIt->second.synchronizer->poll(pair);
+}
+
+extern "C" bool UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API
+getGLESStereoSyncStats(uint32_t syncId, StereoSyncStats* stats) {
+    lock_guard<mutex> lock(g_stereoSyncsMutex);
+    auto syncIt = g_stereoSyncs.find(syncId);
+    if (syncIt == g_stereoSyncs.end()) {
+        return false;
+    }
+
+    syncIt->second.synchronizer->stats(stats);
+    return true;
+}
+
+extern "C" void UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API
+destroyGLESStereoSynchronizer(uint32_t syncId) {
+    StereoSync sync;
+    {
+        lock_guard<mutex> lock(g_stereoSyncsMutex);
+        auto syncIt = g_stereoSyncs.find(syncId);
+        if (syncIt == g_stereoSyncs.end()) {
+            return;
+        }
+
+        sync = syncIt->second;
+        g_stereoSyncs.erase(syncIt);
+    }
+
+    // Frames are only pushed under g_stereoSyncsMutex, so nothing uses the synchronizer once it is removed.
+    delete sync.synchronizer;
+}
+
+//endregion
+
+//region Frame bus interface
+
+extern "C" uint32_t UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API
+getUXRQCNativeAPIVersion() {
+    return UXRQC_NATIVEAPI_VERSION;
+}
+
+extern "C" uint32_t UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API
+subscribeFrameBus(uint32_t camera, int32_t format, int32_t policy, uint32_t queueDepth) {
+    return frameBus().subscribe(camera, format, policy, queueDepth);
+}
+
+extern "C" uint32_t UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API
+subscribeFrameBusCallback(uint32_t camera, int32_t format, FrameBusCallback callback, void* userData) {
+    return frameBus().subscribe(camera, format, callback, userData);
+}
+
+extern "C" bool UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API
+unsubscribeFrameBus(uint32_t subscriber) {
+    return frameBus().unsubscribe(subscriber);
+}
+
+extern "C" UNITY_INTERFACE_EXPORT const FrameBusFrame* UNITY_INTERFACE_API
+pollFrameBus(uint32_t subscriber) {
+    return frameBus().poll(subscriber);
+}
+
+extern "C" bool UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API
+getFrameBusStats(uint32_t subscriber, FrameBusStats* stats) {
+    return frameBus().stats(subscriber, stats);
+}
+
+extern "C" void UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API
+retainFrameBusFrame(const FrameBusFrame* frame) {
+    FrameBus::retain(frame);
+}
+
+extern "C" void UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API
+releaseFrameBusFrame(const FrameBusFrame* frame) {
+    FrameBus::release(frame);
 }
 
-extern "C" UnityRenderingEventAndData UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API
-getGLESManageConverterJobEvent() {
-    return manageConverterJob;
+extern "C" void UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API
+publishFrameBusFrame(const FrameBusFrame* frame, FrameBusReleaseCallback onRelease, void* userData) {
+    frameBus().publish(*frame, onRelease, userData);
 }
 
 //endregion
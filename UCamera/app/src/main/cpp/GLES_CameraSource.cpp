@@ -0,0 +1,392 @@
+// Copyright 2026 URAV ADVANCED LEARNING SYSTEMS PRIVATE LIMITED
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "GLES_CameraSource.h"
+#include "NativeLog.h"
+#include <android/surface_texture_jni.h>
+#include <android/hardware_buffer.h>
+#include <GLES2/gl2ext.h>
+
+#define TAG "UXRQC.GLCameraSource"
+#define LOGI(...) NATIVE_LOG(ANDROID_LOG_INFO,  TAG, __VA_ARGS__)
+#define LOGE(...) NATIVE_LOG(ANDROID_LOG_ERROR, TAG, __VA_ARGS__)
+
+// The source holds two images and acquires a third, and one more lets the camera render while it does.
+#define MAX_READER_IMAGES 4
+
+using namespace std;
+
+static PFNEGLGETNATIVECLIENTBUFFERANDROIDPROC s_eglGetNativeClientBufferANDROID = nullptr;
+static PFNEGLCREATEIMAGEKHRPROC s_eglCreateImageKHR = nullptr;
+static PFNEGLDESTROYIMAGEKHRPROC s_eglDestroyImageKHR = nullptr;
+static PFNGLEGLIMAGETARGETTEXTURE2DOESPROC s_glEGLImageTargetTexture2DOES = nullptr;
+
+static bool loadEGLImageFunctions() {
+    if (s_glEGLImageTargetTexture2DOES != nullptr) {
+        return true;
+    }
+
+    s_eglGetNativeClientBufferANDROID = reinterpret_cast<PFNEGLGETNATIVECLIENTBUFFERANDROIDPROC>(eglGetProcAddress("eglGetNativeClientBufferANDROID"));
+    s_eglCreateImageKHR = reinterpret_cast<PFNEGLCREATEIMAGEKHRPROC>(eglGetProcAddress("eglCreateImageKHR"));
+    s_eglDestroyImageKHR = reinterpret_cast<PFNEGLDESTROYIMAGEKHRPROC>(eglGetProcAddress("eglDestroyImageKHR"));
+
+    // Loaded last, as it marks the functions as loaded.
+    auto imageTargetTexture = reinterpret_cast<PFNGLEGLIMAGETARGETTEXTURE2DOESPROC>(eglGetProcAddress("glEGLImageTargetTexture2DOES"));
+    if (s_eglGetNativeClientBufferANDROID == nullptr || s_eglCreateImageKHR == nullptr || s_eglDestroyImageKHR == nullptr || imageTargetTexture == nullptr) {
+        LOGE("Could not load EGLImage functions.");
+        return false;
+    }
+
+    s_glEGLImageTargetTexture2DOES = imageTargetTexture;
+    return true;
+}
+
+static void onReaderImageAvailable(void* context, AImageReader*) {
+    static_cast<GLES_CameraSource*>(context)->notifyFrameAvailable();
+}
+
+GLES_CameraSource::GLES_CameraSource() {
+    _texture = 0;
+
+    _surfaceTextureJava = nullptr;
+    _surfaceTextureNative = nullptr;
+    _imageReader = nullptr;
+    _attachPending = false;
+
+    _image = nullptr;
+    _eglImage = EGL_NO_IMAGE_KHR;
+    _previousImage = nullptr;
+    _previousEglImage = EGL_NO_IMAGE_KHR;
+    _eglDisplay = EGL_NO_DISPLAY;
+
+    _pendingFrames = 0;
+
+    for (int i = 0; i < 16; i++) {
+        _transformMatrix[i] = (i % 5 == 0) ? 1.0f : 0.0f;
+    }
+
+    _timestamp = -1;
+    _frameIndex = 0;
+    _publishedFrameIndex = 0;
+    _framePeriod = 0;
+    _longIntervalCount = 0;
+    _longIntervalSum = 0;
+    _bindTime = 0;
+    _firstFrameDelay = -1;
+    _bt2020 = false;
+    _disposed = false;
+}
+
+bool GLES_CameraSource::initialize() {
+    glGenTextures(1, &_texture);
+    if (glGetError() != GL_NO_ERROR || _texture == 0) {
+        LOGE("Could not create source texture.");
+        if (_texture) {
+            glDeleteTextures(1, &_texture);
+            _texture = 0;
+        }
+
+        return false;
+    }
+
+    glBindTexture(GL_TEXTURE_EXTERNAL_OES, _texture);
+    glTexParameteri(GL_TEXTURE_EXTERNAL_OES, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_EXTERNAL_OES, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_EXTERNAL_OES, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_EXTERNAL_OES, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glBindTexture(GL_TEXTURE_EXTERNAL_OES, 0);
+
+    if (glGetError() != GL_NO_ERROR) {
+        LOGE("Could not configure source texture.");
+        glDeleteTextures(1, &_texture);
+        _texture = 0;
+        return false;
+    }
+
+    LOGI("Source texture created.");
+    return true;
+}
+
+void GLES_CameraSource::dispose() {
+    if (_disposed) {
+        return;
+    }
+
+    _disposed = true;
+    unbindImageReader();
+    if (_texture) {
+        glDeleteTextures(1, &_texture);
+        _texture = 0;
+    }
+
+    LOGI("Source disposed.");
+}
+
+bool GLES_CameraSource::bind(JNIEnv *env, jobject surfaceTexture, bool detached) {
+    lock_guard<mutex> lock(_bindingMutex);
+    if (_surfaceTextureJava != nullptr || _surfaceTextureNative != nullptr) {
+        LOGE("Cannot bind source with already bound surfaceTexture.");
+        return false;
+    }
+
+    jobject globalRef = env->NewGlobalRef(surfaceTexture);
+    if (globalRef == nullptr) {
+        LOGE("Could not create global reference for surfaceTexture.");
+        return false;
+    }
+
+    _surfaceTextureJava = globalRef;
+    _surfaceTextureNative = ASurfaceTexture_fromSurfaceTexture(env, surfaceTexture);
+    _attachPending = detached;
+    _bindTime = clockNow(CLOCK_MONOTONIC);
+    return true;
+}
+
+void GLES_CameraSource::unbind(JNIEnv *env) {
+    lock_guard<mutex> lock(_bindingMutex);
+    if (_surfaceTextureNative != nullptr) {
+        ASurfaceTexture_release(_surfaceTextureNative);
+        _surfaceTextureNative = nullptr;
+    }
+
+    if (_surfaceTextureJava != nullptr) {
+        env->DeleteGlobalRef(_surfaceTextureJava);
+        _surfaceTextureJava = nullptr;
+    }
+}
+
+bool GLES_CameraSource::isBound() {
+    lock_guard<mutex> lock(_bindingMutex);
+    return _surfaceTextureNative != nullptr || _imageReader != nullptr;
+}
+
+ANativeWindow* GLES_CameraSource::bindImageReader(int32_t width, int32_t height) {
+    lock_guard<mutex> lock(_bindingMutex);
+    if (_surfaceTextureNative != nullptr || _imageReader != nullptr) {
+        LOGE("Cannot bind image reader to already bound source.");
+        return nullptr;
+    }
+
+    AImageReader* reader = nullptr;
+    if (AImageReader_newWithUsage(width, height, AIMAGE_FORMAT_PRIVATE, AHARDWAREBUFFER_USAGE_GPU_SAMPLED_IMAGE, MAX_READER_IMAGES, &reader) != AMEDIA_OK) {
+        LOGE("Could not create image reader.");
+        return nullptr;
+    }
+
+    AImageReader_ImageListener listener = { this, onReaderImageAvailable };
+    ANativeWindow* window = nullptr;
+    if (AImageReader_setImageListener(reader, &listener) != AMEDIA_OK || AImageReader_getWindow(reader, &window) != AMEDIA_OK) {
+        LOGE("Could not configure image reader.");
+        AImageReader_delete(reader);
+        return nullptr;
+    }
+
+    // Buffers are stored top row first, while SurfaceTexture frames are flipped by their transform.
+    for (int i = 0; i < 16; i++) {
+        _transformMatrix[i] = (i % 5 == 0) ? 1.0f : 0.0f;
+    }
+
+    _transformMatrix[5] = -1.0f;
+    _transformMatrix[13] = 1.0f;
+
+    _imageReader = reader;
+    _bindTime = clockNow(CLOCK_MONOTONIC);
+    return window;
+}
+
+void GLES_CameraSource::unbindImageReader() {
+    lock_guard<mutex> lock(_bindingMutex);
+    if (_imageReader == nullptr) {
+        return;
+    }
+
+    // EGLImages keep their buffers alive, so the texture stays valid until the next frame is latched.
+    releaseImage(_previousImage, _previousEglImage);
+    releaseImage(_image, _eglImage);
+
+    AImageReader_delete(_imageReader);
+    _imageReader = nullptr;
+}
+
+void GLES_CameraSource::releaseImage(AImage*& image, EGLImageKHR& eglImage) {
+    if (eglImage != EGL_NO_IMAGE_KHR) {
+        s_eglDestroyImageKHR(_eglDisplay, eglImage);
+        eglImage = EGL_NO_IMAGE_KHR;
+    }
+
+    if (image != nullptr) {
+        AImage_delete(image);
+        image = nullptr;
+    }
+}
+
+bool GLES_CameraSource::latchImage() {
+    if (!loadEGLImageFunctions()) {
+        return false;
+    }
+
+    AImage* image = nullptr;
+    if (AImageReader_acquireLatestImage(_imageReader, &image) != AMEDIA_OK) {
+        return false;
+    }
+
+    AHardwareBuffer* buffer = nullptr;
+    if (AImage_getHardwareBuffer(image, &buffer) != AMEDIA_OK) {
+        LOGE("Could not get image hardware buffer.");
+        AImage_delete(image);
+        return false;
+    }
+
+    _eglDisplay = eglGetCurrentDisplay();
+    EGLint attributes[] = { EGL_IMAGE_PRESERVED_KHR, EGL_TRUE, EGL_NONE };
+    EGLImageKHR eglImage = s_eglCreateImageKHR(_eglDisplay, EGL_NO_CONTEXT, EGL_NATIVE_BUFFER_ANDROID,
+                                               s_eglGetNativeClientBufferANDROID(buffer), attributes);
+
+    if (eglImage == EGL_NO_IMAGE_KHR) {
+        LOGE("Could not create EGLImage, error: %i", eglGetError());
+        AImage_delete(image);
+        return false;
+    }
+
+    glBindTexture(GL_TEXTURE_EXTERNAL_OES, _texture);
+    s_glEGLImageTargetTexture2DOES(GL_TEXTURE_EXTERNAL_OES, eglImage);
+    glBindTexture(GL_TEXTURE_EXTERNAL_OES, 0);
+
+    // The oldest image is no longer read by any submitted GPU work.
+    releaseImage(_previousImage, _previousEglImage);
+    _previousImage = _image;
+    _previousEglImage = _eglImage;
+    _image = image;
+    _eglImage = eglImage;
+
+    AImage_getTimestamp(image, &_timestamp);
+    return true;
+}
+
+void GLES_CameraSource::notifyFrameAvailable() {
+    _pendingFrames.fetch_add(1, memory_order_release);
+}
+
+void GLES_CameraSource::updateFramePeriod(int64_t previousTimestamp) {
+    // The reported frame duration is exact, but its capture result may not have arrived yet.
+    int64_t metadataTimestamp;
+    CaptureMetadata metadata;
+    if (_captureMetadata.nearest(_timestamp, 0, &metadataTimestamp, &metadata) && metadata.frameDuration > 0) {
+        _framePeriod = metadata.frameDuration;
+        _longIntervalCount = 0;
+        _longIntervalSum = 0;
+        return;
+    }
+
+    int64_t interval = _timestamp - previousTimestamp;
+    if (previousTimestamp < 0 || interval <= 0) {
+        return;
+    }
+
+    if (_framePeriod == 0) {
+        _framePeriod = interval;
+        return;
+    }
+
+    if (interval < _framePeriod + _framePeriod / 2) {
+        _framePeriod += (interval - _framePeriod) / 16;
+        _longIntervalCount = 0;
+        _longIntervalSum = 0;
+        return;
+    }
+
+    // A single long interval is a dropped frame, but a run of similar ones means the frame rate itself dropped.
+    if (_longIntervalCount > 0) {
+        int64_t average = _longIntervalSum / _longIntervalCount;
+        int64_t delta = interval > average ? interval - average : average - interval;
+        if (delta > average / 8) {
+            _longIntervalCount = 0;
+            _longIntervalSum = 0;
+        }
+    }
+
+    _longIntervalCount++;
+    _longIntervalSum += interval;
+    if (_longIntervalCount == LONG_INTERVAL_RUN) {
+        _framePeriod = _longIntervalSum / _longIntervalCount;
+        _longIntervalCount = 0;
+        _longIntervalSum = 0;
+    }
+}
+
+bool GLES_CameraSource::update() {
+    lock_guard<mutex> lock(_bindingMutex);
+    if (_surfaceTextureNative == nullptr && _imageReader == nullptr) {
+        return false;
+    }
+
+    if (_attachPending) {
+        // Frames queued while detached are kept, so the first one is still latched below.
+        int attachResult = ASurfaceTexture_attachToGLContext(_surfaceTextureNative, _texture);
+        if (attachResult) {
+            LOGE("Could not attach surfaceTexture, error: %i", attachResult);
+            return false;
+        }
+
+        _attachPending = false;
+    }
+
+    if (_pendingFrames.exchange(0, memory_order_acquire) == 0) {
+        // Nothing new from the camera, the last latched image (if any) is still current.
+        return _frameIndex > 0;
+    }
+
+    int64_t previousTimestamp = _timestamp;
+    if (_imageReader != nullptr) {
+        if (!latchImage()) {
+            return _frameIndex > 0;
+        }
+    } else {
+        int updateResult = ASurfaceTexture_updateTexImage(_surfaceTextureNative);
+        if (updateResult) {
+            LOGE("Could not update surfaceTexture, error: %i", updateResult);
+            return false;
+        }
+
+        ASurfaceTexture_getTransformMatrix(_surfaceTextureNative, _transformMatrix);
+        _timestamp = ASurfaceTexture_getTimestamp(_surfaceTextureNative);
+    }
+
+    _frameIndex++;
+
+    updateFramePeriod(previousTimestamp);
+
+    int64_t latchTime = clockNow(CLOCK_MONOTONIC);
+    observeCameraFrame(_timestamp);
+
+    if (_frameIndex == 1) {
+        _firstFrameDelay = latchTime - _bindTime;
+        LOGI("First frame latched %.1f ms after binding.", _firstFrameDelay / 1e6);
+    }
+
+    int64_t captureTime;
+    if (convertTimestamp(_timestamp, CLOCKDOMAIN_CAMERA, CLOCKDOMAIN_MONOTONIC, &captureTime)) {
+        _timing.addFrame(captureTime, latchTime);
+    }
+    return true;
+}
+
+bool GLES_CameraSource::takeUnpublishedFrame() {
+    if (_frameIndex == 0 || _publishedFrameIndex == _frameIndex) {
+        return false;
+    }
+
+    _publishedFrameIndex = _frameIndex;
+    return true;
+}
@@ -0,0 +1,140 @@
+// Copyright 2026 URAV ADVANCED LEARNING SYSTEMS PRIVATE LIMITED
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef UXR_QUESTCAMERA_GLES_CAMERASOURCE_H
+#define UXR_QUESTCAMERA_GLES_CAMERASOURCE_H
+
+#include <GLES3/gl3.h>
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#include <android/surface_texture.h>
+#include <media/NdkImageReader.h>
+#include <jni.h>
+#include <atomic>
+#include <memory>
+#include <mutex>
+
+#include "CaptureMetadata.h"
+#include "ClockMapper.h"
+
+// Owns the external texture and SurfaceTexture a camera session renders into.
+// Any number of converter jobs can read from one source; the SurfaceTexture is
+// only updated once per camera frame, no matter how many jobs consume it.
+// Natively opened cameras render into an AImageReader instead, whose buffers are bound to the texture as EGLImages.
+class GLES_CameraSource {
+
+public:
+    GLES_CameraSource();
+
+    bool initialize();
+    void dispose();
+
+    // A detached surfaceTexture is attached to the source's texture on the GL thread when the first frame is latched,
+    // so the camera can be configured before the source has been initialized.
+    bool bind(JNIEnv* env, jobject surfaceTexture, bool detached);
+    void unbind(JNIEnv* env);
+    bool isBound();
+
+    // Creates the image reader a native camera renders into. Returns its window, which is owned by the source,
+    // or nullptr if the source is already bound.
+    ANativeWindow* bindImageReader(int32_t width, int32_t height);
+    void unbindImageReader();
+
+    void notifyFrameAvailable();
+
+    // Latches the newest camera frame if one arrived since the last call. Must be called on the GL thread.
+    // Returns false if the source is unbound, errored, or has not received a frame yet.
+    bool update();
+
+    GLuint texture() const { return _texture; }
+    const float* transformMatrix() const { return _transformMatrix; }
+    int64_t timestamp() const { return _timestamp; }
+
+    // Incremented each time update() latches a new image, so consumers can skip redundant work.
+    uint64_t frameIndex() const { return _frameIndex; }
+
+    // Returns true once for each latched frame, so frames of shared sources are only published to the frame bus once.
+    bool takeUnpublishedFrame();
+
+    // Capture results of the camera stream, pushed from the session's capture callback thread.
+    CaptureMetadataHistory& captureMetadata() { return _captureMetadata; }
+    const CaptureMetadataHistory& captureMetadata() const { return _captureMetadata; }
+
+    // Time between camera frames in nanoseconds, from the reported frame duration when available, otherwise
+    // estimated from latched timestamps. 0 before either is known.
+    int64_t framePeriod() const { return _framePeriod; }
+
+    // Capture to latch latency and capture interval of recently latched frames.
+    const FrameTimingStats& timing() const { return _timing; }
+
+    // Time from the source being bound to its first frame being latched, in nanoseconds, or -1 before the first frame.
+    int64_t firstFrameDelay() const { return _firstFrameDelay; }
+
+    // Set by the owning job when the camera stream is 10-bit, so every job reading the source converts it as BT.2020.
+    void setBT2020(bool bt2020) { _bt2020 = bt2020; }
+    bool isBT2020() const { return _bt2020; }
+
+private:
+    // Consecutive, similar long intervals needed before the frame period estimate increases to match them.
+    static constexpr int LONG_INTERVAL_RUN = 4;
+
+    bool latchImage();
+    void updateFramePeriod(int64_t previousTimestamp);
+    void releaseImage(AImage*& image, EGLImageKHR& eglImage);
+
+    GLuint _texture;
+
+    std::mutex _bindingMutex;
+    jobject _surfaceTextureJava;
+    ASurfaceTexture* _surfaceTextureNative;
+    AImageReader* _imageReader;
+    bool _attachPending;
+
+    // The bound image, and the one before it, which GPU work from the last frame may still read.
+    AImage* _image;
+    EGLImageKHR _eglImage;
+    AImage* _previousImage;
+    EGLImageKHR _previousEglImage;
+    EGLDisplay _eglDisplay;
+
+    std::atomic<uint32_t> _pendingFrames;
+
+    float _transformMatrix[16];
+    int64_t _timestamp;
+    uint64_t _frameIndex;
+    uint64_t _publishedFrameIndex;
+    int64_t _framePeriod;
+    int _longIntervalCount;
+    int64_t _longIntervalSum;
+
+    int64_t _bindTime;
+    int64_t _firstFrameDelay;
+    bool _bt2020;
+
+    CaptureMetadataHistory _captureMetadata;
+    FrameTimingStats _timing;
+
+    bool _disposed;
+};
+
+// Defined in GLESTextureConversionManager.cpp, for cameras opened natively.
+
+// Returns the source owned by a job, or nullptr if the job does not exist, is disposing, or reads another job's source.
+std::shared_ptr<GLES_CameraSource> findOwnedJobSource(uint32_t jobId);
+
+// Unbinds the image reader of a job's source and marks the job as awaiting dispose, like unbinding a SurfaceTexture.
+void releaseJobSource(uint32_t jobId);
+
+
+#endif //UXR_QUESTCAMERA_GLES_CAMERASOURCE_H
@@ -0,0 +1,175 @@
+// Copyright 2026 URAV ADVANCED LEARNING SYSTEMS PRIVATE LIMITED
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "GLES_Debug.h"
+#include "NativeLog.h"
+#include <EGL/egl.h>
+#include <atomic>
+#include <cstring>
+
+#define TAG "UXRQC.GLDebug"
+#define LOGI(...) NATIVE_LOG(ANDROID_LOG_INFO,  TAG, __VA_ARGS__)
+#define LOGW(...) NATIVE_LOG(ANDROID_LOG_WARN,  TAG, __VA_ARGS__)
+#define LOGE(...) NATIVE_LOG(ANDROID_LOG_ERROR, TAG, __VA_ARGS__)
+
+using namespace std;
+
+static PFNGLDEBUGMESSAGECALLBACKKHRPROC s_glDebugMessageCallbackKHR = nullptr;
+static PFNGLDEBUGMESSAGECONTROLKHRPROC s_glDebugMessageControlKHR = nullptr;
+static PFNGLOBJECTLABELKHRPROC s_glObjectLabelKHR = nullptr;
+static PFNGLPUSHDEBUGGROUPKHRPROC s_glPushDebugGroupKHR = nullptr;
+static PFNGLPOPDEBUGGROUPKHRPROC s_glPopDebugGroupKHR = nullptr;
+static PFNGLGETPOINTERVKHRPROC s_glGetPointervKHR = nullptr;
+
+// Unity may use debug output itself, so its callback is kept while ours is registered, and restored with the capability after.
+static GLDEBUGPROCKHR s_previousCallback = nullptr;
+static const void* s_previousUserParam = nullptr;
+static bool s_wasOutputEnabled = false;
+
+static atomic<bool> s_requested(false);
+
+// Only changed on the GL thread, but read by isGLDebugOutputEnabled() from anywhere.
+static atomic<bool> s_enabled(false);
+
+static const char* typeName(GLenum type) {
+    switch (type) {
+        case GL_DEBUG_TYPE_ERROR_KHR:               return "error";
+        case GL_DEBUG_TYPE_DEPRECATED_BEHAVIOR_KHR: return "deprecated";
+        case GL_DEBUG_TYPE_UNDEFINED_BEHAVIOR_KHR:  return "undefined behavior";
+        case GL_DEBUG_TYPE_PORTABILITY_KHR:         return "portability";
+        case GL_DEBUG_TYPE_PERFORMANCE_KHR:         return "performance";
+        default:                                    return "other";
+    }
+}
+
+// Called by the driver, possibly on its own threads since synchronous output is not enabled.
+static void GL_APIENTRY onDebugMessage(GLenum source, GLenum type, GLuint id, GLenum severity,
+                                       GLsizei length, const GLchar* message, const void* userParam) {
+    if (s_previousCallback != nullptr) {
+        s_previousCallback(source, type, id, severity, length, message, s_previousUserParam);
+    }
+
+    // Messages from our own debug groups are only markers.
+    if (type == GL_DEBUG_TYPE_PUSH_GROUP_KHR || type == GL_DEBUG_TYPE_POP_GROUP_KHR) {
+        return;
+    }
+
+    if (type == GL_DEBUG_TYPE_ERROR_KHR || severity == GL_DEBUG_SEVERITY_HIGH_KHR) {
+        LOGE("GL %s 0x%x: %s", typeName(type), id, message);
+    } else if (type == GL_DEBUG_TYPE_PERFORMANCE_KHR || severity == GL_DEBUG_SEVERITY_MEDIUM_KHR) {
+        LOGW("GL %s 0x%x: %s", typeName(type), id, message);
+    } else {
+        LOGI("GL %s 0x%x: %s", typeName(type), id, message);
+    }
+}
+
+static bool loadDebugExtension() {
+    if (s_glDebugMessageCallbackKHR != nullptr) {
+        return true;
+    }
+
+    auto extensions = reinterpret_cast<const char*>(glGetString(GL_EXTENSIONS));
+    if (extensions == nullptr || strstr(extensions, "GL_KHR_debug") == nullptr) {
+        LOGE("GL_KHR_debug is not supported on this device.");
+        return false;
+    }
+
+    s_glDebugMessageControlKHR = reinterpret_cast<PFNGLDEBUGMESSAGECONTROLKHRPROC>(eglGetProcAddress("glDebugMessageControlKHR"));
+    s_glObjectLabelKHR = reinterpret_cast<PFNGLOBJECTLABELKHRPROC>(eglGetProcAddress("glObjectLabelKHR"));
+    s_glPushDebugGroupKHR = reinterpret_cast<PFNGLPUSHDEBUGGROUPKHRPROC>(eglGetProcAddress("glPushDebugGroupKHR"));
+    s_glPopDebugGroupKHR = reinterpret_cast<PFNGLPOPDEBUGGROUPKHRPROC>(eglGetProcAddress("glPopDebugGroupKHR"));
+    s_glGetPointervKHR = reinterpret_cast<PFNGLGETPOINTERVKHRPROC>(eglGetProcAddress("glGetPointervKHR"));
+
+    // Loaded last, as it marks the extension as loaded.
+    auto debugMessageCallback = reinterpret_cast<PFNGLDEBUGMESSAGECALLBACKKHRPROC>(eglGetProcAddress("glDebugMessageCallbackKHR"));
+
+    if (debugMessageCallback == nullptr || s_glDebugMessageControlKHR == nullptr || s_glObjectLabelKHR == nullptr
+        || s_glPushDebugGroupKHR == nullptr || s_glPopDebugGroupKHR == nullptr || s_glGetPointervKHR == nullptr) {
+        LOGE("Could not load GL_KHR_debug functions.");
+        return false;
+    }
+
+    s_glDebugMessageCallbackKHR = debugMessageCallback;
+    return true;
+}
+
+void requestGLDebugOutput(bool enabled) {
+    s_requested = enabled;
+}
+
+void applyGLDebugOutput() {
+    bool requested = s_requested.load(memory_order_relaxed);
+    if (requested == s_enabled.load(memory_order_relaxed)) {
+        return;
+    }
+
+    if (!requested) {
+        s_enabled = false;
+        s_glDebugMessageCallbackKHR(s_previousCallback, s_previousUserParam);
+        if (!s_wasOutputEnabled) {
+            glDisable(GL_DEBUG_OUTPUT_KHR);
+        }
+
+        s_previousCallback = nullptr;
+        s_previousUserParam = nullptr;
+        LOGI("GL debug output disabled.");
+        return;
+    }
+
+    if (!loadDebugExtension()) {
+        s_requested = false;
+        return;
+    }
+
+    void* previousCallback = nullptr;
+    void* previousUserParam = nullptr;
+    s_glGetPointervKHR(GL_DEBUG_CALLBACK_FUNCTION_KHR, &previousCallback);
+    s_glGetPointervKHR(GL_DEBUG_CALLBACK_USER_PARAM_KHR, &previousUserParam);
+    s_previousCallback = reinterpret_cast<GLDEBUGPROCKHR>(previousCallback);
+    s_previousUserParam = previousUserParam;
+    s_wasOutputEnabled = glIsEnabled(GL_DEBUG_OUTPUT_KHR);
+
+    // Message filters are left as they are, GLES_DebugGroup enables every message only inside our own groups.
+    glEnable(GL_DEBUG_OUTPUT_KHR);
+    s_glDebugMessageCallbackKHR(onDebugMessage, nullptr);
+
+    s_enabled = true;
+    LOGI("GL debug output enabled.");
+}
+
+bool isGLDebugOutputEnabled() {
+    return s_enabled.load(memory_order_relaxed);
+}
+
+void labelGLObject(GLenum identifier, GLuint name, const char* label) {
+    if (s_enabled.load(memory_order_relaxed) && name != 0) {
+        s_glObjectLabelKHR(identifier, name, -1, label);
+    }
+}
+
+GLES_DebugGroup::GLES_DebugGroup(const char* name) {
+    _pushed = s_enabled.load(memory_order_relaxed);
+    if (_pushed) {
+        s_glPushDebugGroupKHR(GL_DEBUG_SOURCE_APPLICATION_KHR, 0, -1, name);
+
+        // Filters are part of the group, so popping it restores the ones outside.
+        s_glDebugMessageControlKHR(GL_DONT_CARE, GL_DONT_CARE, GL_DONT_CARE, 0, nullptr, GL_TRUE);
+    }
+}
+
+GLES_DebugGroup::~GLES_DebugGroup() {
+    if (_pushed) {
+        s_glPopDebugGroupKHR();
+    }
+}
@@ -0,0 +1,52 @@
+// Copyright 2026 URAV ADVANCED LEARNING SYSTEMS PRIVATE LIMITED
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef UXR_QUESTCAMERA_GLES_DEBUG_H
+#define UXR_QUESTCAMERA_GLES_DEBUG_H
+
+#include <GLES3/gl3.h>
+#include <GLES2/gl2ext.h>
+
+// Requests KHR_debug instrumentation to be turned on or off. Can be called from any thread, and is
+// applied on the GL thread by the next applyGLDebugOutput().
+void requestGLDebugOutput(bool enabled);
+
+// Registers or removes the debug message callback, if requested. Must be called on the GL thread.
+// A callback registered before, such as Unity's, still receives every message, and is restored on removal.
+void applyGLDebugOutput();
+
+// While enabled, GL errors and performance warnings are reported by the driver through the debug callback,
+// so hot paths can poll glGetError once at the end instead of after every call. KHR_debug does not clear
+// the error flag, so it must still be polled.
+bool isGLDebugOutputEnabled();
+
+// Labels a GL object in debug messages and GPU captures. Does nothing while debug output is disabled.
+void labelGLObject(GLenum identifier, GLuint name, const char* label);
+
+// Wraps the GL calls made during its lifetime in a debug group, while debug output is enabled.
+class GLES_DebugGroup {
+
+public:
+    explicit GLES_DebugGroup(const char* name);
+    ~GLES_DebugGroup();
+
+    GLES_DebugGroup(const GLES_DebugGroup&) = delete;
+    GLES_DebugGroup& operator=(const GLES_DebugGroup&) = delete;
+
+private:
+    bool _pushed;
+};
+
+
+#endif //UXR_QUESTCAMERA_GLES_DEBUG_H
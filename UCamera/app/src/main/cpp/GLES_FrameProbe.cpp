@@ -0,0 +1,214 @@
+// Copyright 2026 URAV ADVANCED LEARNING SYSTEMS PRIVATE LIMITED
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "GLES_FrameProbe.h"
+#include "NativeLog.h"
+#include <cstdlib>
+#include <cstring>
+
+#define TAG "UXRQC.GLFrameProbe"
+#define LOGI(...) NATIVE_LOG(ANDROID_LOG_INFO,  TAG, __VA_ARGS__)
+#define LOGE(...) NATIVE_LOG(ANDROID_LOG_ERROR, TAG, __VA_ARGS__)
+
+static bool hasErrors(const char *methodName) {
+    bool hasErrors = false;
+
+    GLenum error;
+    while ((error = glGetError()) != GL_NO_ERROR) {
+        LOGE("Encountered GL error %u at %s", error, methodName);
+        hasErrors = true;
+    }
+
+    return hasErrors;
+}
+
+GLES_FrameProbe::GLES_FrameProbe() {
+    _texture = 0;
+    _frameBufferObj = 0;
+    _converter = nullptr;
+
+    _pixelBuffers[0] = _pixelBuffers[1] = 0;
+    _fences[0] = _fences[1] = nullptr;
+    _writeIndex = 0;
+
+    _hasLuma = false;
+    _hasReference = false;
+    _disposed = false;
+}
+
+bool GLES_FrameProbe::initialize() {
+    glGenTextures(1, &_texture);
+    glBindTexture(GL_TEXTURE_2D, _texture);
+    glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA8, SIZE, SIZE);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    if (hasErrors("glTexStorage2D")) {
+        return false;
+    }
+
+    glGenFramebuffers(1, &_frameBufferObj);
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, _frameBufferObj);
+    glFramebufferTexture2D(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, _texture, 0);
+    bool isComplete = glCheckFramebufferStatus(GL_READ_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE;
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+    if (hasErrors("glFramebufferTexture2D") || !isComplete) {
+        LOGE("Could not create probe frameBuffer.");
+        return false;
+    }
+
+    glGenBuffers(2, _pixelBuffers);
+    for (GLuint pixelBuffer : _pixelBuffers) {
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, pixelBuffer);
+        glBufferData(GL_PIXEL_PACK_BUFFER, SIZE * SIZE * 4, nullptr, GL_STREAM_READ);
+    }
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    if (hasErrors("glBufferData")) {
+        return false;
+    }
+
+    // Box filtering averages more of each camera pixel block than a single tap, which steadies the thumbnail.
+    const GLfloat cropRect[4] = { 0.0f, 0.0f, 1.0f, 1.0f };
+    GLES_ConverterOptions options;
+    options.filter = FILTER_BOX;
+
+    _converter = new GLES_YUVConverter(_texture, SIZE, SIZE, cropRect, options);
+    if (!_converter->initialize()) {
+        LOGE("Could not initialize probe converter.");
+        return false;
+    }
+
+    LOGI("Frame probe setup.");
+    return true;
+}
+
+bool GLES_FrameProbe::capture(const GLES_CameraSource& source) {
+    // A readback still pending from two captures ago is dropped rather than waited on.
+    if (_fences[_writeIndex] != nullptr) {
+        glDeleteSync(_fences[_writeIndex]);
+        _fences[_writeIndex] = nullptr;
+    }
+
+    if (!_converter->render(source)) {
+        return false;
+    }
+
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, _frameBufferObj);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, _pixelBuffers[_writeIndex]);
+    glReadPixels(0, 0, SIZE, SIZE, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+
+    if (hasErrors("glReadPixels")) {
+        return false;
+    }
+
+    _fences[_writeIndex] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    _writeIndex = 1 - _writeIndex;
+    return true;
+}
+
+bool GLES_FrameProbe::poll() {
+    bool hasNewLuma = false;
+
+    // The slot at _writeIndex holds the older readback, so newer results overwrite older ones.
+    for (int i = 0; i < 2; i++) {
+        int index = (_writeIndex + i) % 2;
+        if (_fences[index] == nullptr) {
+            continue;
+        }
+
+        GLenum status = glClientWaitSync(_fences[index], 0, 0);
+        if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED) {
+            continue;
+        }
+
+        glDeleteSync(_fences[index]);
+        _fences[index] = nullptr;
+
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, _pixelBuffers[index]);
+        auto pixels = static_cast<const uint8_t*>(glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, SIZE * SIZE * 4, GL_MAP_READ_BIT));
+        if (pixels != nullptr) {
+            for (int pixel = 0; pixel < SIZE * SIZE; pixel++) {
+                const uint8_t* rgba = pixels + pixel * 4;
+                _luma[pixel] = (uint8_t)((77 * rgba[0] + 150 * rgba[1] + 29 * rgba[2]) >> 8);
+            }
+
+            glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+            _hasLuma = true;
+            hasNewLuma = true;
+        }
+
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    }
+
+    return hasNewLuma && !hasErrors("glMapBufferRange");
+}
+
+float GLES_FrameProbe::changeFromReference() const {
+    if (!_hasReference || !_hasLuma) {
+        return 1.0f;
+    }
+
+    uint32_t difference = 0;
+    for (int pixel = 0; pixel < SIZE * SIZE; pixel++) {
+        difference += abs((int)_luma[pixel] - (int)_referenceLuma[pixel]);
+    }
+
+    return (float)difference / (255.0f * SIZE * SIZE);
+}
+
+void GLES_FrameProbe::setReference() {
+    if (_hasLuma) {
+        memcpy(_referenceLuma, _luma, sizeof(_luma));
+        _hasReference = true;
+    }
+}
+
+void GLES_FrameProbe::clearReference() {
+    _hasReference = false;
+}
+
+void GLES_FrameProbe::dispose() {
+    if (_disposed) {
+        return;
+    }
+
+    _disposed = true;
+    for (GLsync& fence : _fences) {
+        if (fence != nullptr) {
+            glDeleteSync(fence);
+            fence = nullptr;
+        }
+    }
+
+    if (_converter != nullptr) {
+        _converter->dispose();
+        delete _converter;
+        _converter = nullptr;
+    }
+
+    if (_pixelBuffers[0]) {
+        glDeleteBuffers(2, _pixelBuffers);
+    }
+
+    if (_frameBufferObj) {
+        glDeleteFramebuffers(1, &_frameBufferObj);
+    }
+
+    if (_texture) {
+        glDeleteTextures(1, &_texture);
+    }
+
+    LOGI("Frame probe disposed.");
+}
@@ -0,0 +1,68 @@
+// Copyright 2026 URAV ADVANCED LEARNING SYSTEMS PRIVATE LIMITED
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef UXR_QUESTCAMERA_GLES_FRAMEPROBE_H
+#define UXR_QUESTCAMERA_GLES_FRAMEPROBE_H
+
+#include <GLES3/gl3.h>
+#include <cstdint>
+
+#include "GLES_CameraSource.h"
+#include "GLES_YUVConverter.h"
+
+// Renders tiny luma thumbnails of camera frames and reads them back asynchronously, so jobs can
+// measure how much the image changed without converting or stalling on full frames.
+class GLES_FrameProbe {
+
+public:
+    static constexpr GLint SIZE = 16;
+
+    GLES_FrameProbe();
+
+    bool initialize();
+    void dispose();
+
+    // Renders a thumbnail of the source and starts reading it back. Must be called on the GL thread.
+    bool capture(const GLES_CameraSource& source);
+
+    // Collects finished readbacks without waiting. Returns true if a newer thumbnail is available.
+    bool poll();
+
+    // Mean absolute luma difference in [0, 1] between the newest thumbnail and the reference, or 1 without a reference.
+    float changeFromReference() const;
+
+    // Makes the newest thumbnail the reference for changeFromReference().
+    void setReference();
+
+    // Drops the reference, so changeFromReference() returns 1 until setReference() is called again.
+    void clearReference();
+
+private:
+    GLuint _texture;
+    GLuint _frameBufferObj;
+    GLES_YUVConverter* _converter;
+
+    GLuint _pixelBuffers[2];
+    GLsync _fences[2];
+    int _writeIndex;
+
+    uint8_t _luma[SIZE * SIZE];
+    uint8_t _referenceLuma[SIZE * SIZE];
+    bool _hasLuma;
+    bool _hasReference;
+    bool _disposed;
+};
+
+
+#endif //UXR_QUESTCAMERA_GLES_FRAMEPROBE_H
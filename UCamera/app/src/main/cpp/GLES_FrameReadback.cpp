@@ -0,0 +1,227 @@
+// Copyright 2026 URAV ADVANCED LEARNING SYSTEMS PRIVATE LIMITED
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "GLES_FrameReadback.h"
+#include "NativeLog.h"
+#include <cstring>
+#include <mutex>
+#include <vector>
+
+#define TAG "UXRQC.GLFrameReadback"
+#define LOGI(...) NATIVE_LOG(ANDROID_LOG_INFO,  TAG, __VA_ARGS__)
+#define LOGE(...) NATIVE_LOG(ANDROID_LOG_ERROR, TAG, __VA_ARGS__)
+
+using namespace std;
+
+static bool hasErrors(const char *methodName) {
+    bool hasErrors = false;
+
+    GLenum error;
+    while ((error = glGetError()) != GL_NO_ERROR) {
+        LOGE("Encountered GL error %u at %s", error, methodName);
+        hasErrors = true;
+    }
+
+    return hasErrors;
+}
+
+// CPU buffers of published frames, recycled once subscribers release them.
+class ReadbackBufferPool {
+
+public:
+    explicit ReadbackBufferPool(size_t bufferSize) : _bufferSize(bufferSize) { }
+
+    ~ReadbackBufferPool() {
+        for (uint8_t* buffer : _buffers) {
+            delete[] buffer;
+        }
+    }
+
+    uint8_t* acquire() {
+        lock_guard<mutex> lock(_mutex);
+        if (_buffers.empty()) {
+            return new uint8_t[_bufferSize];
+        }
+
+        uint8_t* buffer = _buffers.back();
+        _buffers.pop_back();
+        return buffer;
+    }
+
+    void recycle(uint8_t* buffer) {
+        lock_guard<mutex> lock(_mutex);
+        _buffers.push_back(buffer);
+    }
+
+private:
+    const size_t _bufferSize;
+
+    mutex _mutex;
+    vector<uint8_t*> _buffers;
+};
+
+// Called from whichever thread releases the last reference, userData is a heap-allocated reference to the pool.
+static void releaseBuffer(const FrameBusFrame* frame, void* userData) {
+    auto pool = static_cast<shared_ptr<ReadbackBufferPool>*>(userData);
+    (*pool)->recycle(static_cast<uint8_t*>(const_cast<void*>(frame->planes[0].data)));
+    delete pool;
+}
+
+GLES_FrameReadback::GLES_FrameReadback(GLuint texture, GLint width, GLint height, GLint internalFormat) {
+    _texture = texture;
+    _width = width;
+    _height = height;
+    _frameBufferObj = 0;
+
+    // GL_RGBA with GL_UNSIGNED_BYTE is always readable from normalized formats, and GL_UNSIGNED_INT_2_10_10_10_REV from RGB10_A2.
+    // Half floats are only readable if the implementation says so, which initialize() checks.
+    _internalFormat = internalFormat;
+    _type = internalFormat == GL_RGB10_A2 ? GL_UNSIGNED_INT_2_10_10_10_REV
+            : internalFormat == GL_RGBA16F ? GL_HALF_FLOAT
+            : GL_UNSIGNED_BYTE;
+    _pixelSize = _type == GL_HALF_FLOAT ? 8 : 4;
+
+    for (int i = 0; i < SLOTS; i++) {
+        _pixelBuffers[i] = 0;
+        _fences[i] = nullptr;
+        _frames[i] = {};
+    }
+
+    _writeIndex = 0;
+    _pool = make_shared<ReadbackBufferPool>((size_t)width * height * _pixelSize);
+    _disposed = false;
+}
+
+bool GLES_FrameReadback::initialize() {
+    glGenFramebuffers(1, &_frameBufferObj);
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, _frameBufferObj);
+    glFramebufferTexture2D(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, _texture, 0);
+    bool isComplete = glCheckFramebufferStatus(GL_READ_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE;
+
+    GLint readFormat = 0, readType = 0;
+    if (isComplete && _type == GL_HALF_FLOAT) {
+        glGetIntegerv(GL_IMPLEMENTATION_COLOR_READ_FORMAT, &readFormat);
+        glGetIntegerv(GL_IMPLEMENTATION_COLOR_READ_TYPE, &readType);
+    }
+
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+    if (hasErrors("glFramebufferTexture2D") || !isComplete) {
+        LOGE("Could not create readback frameBuffer.");
+        return false;
+    }
+
+    if (_type == GL_HALF_FLOAT && (readFormat != GL_RGBA || readType != GL_HALF_FLOAT)) {
+        LOGE("RGBA16F textures cannot be read back as half floats on this device.");
+        return false;
+    }
+
+    glGenBuffers(SLOTS, _pixelBuffers);
+    for (GLuint pixelBuffer : _pixelBuffers) {
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, pixelBuffer);
+        glBufferData(GL_PIXEL_PACK_BUFFER, _width * _height * _pixelSize, nullptr, GL_STREAM_READ);
+    }
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    if (hasErrors("glBufferData")) {
+        return false;
+    }
+
+    LOGI("Frame readback setup (internal format: 0x%x).", _internalFormat);
+    return true;
+}
+
+bool GLES_FrameReadback::capture(const FrameBusFrame& frame) {
+    // Subscribers only ever want recent frames, so a readback still pending from SLOTS captures ago is dropped.
+    if (_fences[_writeIndex] != nullptr) {
+        glDeleteSync(_fences[_writeIndex]);
+        _fences[_writeIndex] = nullptr;
+    }
+
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, _frameBufferObj);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, _pixelBuffers[_writeIndex]);
+    glReadPixels(0, 0, _width, _height, GL_RGBA, _type, nullptr);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+
+    if (hasErrors("glReadPixels")) {
+        return false;
+    }
+
+    _fences[_writeIndex] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    _frames[_writeIndex] = frame;
+    _writeIndex = (_writeIndex + 1) % SLOTS;
+    return true;
+}
+
+void GLES_FrameReadback::publishFinished() {
+    // The slot at _writeIndex holds the oldest readback. The GPU finishes them in order, so stop at the first pending one.
+    for (int i = 0; i < SLOTS; i++) {
+        int index = (_writeIndex + i) % SLOTS;
+        if (_fences[index] == nullptr) {
+            continue;
+        }
+
+        GLenum status = glClientWaitSync(_fences[index], 0, 0);
+        if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED) {
+            break;
+        }
+
+        glDeleteSync(_fences[index]);
+        _fences[index] = nullptr;
+
+        size_t size = (size_t)_width * _height * _pixelSize;
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, _pixelBuffers[index]);
+        auto pixels = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, (GLsizeiptr)size, GL_MAP_READ_BIT);
+        if (pixels == nullptr) {
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+            hasErrors("glMapBufferRange");
+            continue;
+        }
+
+        uint8_t* buffer = _pool->acquire();
+        memcpy(buffer, pixels, size);
+        glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+        FrameBusFrame& frame = _frames[index];
+        frame.planes[0] = { buffer, _width * _pixelSize, _pixelSize };
+        frame.planeCount = 1;
+
+        frameBus().publish(frame, releaseBuffer, new shared_ptr<ReadbackBufferPool>(_pool));
+    }
+}
+
+void GLES_FrameReadback::dispose() {
+    if (_disposed) {
+        return;
+    }
+
+    _disposed = true;
+    for (GLsync& fence : _fences) {
+        if (fence != nullptr) {
+            glDeleteSync(fence);
+            fence = nullptr;
+        }
+    }
+
+    if (_pixelBuffers[0]) {
+        glDeleteBuffers(SLOTS, _pixelBuffers);
+    }
+
+    if (_frameBufferObj) {
+        glDeleteFramebuffers(1, &_frameBufferObj);
+    }
+
+    LOGI("Frame readback disposed.");
+}
@@ -0,0 +1,67 @@
+// Copyright 2026 URAV ADVANCED LEARNING SYSTEMS PRIVATE LIMITED
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef UXR_QUESTCAMERA_GLES_FRAMEREADBACK_H
+#define UXR_QUESTCAMERA_GLES_FRAMEREADBACK_H
+
+#include <GLES3/gl3.h>
+#include <cstdint>
+#include <memory>
+
+#include "FrameBus.h"
+
+class ReadbackBufferPool;
+
+// Reads a job's RGBA output back into CPU memory through a ring of pixel buffers, and publishes the
+// pixels to the frame bus once they arrive, so neither the GL thread nor the subscribers stall on the GPU.
+// Pixels keep the precision of the texture's internal format: RGB10_A2 is read as packed 10-bit, RGBA16F as half floats.
+class GLES_FrameReadback {
+
+public:
+    static constexpr int SLOTS = 3;
+
+    GLES_FrameReadback(GLuint texture, GLint width, GLint height, GLint internalFormat);
+
+    bool initialize();
+    void dispose();
+
+    // Starts reading back the texture. frame is published with the pixels once they arrive. Must be called on the GL thread.
+    bool capture(const FrameBusFrame& frame);
+
+    // Publishes finished readbacks without waiting. Must be called on the GL thread.
+    void publishFinished();
+
+private:
+    GLuint _texture;
+    GLint _width;
+    GLint _height;
+    GLuint _frameBufferObj;
+
+    // The glReadPixels type matching the texture's internal format, and the size of one pixel read with it.
+    GLint _internalFormat;
+    GLenum _type;
+    GLint _pixelSize;
+
+    GLuint _pixelBuffers[SLOTS];
+    GLsync _fences[SLOTS];
+    FrameBusFrame _frames[SLOTS];
+    int _writeIndex;
+
+    // Shared with the release callbacks of published frames, which may outlive the readback.
+    std::shared_ptr<ReadbackBufferPool> _pool;
+    bool _disposed;
+};
+
+
+#endif //UXR_QUESTCAMERA_GLES_FRAMEREADBACK_H
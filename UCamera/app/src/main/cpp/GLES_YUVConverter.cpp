@@ -13,49 +13,305 @@
 // limitations under the License.
 
 #include "GLES_YUVConverter.h"
-#include <android/log.h>
+#include "GLES_Debug.h"
+#include "NativeLog.h"
 #include <GLES2/gl2ext.h>
+#include <GLES3/gl31.h>
+#include <EGL/egl.h>
 #include <malloc.h>
+#include <cstring>
 
 #define TAG "UXRQC.GLYUVConverter"
-#define LOGI(...) __android_log_print(ANDROID_LOG_INFO,  TAG, __VA_ARGS__)
-#define LOGE(...) __android_log_print(ANDROID_LOG_ERROR, TAG, __VA_ARGS__)
+#define LOGI(...) NATIVE_LOG(ANDROID_LOG_INFO,  TAG, __VA_ARGS__)
+#define LOGE(...) NATIVE_LOG(ANDROID_LOG_ERROR, TAG, __VA_ARGS__)
+
+#define VARIANT_MULTIVIEW     0x1
+#define VARIANT_FILTER_SHIFT  1
+#define VARIANT_FILTER_MASK   0x3
+#define VARIANT_SHARPEN       0x8
+#define VARIANT_CROP_BATCH    0x10
+#define VARIANT_REPROJECT     0x20
+#define VARIANT_BT2020        0x40
+#define VARIANT_HIGHP         0x80
+#define VARIANT_PLANE_LUMA    0x100
+#define VARIANT_PLANE_CHROMA  0x200
 
 //region Shader sources
 
+// Variants are compiled by inserting #defines between the version directive and these sources.
+const char* SHADER_VERSION_DIRECTIVE = "#version 300 es\n";
+
 const char* VERTEX_SHADER_SOURCE = R"glsl(
-#version 300 es
+#ifdef MULTIVIEW
+#extension GL_OVR_multiview2 : require
+layout(num_views = 2) in;
+#define VIEW_COUNT 2
+#define VIEW_ID gl_ViewID_OVR
+#else
+#define VIEW_COUNT 1
+#define VIEW_ID 0u
+#endif
+
+#ifdef CROP_BATCH
+#define MAX_CROPS 16
+
+// Per-instance regions, as (x, y, width, height) in UV space
+uniform vec4 uSourceRects[MAX_CROPS];
+uniform vec4 uTargetRects[MAX_CROPS];
+#endif
 
 // Input vertex data
 layout(location = 0) in vec4 aPosition;
 layout(location = 1) in vec2 aTexCoord;
 
-// The matrix from SurfaceTexture
-uniform mat4 uTransformMatrix;
+// The matrices from the SurfaceTextures, one per view
+uniform mat4 uTransformMatrix[VIEW_COUNT];
+
+// Region of the camera image to convert, as (x, y, width, height) in UV space
+uniform vec4 uCropRect;
 
 // Pass the transformed texture coordinate to the fragment shader
 out vec2 vTexCoord;
+flat out uint vViewId;
+
+// Camera UVs covered per output UV, used by the fragment shader to size filter footprints
+flat out vec2 vCropScale;
+
+#ifdef REPROJECT
+// Maps display-time camera UVs to capture-time camera UVs
+uniform mat3 uReprojection;
+
+// Homogeneous, so the perspective divide and SurfaceTexture transform happen per fragment
+out vec3 vReprojectedTexCoord;
+#endif
 
 void main() {
+#ifdef CROP_BATCH
+    vec4 cropRect = uSourceRects[gl_InstanceID];
+    vec4 targetRect = uTargetRects[gl_InstanceID];
+    gl_Position = vec4((targetRect.xy + aTexCoord * targetRect.zw) * 2.0 - 1.0, 0.0, 1.0);
+    vCropScale = cropRect.zw / targetRect.zw;
+#else
+    vec4 cropRect = uCropRect;
     gl_Position = aPosition;
-    vTexCoord = (uTransformMatrix * vec4(aTexCoord, 0.0, 1.0)).xy;
+    vCropScale = cropRect.zw;
+#endif
+
+    vec2 croppedTexCoord = cropRect.xy + aTexCoord * cropRect.zw;
+    vTexCoord = (uTransformMatrix[VIEW_ID] * vec4(croppedTexCoord, 0.0, 1.0)).xy;
+    vViewId = VIEW_ID;
+
+#ifdef REPROJECT
+    vReprojectedTexCoord = uReprojection * vec3(croppedTexCoord, 1.0);
+#endif
 }
 )glsl";
 
 const char* FRAGMENT_SHADER_SOURCE = R"glsl(
-#version 300 es
 #extension GL_EXT_YUV_target : require
+#ifdef HIGHP
+precision highp float;
+#else
 precision mediump float;
+#endif
 
-in vec2 vTexCoord;
+#define PI 3.14159265
+#define MAX_BOX_TAPS 4
+
+in highp vec2 vTexCoord;
+flat in uint vViewId;
+flat in highp vec2 vCropScale;
+
+#ifdef REPROJECT
+in highp vec3 vReprojectedTexCoord;
+
+// highp to match the vertex stage's declaration, reprojection only supports single views
+uniform highp mat4 uTransformMatrix[1];
+#endif
+
+// External samplers cannot be indexed dynamically, so each view has its own.
+uniform __samplerExternal2DY2YEXT sYUVTexture0;
+#ifdef MULTIVIEW
+uniform __samplerExternal2DY2YEXT sYUVTexture1;
+#endif
+
+uniform highp vec2 uOutputSize;
+
+#ifdef SHARPEN
+uniform float uSharpness;
+#endif
 
-uniform __samplerExternal2DY2YEXT sYUVTexture;
 out vec4 outColor;
 
+vec3 sampleYUV(highp vec2 uv) {
+#ifdef MULTIVIEW
+    return vViewId == 0u ? texture(sYUVTexture0, uv).xyz : texture(sYUVTexture1, uv).xyz;
+#else
+    return texture(sYUVTexture0, uv).xyz;
+#endif
+}
+
+highp vec2 sourceSize() {
+#ifdef MULTIVIEW
+    return vec2(vViewId == 0u ? textureSize(sYUVTexture0, 0) : textureSize(sYUVTexture1, 0));
+#else
+    return vec2(textureSize(sYUVTexture0, 0));
+#endif
+}
+
+// Source texels covered by one output pixel, at least 1.
+highp vec2 footprint(highp vec2 size) {
+    return max(abs(vCropScale) * size / uOutputSize, vec2(1.0));
+}
+
+#if defined(FILTER_BICUBIC) || defined(FILTER_LANCZOS)
+
+highp float kernel(highp float x) {
+    x = abs(x);
+#ifdef FILTER_BICUBIC
+    // Catmull-Rom
+    if (x < 1.0) return (1.5 * x - 2.5) * x * x + 1.0;
+    if (x < 2.0) return ((-0.5 * x + 2.5) * x - 4.0) * x + 2.0;
+    return 0.0;
+#else
+    // Lanczos, a = 2
+    if (x < 1e-4) return 1.0;
+    if (x >= 2.0) return 0.0;
+    highp float px = PI * x;
+    return 2.0 * sin(px) * sin(px * 0.5) / (px * px);
+#endif
+}
+
+vec3 filterSample(highp vec2 uv) {
+    highp vec2 size = sourceSize();
+    highp vec2 scale = footprint(size);
+
+    // 4x4 taps on a grid with one tap per footprint, so the kernel stretches to cover large downscales.
+    highp vec2 gridPos = (uv * size - 0.5) / scale;
+    highp vec2 gridBase = floor(gridPos);
+    highp vec2 f = gridPos - gridBase;
+
+    highp vec3 sum = vec3(0.0);
+    highp float weightSum = 0.0;
+    for (int y = -1; y <= 2; y++) {
+        highp float weightY = kernel(float(y) - f.y);
+        for (int x = -1; x <= 2; x++) {
+            highp float weight = kernel(float(x) - f.x) * weightY;
+            sum += sampleYUV(((gridBase + vec2(x, y)) * scale + 0.5) / size) * weight;
+            weightSum += weight;
+        }
+    }
+
+    return sum / weightSum;
+}
+
+#elif defined(FILTER_BOX)
+
+vec3 filterSample(highp vec2 uv) {
+    highp vec2 size = sourceSize();
+    highp vec2 scale = footprint(size);
+
+    // Each bilinear tap averages up to 2x2 texels, so one tap per two texels covers the footprint.
+    ivec2 taps = clamp(ivec2(ceil(scale * 0.5)), ivec2(1), ivec2(MAX_BOX_TAPS));
+    highp vec2 tapStep = scale / vec2(taps) / size;
+    highp vec2 start = uv - 0.5 * scale / size + 0.5 * tapStep;
+
+    highp vec3 sum = vec3(0.0);
+    for (int y = 0; y < taps.y; y++) {
+        for (int x = 0; x < taps.x; x++) {
+            sum += sampleYUV(start + vec2(x, y) * tapStep);
+        }
+    }
+
+    return sum / float(taps.x * taps.y);
+}
+
+#else
+
+vec3 filterSample(highp vec2 uv) {
+    return sampleYUV(uv);
+}
+
+#endif
+
+#ifdef SHARPEN
+
+// Contrast-adaptive sharpening of luma, using the four neighbours one output pixel away.
+// The sharpening is reduced where the neighbourhood is already close to clipping, which avoids halos.
+float sharpenLuma(highp vec2 uv, float center) {
+    highp vec2 size = sourceSize();
+    highp vec2 pixelStep = footprint(size) / size;
+
+    float up    = sampleYUV(uv - vec2(0.0, pixelStep.y)).x;
+    float down  = sampleYUV(uv + vec2(0.0, pixelStep.y)).x;
+    float left  = sampleYUV(uv - vec2(pixelStep.x, 0.0)).x;
+    float right = sampleYUV(uv + vec2(pixelStep.x, 0.0)).x;
+
+    float minLuma = min(center, min(min(up, down), min(left, right)));
+    float maxLuma = max(center, max(max(up, down), max(left, right)));
+
+    float amplitude = sqrt(clamp(min(minLuma, 1.0 - maxLuma) / max(maxLuma, 1e-4), 0.0, 1.0));
+    float weight = -amplitude / mix(8.0, 5.0, uSharpness);
+
+    return clamp((center + (up + down + left + right) * weight) / (1.0 + 4.0 * weight), 0.0, 1.0);
+}
+
+#endif
+
+#ifdef BT2020
+
+// Converts narrow range BT.2020 YUV to RGB, as per ITU-R BT.2020. The transfer function is not inverted.
+vec3 bt2020ToRGB(vec3 yuv) {
+    // P010 samples are normalized from 16 bits, with the 10-bit value in the high bits.
+    highp vec3 code = yuv * (65535.0 / 64.0);
+    float y = (code.x - 64.0) / 876.0;
+    float cb = (code.y - 512.0) / 896.0;
+    float cr = (code.z - 512.0) / 896.0;
+
+    return vec3(
+        y + 1.4746 * cr,
+        y - 0.16455 * cb - 0.57135 * cr,
+        y + 1.8814 * cb
+    );
+}
+
+#endif
+
+highp vec2 sourceTexCoord() {
+#ifdef REPROJECT
+    highp vec2 texCoord = vReprojectedTexCoord.xy / vReprojectedTexCoord.z;
+    return (uTransformMatrix[0] * vec4(texCoord, 0.0, 1.0)).xy;
+#else
+    return vTexCoord;
+#endif
+}
+
 void main() {
-    vec3 yuv = texture(sYUVTexture, vTexCoord).xyz;
+    highp vec2 texCoord = sourceTexCoord();
+    vec3 yuv = filterSample(texCoord);
+#ifdef SHARPEN
+    yuv.x = sharpenLuma(texCoord, yuv.x);
+#endif
+
+    // Planar outputs are converted when they are sampled, so the YUV values are written as they are.
+#if defined(PLANE_LUMA)
+    outColor = vec4(yuv.x, 0.0, 0.0, 1.0);
+#elif defined(PLANE_CHROMA)
+    outColor = vec4(yuv.yz, 0.0, 1.0);
+#else
+#ifdef BT2020
+    vec3 rgb = bt2020ToRGB(yuv);
+#else
     vec3 rgb = yuv_2_rgb(yuv, itu_601_full_range);
-    outColor = vec4(rgb, 1.0);
+#endif
+
+#ifdef HIGHP
+    // Float textures keep values above 1, normalized textures clamp them when written.
+    outColor = vec4(max(rgb, 0.0), 1.0);
+#else
+    outColor = vec4(clamp(rgb, 0.0, 1.0), 1.0);
+#endif
+#endif
 }
 )glsl";
 
@@ -65,13 +321,13 @@ void main() {
 
 uint8_t GLES_YUVConverter::s_staticReferenceHolders      = 0;
 
-GLuint GLES_YUVConverter::s_shaderProgram                = 0;
-GLint GLES_YUVConverter::s_shaderTransformMatrixHandle   = 0;
-GLint GLES_YUVConverter::s_shaderTextureSamplerHandle    = 0;
+std::map<uint32_t, GLES_YUVConverter::ShaderVariant> GLES_YUVConverter::s_shaderVariants;
 
 GLuint GLES_YUVConverter::s_vertexBufferObj              = 0;
 GLuint GLES_YUVConverter::s_vertexArrayObj               = 0;
 
+static PFNGLFRAMEBUFFERTEXTUREMULTIVIEWOVRPROC s_glFramebufferTextureMultiviewOVR = nullptr;
+
 static bool hasErrors(const char *methodName) {
     bool hasErrors = false;
 
@@ -84,7 +340,13 @@ static bool hasErrors(const char *methodName) {
     return hasErrors;
 }
 
-static bool compileShader(GLenum type, const char *source, GLuint *shader) {
+// With debug output enabled, the driver reports errors through the callback, so the render path only polls glGetError
+// once per draw(), which still has to clear the error flag so Unity doesn't see our errors as its own.
+static bool hasRenderErrors(const char *methodName) {
+    return !isGLDebugOutputEnabled() && hasErrors(methodName);
+}
+
+static bool compileShader(GLenum type, const char* const* sources, GLsizei sourceCount, GLuint *shader) {
 
     *shader = glCreateShader(type);
     if (hasErrors("glCreateShader") || *shader == 0) {
@@ -92,7 +354,7 @@ static bool compileShader(GLenum type, const char *source, GLuint *shader) {
         return false;
     }
 
-    glShaderSource(*shader, 1, &source, nullptr);
+    glShaderSource(*shader, sourceCount, sources, nullptr);
     glCompileShader(*shader);
 
     GLint status;
@@ -170,14 +432,63 @@ static bool linkShaders(GLuint vertexShader, GLuint fragmentShader, GLuint* shad
     return true;
 }
 
-static bool setupShaderProgram(GLuint* shaderProgram, GLint* shaderTransformMatrixHandle, GLint* shaderTextureSamplerHandle) {
+static bool buildShaderProgram(uint32_t variant, GLuint* shaderProgram) {
+
+    const char* defines[9];
+    GLsizei defineCount = 0;
+
+    if (variant & VARIANT_MULTIVIEW) {
+        defines[defineCount++] = "#define MULTIVIEW\n";
+    }
+
+    switch ((variant >> VARIANT_FILTER_SHIFT) & VARIANT_FILTER_MASK) {
+        case FILTER_BICUBIC: defines[defineCount++] = "#define FILTER_BICUBIC\n"; break;
+        case FILTER_LANCZOS: defines[defineCount++] = "#define FILTER_LANCZOS\n"; break;
+        case FILTER_BOX:     defines[defineCount++] = "#define FILTER_BOX\n"; break;
+        default: break;
+    }
+
+    if (variant & VARIANT_SHARPEN) {
+        defines[defineCount++] = "#define SHARPEN\n";
+    }
+
+    if (variant & VARIANT_CROP_BATCH) {
+        defines[defineCount++] = "#define CROP_BATCH\n";
+    }
+
+    if (variant & VARIANT_REPROJECT) {
+        defines[defineCount++] = "#define REPROJECT\n";
+    }
+
+    if (variant & VARIANT_BT2020) {
+        defines[defineCount++] = "#define BT2020\n";
+    }
+
+    if (variant & VARIANT_HIGHP) {
+        defines[defineCount++] = "#define HIGHP\n";
+    }
+
+    if (variant & VARIANT_PLANE_LUMA) {
+        defines[defineCount++] = "#define PLANE_LUMA\n";
+    } else if (variant & VARIANT_PLANE_CHROMA) {
+        defines[defineCount++] = "#define PLANE_CHROMA\n";
+    }
+
+    const char* vertexSources[11] = { SHADER_VERSION_DIRECTIVE };
+    const char* fragmentSources[11] = { SHADER_VERSION_DIRECTIVE };
+    for (GLsizei i = 0; i < defineCount; i++) {
+        vertexSources[i + 1] = fragmentSources[i + 1] = defines[i];
+    }
+
+    vertexSources[defineCount + 1] = VERTEX_SHADER_SOURCE;
+    fragmentSources[defineCount + 1] = FRAGMENT_SHADER_SOURCE;
 
     GLuint vertexShader, fragmentShader;
-    if (!compileShader(GL_VERTEX_SHADER, VERTEX_SHADER_SOURCE, &vertexShader)) {
+    if (!compileShader(GL_VERTEX_SHADER, vertexSources, defineCount + 2, &vertexShader)) {
         return false;
     }
 
-    if (!compileShader(GL_FRAGMENT_SHADER, FRAGMENT_SHADER_SOURCE, &fragmentShader)) {
+    if (!compileShader(GL_FRAGMENT_SHADER, fragmentSources, defineCount + 2, &fragmentShader)) {
         glDeleteShader(vertexShader);
         return false;
     }
@@ -185,22 +496,58 @@ static bool setupShaderProgram(GLuint* shaderProgram, GLint* shaderTransformMatr
     bool result = linkShaders(vertexShader, fragmentShader, shaderProgram);
     glDeleteShader(vertexShader);
     glDeleteShader(fragmentShader);
+    return result;
+}
 
-    if (result) {
+// Formats with more than 8 bits per channel, which mediump would quantize.
+static bool isHighPrecisionFormat(GLint internalFormat) {
+    switch (internalFormat) {
+        case GL_RGB10_A2:
+        case GL_RGB16F:
+        case GL_RGBA16F:
+        case GL_R11F_G11F_B10F:
+        case GL_RGB32F:
+        case GL_RGBA32F:
+            return true;
+
+        default:
+            return false;
+    }
+}
 
-        *shaderTransformMatrixHandle = glGetUniformLocation(*shaderProgram, "uTransformMatrix");
-        *shaderTextureSamplerHandle = glGetUniformLocation(*shaderProgram, "sYUVTexture");
+static GLint queryInternalFormat(GLenum target, GLenum bindingQuery, GLuint texture) {
+    GLint previousTexture = 0;
+    glGetIntegerv(bindingQuery, &previousTexture);
 
-        if (*shaderTransformMatrixHandle == -1 || *shaderTextureSamplerHandle == -1) {
-            LOGE("Could not locate shader parameter handles (transformMatrix: %i, sampler: %i)", *shaderTransformMatrixHandle, *shaderTextureSamplerHandle);
+    GLint internalFormat = 0;
+    glBindTexture(target, texture);
+    glGetTexLevelParameteriv(target, 0, GL_TEXTURE_INTERNAL_FORMAT, &internalFormat);
+    glBindTexture(target, (GLuint)previousTexture);
 
-            glDeleteProgram(*shaderProgram);
-            *shaderProgram = 0;
-            return false;
-        }
+    hasErrors("glGetTexLevelParameteriv");
+    return internalFormat;
+}
+
+static bool loadMultiviewExtension() {
+    if (s_glFramebufferTextureMultiviewOVR != nullptr) {
+        return true;
     }
 
-    return result;
+    auto extensions = reinterpret_cast<const char*>(glGetString(GL_EXTENSIONS));
+    if (extensions == nullptr || strstr(extensions, "GL_OVR_multiview2") == nullptr) {
+        LOGE("GL_OVR_multiview2 is not supported on this device.");
+        return false;
+    }
+
+    s_glFramebufferTextureMultiviewOVR = reinterpret_cast<PFNGLFRAMEBUFFERTEXTUREMULTIVIEWOVRPROC>(
+            eglGetProcAddress("glFramebufferTextureMultiviewOVR"));
+
+    if (s_glFramebufferTextureMultiviewOVR == nullptr) {
+        LOGE("Could not load glFramebufferTextureMultiviewOVR.");
+        return false;
+    }
+
+    return true;
 }
 
 static bool setupGeometry(GLuint* vertexArrayObj, GLuint* vertexBufferObj) {
@@ -244,16 +591,11 @@ static bool setupGeometry(GLuint* vertexArrayObj, GLuint* vertexBufferObj) {
 
 bool GLES_YUVConverter::registerStaticResourceRef() {
     if (s_staticReferenceHolders > 0) {
+        s_staticReferenceHolders++;
         return true;
     }
 
-    if (!setupShaderProgram(&s_shaderProgram, &s_shaderTransformMatrixHandle, &s_shaderTextureSamplerHandle)) {
-        return false;
-    }
-
     if (!setupGeometry(&s_vertexArrayObj, &s_vertexBufferObj)) {
-        glDeleteProgram(s_shaderProgram);
-        s_shaderProgram = 0;
         return false;
     }
 
@@ -281,114 +623,337 @@ void GLES_YUVConverter::deregisterStaticResourceRef() {
         s_vertexBufferObj = 0;
     }
 
-    if (s_shaderProgram) {
-        glDeleteProgram(s_shaderProgram);
-        s_shaderProgram = 0;
+    for (auto& shaderVariant : s_shaderVariants) {
+        glDeleteProgram(shaderVariant.second.program);
     }
 
+    s_shaderVariants.clear();
     LOGI("Static resources disposed.");
 }
 
+const GLES_YUVConverter::ShaderVariant* GLES_YUVConverter::acquireShaderVariant(uint32_t variant) {
+    auto variantIt = s_shaderVariants.find(variant);
+    if (variantIt != s_shaderVariants.end()) {
+        return &variantIt->second;
+    }
+
+    if ((variant & VARIANT_MULTIVIEW) && !loadMultiviewExtension()) {
+        return nullptr;
+    }
+
+    ShaderVariant shaderVariant = {};
+    if (!buildShaderProgram(variant, &shaderVariant.program)) {
+        return nullptr;
+    }
+
+    int viewCount = (variant & VARIANT_MULTIVIEW) ? 2 : 1;
+    shaderVariant.transformMatrixHandle = glGetUniformLocation(shaderVariant.program, "uTransformMatrix");
+    shaderVariant.cropRectHandle = glGetUniformLocation(shaderVariant.program, "uCropRect");
+    shaderVariant.outputSizeHandle = glGetUniformLocation(shaderVariant.program, "uOutputSize");
+    shaderVariant.sharpnessHandle = glGetUniformLocation(shaderVariant.program, "uSharpness");
+    shaderVariant.sourceRectsHandle = glGetUniformLocation(shaderVariant.program, "uSourceRects");
+    shaderVariant.targetRectsHandle = glGetUniformLocation(shaderVariant.program, "uTargetRects");
+    shaderVariant.reprojectionHandle = glGetUniformLocation(shaderVariant.program, "uReprojection");
+    shaderVariant.textureSamplerHandles[0] = glGetUniformLocation(shaderVariant.program, "sYUVTexture0");
+    shaderVariant.textureSamplerHandles[1] = viewCount > 1 ? glGetUniformLocation(shaderVariant.program, "sYUVTexture1") : -1;
+
+    // uOutputSize is optimized out of the bilinear variants, so it is not required.
+    bool isCropBatch = (variant & VARIANT_CROP_BATCH) != 0;
+    if (shaderVariant.transformMatrixHandle == -1 || (!isCropBatch && shaderVariant.cropRectHandle == -1)
+        || shaderVariant.textureSamplerHandles[0] == -1 || (viewCount > 1 && shaderVariant.textureSamplerHandles[1] == -1)
+        || ((variant & VARIANT_SHARPEN) && shaderVariant.sharpnessHandle == -1)
+        || (isCropBatch && (shaderVariant.sourceRectsHandle == -1 || shaderVariant.targetRectsHandle == -1))
+        || ((variant & VARIANT_REPROJECT) && shaderVariant.reprojectionHandle == -1)) {
+        LOGE("Could not locate shader parameter handles (variant: 0x%x, transformMatrix: %i, cropRect: %i, samplers: %i, %i)",
+             variant, shaderVariant.transformMatrixHandle, shaderVariant.cropRectHandle,
+             shaderVariant.textureSamplerHandles[0], shaderVariant.textureSamplerHandles[1]);
+
+        glDeleteProgram(shaderVariant.program);
+        return nullptr;
+    }
+
+    LOGI("Shader variant 0x%x created.", variant);
+    return &s_shaderVariants.emplace(variant, shaderVariant).first->second;
+}
+
 //endregion
 
-GLES_YUVConverter::GLES_YUVConverter(GLuint renderTexture, GLint width, GLint height) {
+GLES_YUVConverter::GLES_YUVConverter(GLuint renderTexture, GLint width, GLint height, const GLfloat cropRect[4], const GLES_ConverterOptions& options) {
     _renderTexture = renderTexture;
     _width = width; _height = height;
+    _options = options;
+
+    for (int i = 0; i < 9; i++) {
+        _reprojection[i] = (i % 4 == 0) ? 1.0f : 0.0f;
+    }
+
+    for (int i = 0; i < 4; i++) {
+        _cropRect[i] = cropRect[i];
+    }
 
-    _sourceTexture = 0;
+    _targetLayer = 0;
+    _internalFormat = 0;
+    _shaderVariant = nullptr;
     _frameBufferObj = 0;
+    _chromaShaderVariant = nullptr;
+    _chromaFrameBufferObj = 0;
     _disposed = false;
+    _registered = false;
+    _labelled = false;
 }
 
-bool GLES_YUVConverter::initialize(GLuint *createdSourceTexture) {
-    if (!registerStaticResourceRef()) {
+bool GLES_YUVConverter::initialize() {
+    if (_options.layout < LAYOUT_SINGLE || _options.layout > LAYOUT_PLANAR) {
+        LOGE("Unknown layout '%i'", _options.layout);
         return false;
     }
 
-    glGenFramebuffers(1, &_frameBufferObj);
-    glGenTextures(1, &_sourceTexture);
-    if (hasErrors("glGenTextures")) {
+    if (_options.filter < FILTER_BILINEAR || _options.filter > FILTER_BOX) {
+        LOGE("Unknown filter '%i'", _options.filter);
         return false;
     }
 
-    glBindTexture(GL_TEXTURE_EXTERNAL_OES, _sourceTexture);
-    if (hasErrors("glBindTexture")) {
+    if (_options.sharpness < 0.0f || _options.sharpness > 1.0f) {
+        LOGE("Sharpness must be in the range [0, 1], got %f", _options.sharpness);
         return false;
     }
 
-    glTexParameteri(GL_TEXTURE_EXTERNAL_OES, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_EXTERNAL_OES, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_EXTERNAL_OES, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_EXTERNAL_OES, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    if (_options.reproject && _options.layout != LAYOUT_SINGLE) {
+        LOGE("Reprojection is only supported for single image layouts.");
+        return false;
+    }
 
-    glBindTexture(GL_TEXTURE_EXTERNAL_OES, 0);
+    if (_options.layout == LAYOUT_PLANAR && _options.chromaTexture == 0) {
+        LOGE("Planar layouts need a chroma texture.");
+        return false;
+    }
+
+    if (_options.arrayLayers < 0 || (_options.arrayLayers > 0 && _options.layout != LAYOUT_SINGLE)) {
+        LOGE("Texture array layers (%i) are only supported for single image layouts.", _options.arrayLayers);
+        return false;
+    }
+
+    if (!registerStaticResourceRef()) {
+        return false;
+    }
+
+    _registered = true;
+
+    _internalFormat = _options.layout == LAYOUT_MULTIVIEW || _options.arrayLayers > 0
+            ? queryInternalFormat(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_BINDING_2D_ARRAY, _renderTexture)
+            : queryInternalFormat(GL_TEXTURE_2D, GL_TEXTURE_BINDING_2D, _renderTexture);
+    _options.highPrecision = _options.highPrecision || isHighPrecisionFormat(_internalFormat);
+
+    // The reference is released by dispose(), which the caller runs on failure.
+    uint32_t variant = (_options.layout == LAYOUT_MULTIVIEW ? VARIANT_MULTIVIEW : 0)
+            | (_options.layout == LAYOUT_CROP_BATCH ? VARIANT_CROP_BATCH : 0)
+            | ((uint32_t)_options.filter << VARIANT_FILTER_SHIFT)
+            | (_options.sharpness > 0.0f ? VARIANT_SHARPEN : 0)
+            | (_options.reproject ? VARIANT_REPROJECT : 0)
+            | (_options.bt2020 ? VARIANT_BT2020 : 0)
+            | (_options.highPrecision ? VARIANT_HIGHP : 0);
+
+    // Chroma is not sharpened, as sharpening only acts on luma.
+    bool isPlanar = _options.layout == LAYOUT_PLANAR;
+    _shaderVariant = acquireShaderVariant(isPlanar ? variant | VARIANT_PLANE_LUMA : variant);
+    if (_shaderVariant == nullptr) {
+        return false;
+    }
+
+    if (isPlanar) {
+        _chromaShaderVariant = acquireShaderVariant((variant & ~VARIANT_SHARPEN) | VARIANT_PLANE_CHROMA);
+        if (_chromaShaderVariant == nullptr) {
+            return false;
+        }
+    }
+
+    // Generated names only become framebuffer objects once bound, and debug labels need the objects to exist.
+    glGenFramebuffers(1, &_frameBufferObj);
+    glBindFramebuffer(GL_FRAMEBUFFER, _frameBufferObj);
+    if (isPlanar) {
+        glGenFramebuffers(1, &_chromaFrameBufferObj);
+        glBindFramebuffer(GL_FRAMEBUFFER, _chromaFrameBufferObj);
+    }
+
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    if (hasErrors("glGenFramebuffers")) {
+        return false;
+    }
 
-    *createdSourceTexture = _sourceTexture;
     LOGI("Renderer setup.");
     return true;
 }
 
-bool GLES_YUVConverter::render(ASurfaceTexture *surfaceTexture) const {
-
-    bool result = false;
-    int updateResult;
+void GLES_YUVConverter::setReprojection(const GLfloat homography[9]) {
+    for (int i = 0; i < 9; i++) {
+        _reprojection[i] = homography[i];
+    }
+}
 
-    // REQUIRED to make this work well in Unity with sRGB
-    bool srgbEnabled = glIsEnabled(GL_FRAMEBUFFER_SRGB_EXT);
-    glDisable(GL_FRAMEBUFFER_SRGB_EXT);
+bool GLES_YUVConverter::setTargetLayer(int32_t layer) {
+    int32_t layerCount = _options.arrayLayers > 0 ? _options.arrayLayers : 1;
+    if (layer < 0 || layer >= layerCount) {
+        LOGE("Target layer must be in the range [0, %i), got %i", layerCount, layer);
+        return false;
+    }
 
-    glBindFramebuffer(GL_FRAMEBUFFER, _frameBufferObj);
-    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, _renderTexture, 0);
+    _targetLayer = layer;
+    return true;
+}
 
-    if (hasErrors("glFramebufferTexture2D") || glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
-        LOGE("Could not bind frameBuffer to texture.");
-        goto draw_cleanup;
+bool GLES_YUVConverter::render(const GLES_CameraSource& source) const {
+    if (_options.layout != LAYOUT_SINGLE && _options.layout != LAYOUT_PLANAR) {
+        LOGE("Multiview and crop batch converters cannot render a single image.");
+        return false;
     }
 
-    glViewport(0, 0, _width, _height);
-    if (hasErrors("glViewport")) {
-        goto draw_cleanup;
+    const GLES_CameraSource* sources[] = { &source };
+    return draw(sources, 1, nullptr);
+}
+
+bool GLES_YUVConverter::render(const GLES_CameraSource& left, const GLES_CameraSource& right) const {
+    if (_options.layout != LAYOUT_MULTIVIEW) {
+        LOGE("Cannot render stereo sources without multiview.");
+        return false;
     }
 
-    glUseProgram(s_shaderProgram);
-    if (hasErrors("glUseProgram")) {
-        goto draw_cleanup;
+    const GLES_CameraSource* sources[] = { &left, &right };
+    return draw(sources, 2, nullptr);
+}
+
+bool GLES_YUVConverter::render(const GLES_CameraSource& source, const GLES_CropBatch& batch) const {
+    if (_options.layout != LAYOUT_CROP_BATCH) {
+        LOGE("Cannot render crop batch without crop batch layout.");
+        return false;
     }
 
-    updateResult = ASurfaceTexture_updateTexImage(surfaceTexture);
-    if (updateResult) {
-        LOGE("Could not update surfaceTexture, error: %i", updateResult);
-        goto draw_cleanup;
+    if (batch.count < 0 || batch.count > MAX_CROP_BATCH_SIZE) {
+        LOGE("Crop batch size must be in the range [0, %i], got %i", MAX_CROP_BATCH_SIZE, batch.count);
+        return false;
     }
 
-    float transformMatrix[16];
-    ASurfaceTexture_getTransformMatrix(surfaceTexture, transformMatrix);
+    const GLES_CameraSource* sources[] = { &source };
+    return draw(sources, 1, &batch);
+}
+
+bool GLES_YUVConverter::draw(const GLES_CameraSource* const sources[], int viewCount, const GLES_CropBatch* batch) const {
 
-    glUniformMatrix4fv(s_shaderTransformMatrixHandle, 1, GL_FALSE, transformMatrix);
-    if (hasErrors("glUniformMatrix4fv")) {
-        goto draw_cleanup;
+    GLES_DebugGroup debugGroup("UXRQC YUV Conversion");
+    if (!_labelled && isGLDebugOutputEnabled()) {
+        labelObjects();
     }
 
-    glActiveTexture(GL_TEXTURE0);
-    glBindTexture(GL_TEXTURE_EXTERNAL_OES, _sourceTexture);
-    glUniform1i(s_shaderTextureSamplerHandle, 0);
+    // REQUIRED to make this work well in Unity with sRGB
+    bool srgbEnabled = glIsEnabled(GL_FRAMEBUFFER_SRGB_EXT);
+    glDisable(GL_FRAMEBUFFER_SRGB_EXT);
 
-    glBindVertexArray(s_vertexArrayObj);
-    glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
-    result = !hasErrors("glDrawArrays");
+    bool result = drawPass(*_shaderVariant, _frameBufferObj, _renderTexture, _width, _height, sources, viewCount, batch);
+
+    // Chroma is subsampled like the camera's own 4:2:0 planes, so its pass is a quarter of the luma pass.
+    if (result && _options.layout == LAYOUT_PLANAR) {
+        result = drawPass(*_chromaShaderVariant, _chromaFrameBufferObj, _options.chromaTexture,
+                          (_width + 1) / 2, (_height + 1) / 2, sources, viewCount, nullptr);
+    }
 
-draw_cleanup:
     glBindFramebuffer(GL_FRAMEBUFFER, 0);
     glBindVertexArray(0);
-    glBindTexture(GL_TEXTURE_EXTERNAL_OES, 0);
+
+    for (int i = viewCount - 1; i >= 0; i--) {
+        glActiveTexture(GL_TEXTURE0 + i);
+        glBindTexture(GL_TEXTURE_EXTERNAL_OES, 0);
+    }
 
     if (srgbEnabled) {
         glEnable(GL_FRAMEBUFFER_SRGB_EXT);
     }
 
+    if (isGLDebugOutputEnabled() && hasErrors("draw")) {
+        result = false;
+    }
+
     return result;
 }
 
+// Renders into one texture. State is left bound, draw() resets it after every pass.
+bool GLES_YUVConverter::drawPass(const ShaderVariant& shaderVariant, GLuint frameBufferObj, GLuint texture, GLint width, GLint height,
+                                 const GLES_CameraSource* const sources[], int viewCount, const GLES_CropBatch* batch) const {
+
+    GLfloat transformMatrices[2 * 16];
+
+    glBindFramebuffer(GL_FRAMEBUFFER, frameBufferObj);
+    if (_options.layout == LAYOUT_MULTIVIEW) {
+        s_glFramebufferTextureMultiviewOVR(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, texture, 0, 0, viewCount);
+    } else if (_options.arrayLayers > 0) {
+        glFramebufferTextureLayer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, texture, 0, _targetLayer);
+    } else {
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture, 0);
+    }
+
+    if (hasRenderErrors("glFramebufferTexture") || glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+        LOGE("Could not bind frameBuffer to texture.");
+        return false;
+    }
+
+    glViewport(0, 0, width, height);
+    if (hasRenderErrors("glViewport")) {
+        return false;
+    }
+
+    glUseProgram(shaderVariant.program);
+    if (hasRenderErrors("glUseProgram")) {
+        return false;
+    }
+
+    for (int i = 0; i < viewCount; i++) {
+        memcpy(transformMatrices + i * 16, sources[i]->transformMatrix(), 16 * sizeof(GLfloat));
+    }
+
+    glUniformMatrix4fv(shaderVariant.transformMatrixHandle, viewCount, GL_FALSE, transformMatrices);
+    glUniform4fv(shaderVariant.cropRectHandle, 1, _cropRect);
+    glUniform2f(shaderVariant.outputSizeHandle, (GLfloat)width, (GLfloat)height);
+    glUniform1f(shaderVariant.sharpnessHandle, _options.sharpness);
+
+    if (_options.reproject) {
+        glUniformMatrix3fv(shaderVariant.reprojectionHandle, 1, GL_FALSE, _reprojection);
+    }
+
+    if (batch != nullptr) {
+        glUniform4fv(shaderVariant.sourceRectsHandle, batch->count, &batch->sourceRects[0][0]);
+        glUniform4fv(shaderVariant.targetRectsHandle, batch->count, &batch->targetRects[0][0]);
+    }
+    if (hasRenderErrors("glUniform")) {
+        return false;
+    }
+
+    for (int i = 0; i < viewCount; i++) {
+        glActiveTexture(GL_TEXTURE0 + i);
+        glBindTexture(GL_TEXTURE_EXTERNAL_OES, sources[i]->texture());
+        glUniform1i(shaderVariant.textureSamplerHandles[i], i);
+    }
+
+    glBindVertexArray(s_vertexArrayObj);
+    if (batch != nullptr) {
+        glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, batch->count);
+    } else {
+        glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+    }
+
+    return !hasRenderErrors("glDrawArrays");
+}
+
+void GLES_YUVConverter::labelObjects() const {
+    labelGLObject(GL_FRAMEBUFFER, _frameBufferObj, "UXRQC Converter Framebuffer");
+    labelGLObject(GL_PROGRAM_KHR, _shaderVariant->program, "UXRQC Converter Program");
+    labelGLObject(GL_VERTEX_ARRAY_KHR, s_vertexArrayObj, "UXRQC Converter Quad");
+    labelGLObject(GL_BUFFER_KHR, s_vertexBufferObj, "UXRQC Converter Quad");
+
+    if (_options.layout == LAYOUT_PLANAR) {
+        labelGLObject(GL_FRAMEBUFFER, _chromaFrameBufferObj, "UXRQC Converter Chroma Framebuffer");
+        labelGLObject(GL_PROGRAM_KHR, _chromaShaderVariant->program, "UXRQC Converter Chroma Program");
+    }
+    _labelled = true;
+}
+
 void GLES_YUVConverter::dispose() {
     if (_disposed) {
         return;
@@ -399,10 +964,15 @@ void GLES_YUVConverter::dispose() {
         glDeleteFramebuffers(1, &_frameBufferObj);
     }
 
-    if (_sourceTexture) {
-        glDeleteTextures(1, &_sourceTexture);
+    if (_chromaFrameBufferObj) {
+        glDeleteFramebuffers(1, &_chromaFrameBufferObj);
+    }
+
+    // Validation failures return before the reference is taken, and must not release another converter's.
+    if (_registered) {
+        _registered = false;
+        deregisterStaticResourceRef();
     }
 
-    deregisterStaticResourceRef();
     LOGI("Renderer disposed.");
 }
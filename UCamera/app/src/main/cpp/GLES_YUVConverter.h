@@ -16,36 +16,136 @@
 #define UXR_QUESTCAMERA_GLES_YUVCONVERTER_H
 
 #include <GLES3/gl3.h>
-#include <android/surface_texture.h>
+#include <map>
+#include "GLES_CameraSource.h"
+
+#define FILTER_BILINEAR  0
+#define FILTER_BICUBIC   1
+#define FILTER_LANCZOS   2
+#define FILTER_BOX       3
+
+#define LAYOUT_SINGLE       0
+#define LAYOUT_MULTIVIEW    1
+#define LAYOUT_CROP_BATCH   2
+#define LAYOUT_PLANAR       3
+
+#define MAX_CROP_BATCH_SIZE 16
+
+// Regions of a crop batch, as (x, y, width, height) in UV space. Crop i is read from
+// sourceRects[i] of the camera image and written to targetRects[i] of the output texture.
+struct GLES_CropBatch {
+    int32_t count;
+    GLfloat sourceRects[MAX_CROP_BATCH_SIZE][4];
+    GLfloat targetRects[MAX_CROP_BATCH_SIZE][4];
+};
+
+struct GLES_ConverterOptions {
+    // One of the LAYOUT_* values. For LAYOUT_MULTIVIEW, the render texture must be a 2-layer GL_TEXTURE_2D_ARRAY,
+    // rendered with OVR_multiview2. For LAYOUT_CROP_BATCH, the crop rect is ignored and regions are given per render.
+    // For LAYOUT_PLANAR, the render texture receives unconverted luma and chromaTexture receives unconverted chroma.
+    int32_t layout = LAYOUT_SINGLE;
+
+    // For LAYOUT_PLANAR, a two channel texture with half the render texture's size (rounded up), like GL_RG8.
+    GLuint chromaTexture = 0;
+
+    // For LAYOUT_SINGLE, the layer count of a GL_TEXTURE_2D_ARRAY render texture, which is rendered one layer
+    // at a time as selected by setTargetLayer(). 0 for a GL_TEXTURE_2D render texture.
+    int32_t arrayLayers = 0;
+
+    // One of the FILTER_* values, used to resample the camera image to the output size.
+    int32_t filter = FILTER_BILINEAR;
+
+    // In [0, 1], enables contrast-adaptive sharpening of the output. 0 disables it.
+    GLfloat sharpness = 0.0f;
+
+    // Warps the camera image by the homography given to setReprojection(). Only supported by LAYOUT_SINGLE.
+    bool reproject = false;
+
+    // Converts with the narrow range BT.2020 matrix of 10-bit (HLG10) camera streams, instead of full range BT.601.
+    bool bt2020 = false;
+
+    // Filters and writes in highp, for render textures with more than 8 bits per channel.
+    // Enabled by initialize() from the render texture's format.
+    bool highPrecision = false;
+};
 
 class GLES_YUVConverter {
 
 public:
-    GLES_YUVConverter(GLuint renderTexture, GLint width, GLint height);
+    GLES_YUVConverter(GLuint renderTexture, GLint width, GLint height, const GLfloat cropRect[4], const GLES_ConverterOptions& options = {});
+
+    bool initialize();
+    bool render(const GLES_CameraSource& source) const;
+
+    // Renders left into layer 0 and right into layer 1 of a multiview converter's texture array in one draw.
+    bool render(const GLES_CameraSource& left, const GLES_CameraSource& right) const;
+
+    // Renders every crop of the batch into a crop batch converter's texture with one instanced draw.
+    bool render(const GLES_CameraSource& source, const GLES_CropBatch& batch) const;
+
+    // Sets the column-major homography applied to camera UVs by reprojecting converters, before the SurfaceTexture transform.
+    void setReprojection(const GLfloat homography[9]);
+
+    // Sets the layer of a texture array render texture rendered by the following renders.
+    bool setTargetLayer(int32_t layer);
+
+    // The render texture's internal format, queried by initialize().
+    GLint internalFormat() const { return _internalFormat; }
 
-    bool initialize(GLuint* createdSourceTexture);
-    bool render(ASurfaceTexture* surfaceTexture) const;
     void dispose();
 
 private:
+    // A compiled permutation of the conversion shaders, selected by a bitmask of VARIANT_* flags.
+    struct ShaderVariant {
+        GLuint program;
+        GLint transformMatrixHandle;
+        GLint cropRectHandle;
+        GLint outputSizeHandle;
+        GLint sharpnessHandle;
+        GLint sourceRectsHandle;
+        GLint targetRectsHandle;
+        GLint reprojectionHandle;
+        GLint textureSamplerHandles[2];
+    };
+
     GLuint _renderTexture;
-    GLuint _sourceTexture;
     GLuint _frameBufferObj;
 
     GLint _width; GLint _height;
+    GLfloat _cropRect[4];
+    GLES_ConverterOptions _options;
+    GLfloat _reprojection[9];
+    int32_t _targetLayer;
+    GLint _internalFormat;
     bool _disposed;
 
+    // Set once initialize() holds a reference to the static resources, which dispose() then releases.
+    bool _registered;
+
+    // Debug output can be enabled after the converter is created, so objects are labelled on first render with it.
+    mutable bool _labelled;
+
+    const ShaderVariant* _shaderVariant;
+
+    // Only created for LAYOUT_PLANAR, which renders chroma in a second pass.
+    const ShaderVariant* _chromaShaderVariant;
+    GLuint _chromaFrameBufferObj;
+
+    bool draw(const GLES_CameraSource* const sources[], int viewCount, const GLES_CropBatch* batch) const;
+    bool drawPass(const ShaderVariant& shaderVariant, GLuint frameBufferObj, GLuint texture, GLint width, GLint height,
+                  const GLES_CameraSource* const sources[], int viewCount, const GLES_CropBatch* batch) const;
+    void labelObjects() const;
+
     static uint8_t s_staticReferenceHolders;
 
-    static GLuint s_shaderProgram;
-    static GLint s_shaderTransformMatrixHandle;
-    static GLint s_shaderTextureSamplerHandle;
+    static std::map<uint32_t, ShaderVariant> s_shaderVariants;
 
     static GLuint s_vertexBufferObj;
     static GLuint s_vertexArrayObj;
 
     static bool registerStaticResourceRef();
     static void deregisterStaticResourceRef();
+    static const ShaderVariant* acquireShaderVariant(uint32_t variant);
 
 };
 
@@ -0,0 +1,361 @@
+// Copyright 2026 URAV ADVANCED LEARNING SYSTEMS PRIVATE LIMITED
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "NativeCamera.h"
+#include "CameraListenerGate.h"
+#include "NativeLog.h"
+#include <atomic>
+#include <memory>
+#include <camera/NdkCameraManager.h>
+#include <camera/NdkCameraDevice.h>
+#include <camera/NdkCameraCaptureSession.h>
+#include <camera/NdkCaptureRequest.h>
+#include <camera/NdkCameraMetadata.h>
+#include <media/NdkImageReader.h>
+
+#define TAG "UXRQC.NDKCamera"
+#define LOGI(...) NATIVE_LOG(ANDROID_LOG_INFO,  TAG, __VA_ARGS__)
+#define LOGE(...) NATIVE_LOG(ANDROID_LOG_ERROR, TAG, __VA_ARGS__)
+
+using namespace std;
+
+// Deleting an AImageReader invalidates its images, so the reader lives until the last delivered image is released.
+struct NDK_ImageReader {
+    AImageReader* reader;
+
+    ~NDK_ImageReader() {
+        AImageReader_delete(reader);
+    }
+};
+
+struct NDK_ImageHandle {
+    AImage* image;
+    shared_ptr<NDK_ImageReader> reader;
+};
+
+static int64_t getMetadataInt64(const ACameraMetadata* metadata, uint32_t tag) {
+    ACameraMetadata_const_entry entry = {};
+    if (ACameraMetadata_getConstEntry(metadata, tag, &entry) != ACAMERA_OK || entry.count == 0) {
+        return -1;
+    }
+
+    return entry.data.i64[0];
+}
+
+static int32_t getMetadataInt32(const ACameraMetadata* metadata, uint32_t tag) {
+    ACameraMetadata_const_entry entry = {};
+    if (ACameraMetadata_getConstEntry(metadata, tag, &entry) != ACAMERA_OK || entry.count == 0) {
+        return -1;
+    }
+
+    return entry.data.i32[0];
+}
+
+// A camera stream opened with ACameraManager. The NDK calls back on its own threads, so every callback goes
+// through _listenerGate, which stop() closes before closing anything.
+class NDK_Camera : public NativeCamera {
+
+public:
+    NDK_Camera() {
+        _manager = nullptr;
+        _device = nullptr;
+        _session = nullptr;
+        _outputs = nullptr;
+        _windowOutput = nullptr;
+        _readerOutput = nullptr;
+        _request = nullptr;
+        _windowTarget = nullptr;
+        _readerTarget = nullptr;
+        _readerWindow = nullptr;
+        _completedCaptures = 0;
+    }
+
+    ~NDK_Camera() override {
+        stop();
+    }
+
+    bool start(const CameraStreamConfig& config, CameraListener* listener) override;
+    void stop() override;
+
+    void releaseImage(void* handle) override {
+        auto imageHandle = static_cast<NDK_ImageHandle*>(handle);
+        AImage_delete(imageHandle->image);
+        delete imageHandle;
+    }
+
+private:
+    bool createReader(const CameraStreamConfig& config);
+    bool addOutput(ANativeWindow* window, ACaptureSessionOutput** output, ACameraOutputTarget** target);
+    void notifyState(int32_t state, int32_t error);
+
+    static void onDeviceDisconnected(void* context, ACameraDevice*);
+    static void onDeviceError(void* context, ACameraDevice*, int error);
+    static void onSessionActive(void* context, ACameraCaptureSession*);
+    static void onSessionClosed(void*, ACameraCaptureSession*) { }
+    static void onSessionReady(void*, ACameraCaptureSession*) { }
+    static void onCaptureCompleted(void* context, ACameraCaptureSession*, ACaptureRequest*, const ACameraMetadata* result);
+    static void onCaptureFailed(void*, ACameraCaptureSession*, ACaptureRequest*, ACameraCaptureFailure*) { }
+    static void onImageAvailable(void* context, AImageReader* reader);
+
+    ACameraManager* _manager;
+    ACameraDevice* _device;
+    ACameraCaptureSession* _session;
+    ACaptureSessionOutputContainer* _outputs;
+    ACaptureSessionOutput* _windowOutput;
+    ACaptureSessionOutput* _readerOutput;
+    ACaptureRequest* _request;
+    ACameraOutputTarget* _windowTarget;
+    ACameraOutputTarget* _readerTarget;
+
+    shared_ptr<NDK_ImageReader> _reader;
+    ANativeWindow* _readerWindow;
+
+    ACameraDevice_StateCallbacks _deviceCallbacks;
+    ACameraCaptureSession_stateCallbacks _sessionCallbacks;
+    ACameraCaptureSession_captureCallbacks _captureCallbacks;
+    AImageReader_ImageListener _imageListener;
+
+    CameraListenerGate _listenerGate;
+
+    // The NDK only reports frame numbers from API 33, so completed captures are counted instead.
+    atomic<int64_t> _completedCaptures;
+};
+
+bool NDK_Camera::createReader(const CameraStreamConfig& config) {
+    // One extra image lets the reader acquire the next frame while the listener holds all of its images.
+    AImageReader* reader = nullptr;
+    if (AImageReader_new(config.width, config.height, AIMAGE_FORMAT_YUV_420_888, config.maxCpuImages + 1, &reader) != AMEDIA_OK) {
+        LOGE("Could not create image reader.");
+        return false;
+    }
+
+    _reader = shared_ptr<NDK_ImageReader>(new NDK_ImageReader { reader });
+
+    _imageListener = { this, onImageAvailable };
+    if (AImageReader_setImageListener(reader, &_imageListener) != AMEDIA_OK
+        || AImageReader_getWindow(reader, &_readerWindow) != AMEDIA_OK) {
+        LOGE("Could not configure image reader.");
+        return false;
+    }
+
+    return true;
+}
+
+bool NDK_Camera::addOutput(ANativeWindow* window, ACaptureSessionOutput** output, ACameraOutputTarget** target) {
+    if (ACaptureSessionOutput_create(window, output) != ACAMERA_OK
+        || ACaptureSessionOutputContainer_add(_outputs, *output) != ACAMERA_OK
+        || ACameraOutputTarget_create(window, target) != ACAMERA_OK
+        || ACaptureRequest_addTarget(_request, *target) != ACAMERA_OK) {
+        LOGE("Could not add output to capture session.");
+        return false;
+    }
+
+    return true;
+}
+
+bool NDK_Camera::start(const CameraStreamConfig& config, CameraListener* listener) {
+    _listenerGate.open(listener);
+
+    _deviceCallbacks = { this, onDeviceDisconnected, onDeviceError };
+    _sessionCallbacks = { this, onSessionClosed, onSessionReady, onSessionActive };
+
+    _captureCallbacks = {};
+    _captureCallbacks.context = this;
+    _captureCallbacks.onCaptureCompleted = onCaptureCompleted;
+    _captureCallbacks.onCaptureFailed = onCaptureFailed;
+
+    notifyState(CAMERASTATE_OPENING, 0);
+
+    _manager = ACameraManager_create();
+    camera_status_t status = ACameraManager_openCamera(_manager, config.cameraId, &_deviceCallbacks, &_device);
+    if (status != ACAMERA_OK) {
+        LOGE("Could not open camera %s, error: %i", config.cameraId, status);
+        notifyState(CAMERASTATE_ERRED, status);
+        return false;
+    }
+
+    if (config.maxCpuImages > 0 && !createReader(config)) {
+        notifyState(CAMERASTATE_ERRED, 0);
+        return false;
+    }
+
+    if (ACaptureSessionOutputContainer_create(&_outputs) != ACAMERA_OK
+        || ACameraDevice_createCaptureRequest(_device, (ACameraDevice_request_template)config.captureTemplate, &_request) != ACAMERA_OK) {
+        LOGE("Could not create capture request.");
+        notifyState(CAMERASTATE_ERRED, 0);
+        return false;
+    }
+
+    if ((config.window != nullptr && !addOutput(config.window, &_windowOutput, &_windowTarget))
+        || (_readerWindow != nullptr && !addOutput(_readerWindow, &_readerOutput, &_readerTarget))) {
+        notifyState(CAMERASTATE_ERRED, 0);
+        return false;
+    }
+
+    status = ACameraDevice_createCaptureSession(_device, _outputs, &_sessionCallbacks, &_session);
+    if (status != ACAMERA_OK) {
+        LOGE("Could not create capture session, error: %i", status);
+        notifyState(CAMERASTATE_ERRED, status);
+        return false;
+    }
+
+    status = ACameraCaptureSession_setRepeatingRequest(_session, &_captureCallbacks, 1, &_request, nullptr);
+    if (status != ACAMERA_OK) {
+        LOGE("Could not set repeating request, error: %i", status);
+        notifyState(CAMERASTATE_ERRED, status);
+        return false;
+    }
+
+    LOGI("Camera %s started.", config.cameraId);
+    return true;
+}
+
+void NDK_Camera::stop() {
+    if (!_listenerGate.close() && _manager == nullptr) {
+        return;
+    }
+
+    if (_session != nullptr) {
+        ACameraCaptureSession_stopRepeating(_session);
+        ACameraCaptureSession_close(_session);
+        _session = nullptr;
+    }
+
+    if (_device != nullptr) {
+        ACameraDevice_close(_device);
+        _device = nullptr;
+    }
+
+    if (_request != nullptr) {
+        ACaptureRequest_free(_request);
+        _request = nullptr;
+    }
+
+    ACameraOutputTarget_free(_windowTarget);
+    ACameraOutputTarget_free(_readerTarget);
+    ACaptureSessionOutput_free(_windowOutput);
+    ACaptureSessionOutput_free(_readerOutput);
+    _windowTarget = _readerTarget = nullptr;
+    _windowOutput = _readerOutput = nullptr;
+
+    if (_outputs != nullptr) {
+        ACaptureSessionOutputContainer_free(_outputs);
+        _outputs = nullptr;
+    }
+
+    if (_reader != nullptr) {
+        AImageReader_setImageListener(_reader->reader, nullptr);
+        _reader = nullptr;
+        _readerWindow = nullptr;
+    }
+
+    if (_manager != nullptr) {
+        ACameraManager_delete(_manager);
+        _manager = nullptr;
+    }
+
+    LOGI("Camera stopped.");
+}
+
+void NDK_Camera::notifyState(int32_t state, int32_t error) {
+    CameraListener* listener = _listenerGate.begin();
+    if (listener != nullptr) {
+        listener->onCameraState(state, error);
+        _listenerGate.end();
+    }
+}
+
+void NDK_Camera::onDeviceDisconnected(void* context, ACameraDevice*) {
+    LOGE("Camera disconnected.");
+    static_cast<NDK_Camera*>(context)->notifyState(CAMERASTATE_ERRED, 0);
+}
+
+void NDK_Camera::onDeviceError(void* context, ACameraDevice*, int error) {
+    LOGE("Camera erred with: %i", error);
+    static_cast<NDK_Camera*>(context)->notifyState(CAMERASTATE_ERRED, error);
+}
+
+void NDK_Camera::onSessionActive(void* context, ACameraCaptureSession*) {
+    static_cast<NDK_Camera*>(context)->notifyState(CAMERASTATE_STREAMING, 0);
+}
+
+void NDK_Camera::onCaptureCompleted(void* context, ACameraCaptureSession*, ACaptureRequest*, const ACameraMetadata* result) {
+    auto camera = static_cast<NDK_Camera*>(context);
+
+    int64_t sensorTimestamp = getMetadataInt64(result, ACAMERA_SENSOR_TIMESTAMP);
+    if (sensorTimestamp < 0) {
+        return;
+    }
+
+    CaptureMetadata metadata = {
+            camera->_completedCaptures.fetch_add(1),
+            getMetadataInt64(result, ACAMERA_SENSOR_EXPOSURE_TIME),
+            getMetadataInt64(result, ACAMERA_SENSOR_FRAME_DURATION),
+            getMetadataInt64(result, ACAMERA_SENSOR_ROLLING_SHUTTER_SKEW),
+            getMetadataInt32(result, ACAMERA_SENSOR_SENSITIVITY)
+    };
+
+    CameraListener* listener = camera->_listenerGate.begin();
+    if (listener != nullptr) {
+        listener->onCaptureResult(sensorTimestamp, metadata);
+        camera->_listenerGate.end();
+    }
+}
+
+void NDK_Camera::onImageAvailable(void* context, AImageReader* reader) {
+    auto camera = static_cast<NDK_Camera*>(context);
+
+    CameraListener* listener = camera->_listenerGate.begin();
+    if (listener == nullptr) {
+        return;
+    }
+
+    // Fails while the listener holds every image, which drops the frame.
+    AImage* image = nullptr;
+    if (AImageReader_acquireNextImage(reader, &image) != AMEDIA_OK) {
+        camera->_listenerGate.end();
+        return;
+    }
+
+    CameraImage cameraImage = {};
+    AImage_getWidth(image, &cameraImage.width);
+    AImage_getHeight(image, &cameraImage.height);
+    AImage_getTimestamp(image, &cameraImage.timestamp);
+    AImage_getNumberOfPlanes(image, &cameraImage.planeCount);
+
+    if (cameraImage.planeCount > CAMERA_MAX_PLANES) {
+        cameraImage.planeCount = CAMERA_MAX_PLANES;
+    }
+
+    for (int32_t i = 0; i < cameraImage.planeCount; i++) {
+        CameraImagePlane& plane = cameraImage.planes[i];
+
+        uint8_t* data = nullptr;
+        int size = 0;
+        AImage_getPlaneData(image, i, &data, &size);
+        AImage_getPlaneRowStride(image, i, &plane.rowStride);
+        AImage_getPlanePixelStride(image, i, &plane.pixelStride);
+
+        plane.data = data;
+        plane.size = size;
+    }
+
+    cameraImage.handle = new NDK_ImageHandle { image, camera->_reader };
+    listener->onCameraImage(cameraImage);
+    camera->_listenerGate.end();
+}
+
+NativeCamera* createNDKCamera() {
+    return new NDK_Camera();
+}
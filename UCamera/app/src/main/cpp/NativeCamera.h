@@ -0,0 +1,97 @@
+// Copyright 2026 URAV ADVANCED LEARNING SYSTEMS PRIVATE LIMITED
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef UXR_QUESTCAMERA_NATIVECAMERA_H
+#define UXR_QUESTCAMERA_NATIVECAMERA_H
+
+#include <cstdint>
+#include "CaptureMetadata.h"
+
+struct ANativeWindow;
+
+// States of a native camera stream. Mirrored in C#.
+#define CAMERASTATE_CLOSED      0
+#define CAMERASTATE_OPENING     1
+#define CAMERASTATE_STREAMING   2
+#define CAMERASTATE_ERRED       3
+
+#define CAMERA_MAX_PLANES       3
+
+struct CameraImagePlane {
+    const uint8_t* data;
+    int32_t size;
+    int32_t rowStride;
+    int32_t pixelStride;
+};
+
+// A YUV_420_888 image delivered to the CPU. Valid until handle is returned with NativeCamera::releaseImage.
+struct CameraImage {
+    void* handle;
+    int32_t width;
+    int32_t height;
+    int64_t timestamp;
+
+    CameraImagePlane planes[CAMERA_MAX_PLANES];
+    int32_t planeCount;
+};
+
+struct CameraStreamConfig {
+    const char* cameraId;
+    int32_t width;
+    int32_t height;
+    int32_t captureTemplate;
+
+    // GPU output of the stream, like a GLES source's image reader, or nullptr.
+    ANativeWindow* window;
+
+    // The number of CPU images the listener can hold at once, or 0 if no CPU images are needed.
+    int32_t maxCpuImages;
+};
+
+// Receives a camera's state, images and capture results, on the camera's own threads.
+class CameraListener {
+
+public:
+    virtual ~CameraListener() = default;
+
+    virtual void onCameraState(int32_t state, int32_t error) = 0;
+
+    // Every image must be released exactly once, from any thread.
+    virtual void onCameraImage(const CameraImage& image) = 0;
+
+    virtual void onCaptureResult(int64_t sensorTimestamp, const CaptureMetadata& metadata) = 0;
+};
+
+// The camera layer under native capture sessions. Implemented with the NDK's Camera2 API on devices, and
+// can be implemented by a fake camera which drives the same session code without camera hardware.
+class NativeCamera {
+
+public:
+    virtual ~NativeCamera() = default;
+
+    // Opens the camera and starts a repeating request for the configured outputs. Completion and
+    // errors are reported through the listener, which must outlive the stream.
+    virtual bool start(const CameraStreamConfig& config, CameraListener* listener) = 0;
+
+    // Stops the stream and closes the camera. No listener callbacks are made once this returns,
+    // but images already delivered stay valid until released.
+    virtual void stop() = 0;
+
+    virtual void releaseImage(void* handle) = 0;
+};
+
+NativeCamera* createNDKCamera();
+
+
+#endif //UXR_QUESTCAMERA_NATIVECAMERA_H
@@ -0,0 +1,259 @@
+// Copyright 2026 URAV ADVANCED LEARNING SYSTEMS PRIVATE LIMITED
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <jni.h>
+
+#include "CaptureBufferRing.h"
+#include "NativeCaptureSession.h"
+#include "NativeLog.h"
+#include "IUnityInterface.h"
+
+#define TAG "UXRQC.NativeCapMgr"
+#define LOGI(...) NATIVE_LOG(ANDROID_LOG_INFO,  TAG, __VA_ARGS__)
+#define LOGE(...) NATIVE_LOG(ANDROID_LOG_ERROR, TAG, __VA_ARGS__)
+
+using namespace std;
+
+struct NativeSessionEntry {
+    shared_ptr<NativeCaptureSession> session;
+
+    // The GLES job whose source the session renders into, or 0.
+    uint32_t jobId;
+};
+
+static map<uint32_t, NativeSessionEntry> g_nativeSessions;
+static mutex g_nativeSessionsMutex;
+static atomic<uint32_t> g_nextNativeSessionId(1);
+
+static map<uint32_t, shared_ptr<CaptureBufferRing>> g_captureRings;
+static mutex g_captureRingsMutex;
+static atomic<uint32_t> g_nextCaptureRingId(1);
+
+static shared_ptr<CaptureBufferRing> findCaptureRing(uint32_t ringId) {
+    lock_guard<mutex> lock(g_captureRingsMutex);
+    auto ringIt = g_captureRings.find(ringId);
+    return ringIt != g_captureRings.end() ? ringIt->second : nullptr;
+}
+
+//region Kotlin interface
+
+extern "C"
+JNIEXPORT jint JNICALL
+Java_com_uralstech_uxr_questcamera_OnDemandCaptureSessionManager_reserveNativeCapture(JNIEnv *,
+                                                                                    jobject,
+                                                                                    jint ringId) {
+
+    shared_ptr<CaptureBufferRing> ring = findCaptureRing(ringId);
+    return ring != nullptr ? ring->reserve() : -1;
+}
+
+extern "C"
+JNIEXPORT void JNICALL
+Java_com_uralstech_uxr_questcamera_OnDemandCaptureSessionManager_armNativeCapture(JNIEnv *,
+                                                                                jobject,
+                                                                                jint ringId,
+                                                                                jint slot,
+                                                                                jint sequenceId) {
+
+    shared_ptr<CaptureBufferRing> ring = findCaptureRing(ringId);
+    if (ring != nullptr) {
+        ring->arm(slot, sequenceId);
+    }
+}
+
+extern "C"
+JNIEXPORT void JNICALL
+Java_com_uralstech_uxr_questcamera_OnDemandCaptureSessionManager_cancelNativeCapture(JNIEnv *,
+                                                                                   jobject,
+                                                                                   jint ringId,
+                                                                                   jint slot,
+                                                                                   jint sequenceId) {
+
+    shared_ptr<CaptureBufferRing> ring = findCaptureRing(ringId);
+    if (ring != nullptr) {
+        ring->cancel(slot, sequenceId);
+    }
+}
+
+// Called on the session's image thread with the image's direct buffers, which are only valid during the call.
+extern "C"
+JNIEXPORT jboolean JNICALL
+Java_com_uralstech_uxr_questcamera_OnDemandCaptureSessionManager_fillNativeCapture(JNIEnv *env,
+                                                                                 jobject,
+                                                                                 jint ringId,
+                                                                                 jobject yBuffer,
+                                                                                 jobject uBuffer,
+                                                                                 jobject vBuffer,
+                                                                                 jint yRowStride,
+                                                                                 jint uvRowStride,
+                                                                                 jint uvPixelStride,
+                                                                                 jint width,
+                                                                                 jint height,
+                                                                                 jlong timestamp) {
+
+    shared_ptr<CaptureBufferRing> ring = findCaptureRing(ringId);
+    if (ring == nullptr) {
+        return false;
+    }
+
+    auto yPlane = static_cast<const uint8_t*>(env->GetDirectBufferAddress(yBuffer));
+    auto uPlane = static_cast<const uint8_t*>(env->GetDirectBufferAddress(uBuffer));
+    auto vPlane = static_cast<const uint8_t*>(env->GetDirectBufferAddress(vBuffer));
+    if (yPlane == nullptr || uPlane == nullptr || vPlane == nullptr) {
+        LOGE("Image planes are not direct buffers.");
+        return false;
+    }
+
+    return ring->fill(yPlane, (size_t)env->GetDirectBufferCapacity(yBuffer),
+                      uPlane, vPlane, (size_t)env->GetDirectBufferCapacity(uBuffer),
+                      yRowStride, uvRowStride, uvPixelStride, width, height, timestamp);
+}
+
+//endregion
+
+//region Unity interface
+
+// Creates a ring of preallocated buffers for on-demand captures. Returns its ID, or 0 if it could not be created.
+extern "C" uint32_t UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API
+createCaptureBufferRing(int32_t width, int32_t height, uint32_t slotCount, CaptureBufferCallback onCapture) {
+    if (onCapture == nullptr) {
+        LOGE("Capture rings need a callback.");
+        return 0;
+    }
+
+    uint32_t ringId = g_nextCaptureRingId.fetch_add(1);
+    auto ring = make_shared<CaptureBufferRing>(ringId, width, height, slotCount, onCapture);
+    if (!ring->initialize()) {
+        return 0;
+    }
+
+    lock_guard<mutex> lock(g_captureRingsMutex);
+    g_captureRings[ringId] = ring;
+    return ringId;
+}
+
+extern "C" bool UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API
+releaseCaptureBuffer(uint32_t ringId, int32_t slot) {
+    shared_ptr<CaptureBufferRing> ring = findCaptureRing(ringId);
+    return ring != nullptr && ring->release(slot);
+}
+
+extern "C" bool UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API
+getCaptureBufferRingStats(uint32_t ringId, CaptureBufferStats* stats) {
+    shared_ptr<CaptureBufferRing> ring = findCaptureRing(ringId);
+    if (ring == nullptr) {
+        return false;
+    }
+
+    ring->stats(stats);
+    return true;
+}
+
+// The buffers are freed once a capture being filled has finished, so held images must be released before this is called.
+extern "C" void UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API
+destroyCaptureBufferRing(uint32_t ringId) {
+    lock_guard<mutex> lock(g_captureRingsMutex);
+    g_captureRings.erase(ringId);
+}
+
+// Opens a camera with the NDK's Camera2 API. If glesJobId is not 0, the camera renders into the source of that job,
+// which must own its source and must not be bound to a SurfaceTexture. Returns the session's ID, or 0 if it could not be opened.
+extern "C" uint32_t UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API
+openNativeCameraSession(const char* cameraId, int32_t width, int32_t height, int32_t captureTemplate,
+                        uint32_t glesJobId, bool publishCpuFrames) {
+
+    if (cameraId == nullptr || (glesJobId == 0 && !publishCpuFrames)) {
+        LOGE("Native sessions need a camera ID and at least one output.");
+        return 0;
+    }
+
+    shared_ptr<GLES_CameraSource> source;
+    ANativeWindow* window = nullptr;
+    if (glesJobId != 0) {
+        source = findOwnedJobSource(glesJobId);
+        if (source == nullptr) {
+            LOGE("Unknown, disposing or subscribing job ID provided.");
+            return 0;
+        }
+
+        window = source->bindImageReader(width, height);
+        if (window == nullptr) {
+            return 0;
+        }
+    }
+
+    uint32_t sessionId = g_nextNativeSessionId.fetch_add(1);
+    auto session = make_shared<NativeCaptureSession>(sessionId, shared_ptr<NativeCamera>(createNDKCamera()), source, publishCpuFrames);
+
+    // Registered first, as the camera reports its state from its own threads once started.
+    {
+        lock_guard<mutex> lock(g_nativeSessionsMutex);
+        g_nativeSessions[sessionId] = { session, glesJobId };
+    }
+
+    if (!session->start(cameraId, width, height, captureTemplate, window)) {
+        LOGE("Could not start native camera session.");
+        session->stop();
+
+        if (source != nullptr) {
+            source->unbindImageReader();
+        }
+
+        lock_guard<mutex> lock(g_nativeSessionsMutex);
+        g_nativeSessions.erase(sessionId);
+        return 0;
+    }
+
+    LOGI("Native camera session %u opened.", sessionId);
+    return sessionId;
+}
+
+// Returns the CAMERASTATE_ of a session, or CAMERASTATE_CLOSED if it does not exist.
+extern "C" int32_t UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API
+getNativeCameraSessionState(uint32_t sessionId) {
+    lock_guard<mutex> lock(g_nativeSessionsMutex);
+    auto sessionIt = g_nativeSessions.find(sessionId);
+    return sessionIt != g_nativeSessions.end() ? sessionIt->second.session->state() : CAMERASTATE_CLOSED;
+}
+
+// Closes the camera, after which the session's GLES job is awaiting dispose. CPU frames already published stay valid until released.
+extern "C" void UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API
+closeNativeCameraSession(uint32_t sessionId) {
+    NativeSessionEntry entry;
+    {
+        lock_guard<mutex> lock(g_nativeSessionsMutex);
+        auto sessionIt = g_nativeSessions.find(sessionId);
+        if (sessionIt == g_nativeSessions.end()) {
+            LOGE("Unknown native session ID provided.");
+            return;
+        }
+
+        entry = sessionIt->second;
+        g_nativeSessions.erase(sessionIt);
+    }
+
+    // Stopped outside the lock, as the camera's callbacks may be waiting on it.
+    entry.session->stop();
+    if (entry.jobId != 0) {
+        releaseJobSource(entry.jobId);
+    }
+
+    LOGI("Native camera session %u closed.", sessionId);
+}
+
+//endregion
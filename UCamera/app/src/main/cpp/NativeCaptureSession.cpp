@@ -0,0 +1,109 @@
+// Copyright 2026 URAV ADVANCED LEARNING SYSTEMS PRIVATE LIMITED
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "NativeCaptureSession.h"
+#include "FrameBus.h"
+#include "NativeLog.h"
+
+#define TAG "UXRQC.NativeCapture"
+#define LOGI(...) NATIVE_LOG(ANDROID_LOG_INFO,  TAG, __VA_ARGS__)
+#define LOGE(...) NATIVE_LOG(ANDROID_LOG_ERROR, TAG, __VA_ARGS__)
+
+// Frame bus subscribers can hold a few frames while the camera keeps streaming.
+#define MAX_CPU_IMAGES 4
+
+using namespace std;
+
+// Keeps the camera alive until the last published image is released, even if the session is closed first.
+struct PublishedImage {
+    shared_ptr<NativeCamera> camera;
+    void* handle;
+};
+
+static void releasePublishedImage(const FrameBusFrame*, void* userData) {
+    auto image = static_cast<PublishedImage*>(userData);
+    image->camera->releaseImage(image->handle);
+    delete image;
+}
+
+NativeCaptureSession::NativeCaptureSession(uint32_t id, shared_ptr<NativeCamera> camera, shared_ptr<GLES_CameraSource> source, bool publishCpuFrames)
+    : _id(id), _camera(std::move(camera)), _source(std::move(source)), _publishCpuFrames(publishCpuFrames),
+      _state(CAMERASTATE_CLOSED), _cpuSequence(0) {
+}
+
+bool NativeCaptureSession::start(const char* cameraId, int32_t width, int32_t height, int32_t captureTemplate, ANativeWindow* window) {
+    CameraStreamConfig config = {
+            cameraId,
+            width,
+            height,
+            captureTemplate,
+            window,
+            _publishCpuFrames ? MAX_CPU_IMAGES : 0
+    };
+
+    if (!_camera->start(config, this)) {
+        _state.store(CAMERASTATE_ERRED, memory_order_release);
+        return false;
+    }
+
+    return true;
+}
+
+void NativeCaptureSession::stop() {
+    _camera->stop();
+    _state.store(CAMERASTATE_CLOSED, memory_order_release);
+}
+
+void NativeCaptureSession::onCameraState(int32_t state, int32_t error) {
+    if (state == CAMERASTATE_ERRED) {
+        LOGE("Session %u erred with: %i", _id, error);
+    }
+
+    _state.store(state, memory_order_release);
+}
+
+void NativeCaptureSession::onCameraImage(const CameraImage& image) {
+    uint32_t camera = _source != nullptr ? _source->texture() : 0;
+    if (!frameBus().hasSubscribers(camera, FRAMEBUS_FORMAT_YUV420_CPU)) {
+        _camera->releaseImage(image.handle);
+        return;
+    }
+
+    FrameBusFrame frame = {};
+    frame.camera = camera;
+    frame.format = FRAMEBUS_FORMAT_YUV420_CPU;
+    frame.producer = _id;
+    frame.width = image.width;
+    frame.height = image.height;
+    frame.layers = 1;
+    frame.timestamp = image.timestamp;
+    frame.sequence = _cpuSequence.fetch_add(1) + 1;
+
+    for (int i = 0; i < 16; i++) {
+        frame.transformMatrix[i] = (i % 5 == 0) ? 1.0f : 0.0f;
+    }
+
+    frame.planeCount = image.planeCount;
+    for (int32_t i = 0; i < image.planeCount; i++) {
+        frame.planes[i] = { image.planes[i].data, image.planes[i].rowStride, image.planes[i].pixelStride };
+    }
+
+    frameBus().publish(frame, releasePublishedImage, new PublishedImage { _camera, image.handle });
+}
+
+void NativeCaptureSession::onCaptureResult(int64_t sensorTimestamp, const CaptureMetadata& metadata) {
+    if (_source != nullptr) {
+        _source->captureMetadata().push(sensorTimestamp, metadata);
+    }
+}
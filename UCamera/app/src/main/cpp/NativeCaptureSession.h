@@ -0,0 +1,52 @@
+// Copyright 2026 URAV ADVANCED LEARNING SYSTEMS PRIVATE LIMITED
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef UXR_QUESTCAMERA_NATIVECAPTURESESSION_H
+#define UXR_QUESTCAMERA_NATIVECAPTURESESSION_H
+
+#include <atomic>
+#include <memory>
+
+#include "NativeCamera.h"
+#include "GLES_CameraSource.h"
+
+// A camera stream opened without the JVM. GPU frames go straight into a GLES job's source through its image reader,
+// and CPU frames are published to the frame bus as FRAMEBUS_FORMAT_YUV420_CPU, for native processing stages.
+class NativeCaptureSession : public CameraListener {
+
+public:
+    // source may be null if the session only publishes CPU frames.
+    NativeCaptureSession(uint32_t id, std::shared_ptr<NativeCamera> camera, std::shared_ptr<GLES_CameraSource> source, bool publishCpuFrames);
+
+    bool start(const char* cameraId, int32_t width, int32_t height, int32_t captureTemplate, ANativeWindow* window);
+    void stop();
+
+    int32_t state() const { return _state.load(std::memory_order_acquire); }
+
+    void onCameraState(int32_t state, int32_t error) override;
+    void onCameraImage(const CameraImage& image) override;
+    void onCaptureResult(int64_t sensorTimestamp, const CaptureMetadata& metadata) override;
+
+private:
+    uint32_t _id;
+    std::shared_ptr<NativeCamera> _camera;
+    std::shared_ptr<GLES_CameraSource> _source;
+    bool _publishCpuFrames;
+
+    std::atomic<int32_t> _state;
+    std::atomic<uint64_t> _cpuSequence;
+};
+
+
+#endif //UXR_QUESTCAMERA_NATIVECAPTURESESSION_H
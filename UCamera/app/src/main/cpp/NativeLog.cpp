@@ -0,0 +1,211 @@
+// Copyright 2026 URAV ADVANCED LEARNING SYSTEMS PRIVATE LIMITED
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "NativeLog.h"
+#include <chrono>
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <mutex>
+#include <thread>
+
+using namespace std;
+
+// Each call site may log this many messages per window, further messages are only counted.
+#define SITE_BURST             5
+#define SITE_WINDOW            1000000000LL
+
+#define RING_CAPACITY          256
+#define MESSAGE_LENGTH         224
+
+// Drained messages kept for dumpNativeLog().
+#define HISTORY_CAPACITY       128
+
+#define DRAIN_INTERVAL         chrono::milliseconds(100)
+
+struct LogRecord {
+    // Vyukov bounded queue sequence: equal to the enqueue position when free, position + 1 when written.
+    atomic<uint64_t> sequence;
+
+    int priority;
+    const char* tag;
+    int64_t timestamp;
+    char message[MESSAGE_LENGTH];
+};
+
+struct HistoryRecord {
+    int priority;
+    const char* tag;
+    int64_t timestamp;
+    char message[MESSAGE_LENGTH];
+};
+
+static LogRecord g_ring[RING_CAPACITY];
+static atomic<uint64_t> g_enqueuePosition(0);
+static uint64_t g_dequeuePosition = 0;
+
+static atomic<uint64_t> g_logged(0);
+static atomic<uint64_t> g_suppressed(0);
+static atomic<uint64_t> g_overflowed(0);
+
+static mutex g_historyMutex;
+static HistoryRecord g_history[HISTORY_CAPACITY];
+static uint32_t g_historyCount = 0;
+static uint32_t g_historyNext = 0;
+
+static once_flag g_drainStarted;
+
+static int64_t monotonicNow() {
+    timespec time = {};
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return (int64_t)time.tv_sec * 1000000000LL + time.tv_nsec;
+}
+
+static void initializeRing() {
+    for (uint64_t i = 0; i < RING_CAPACITY; i++) {
+        g_ring[i].sequence.store(i, memory_order_relaxed);
+    }
+}
+
+static bool drainRecord() {
+    LogRecord& record = g_ring[g_dequeuePosition % RING_CAPACITY];
+    if (record.sequence.load(memory_order_acquire) != g_dequeuePosition + 1) {
+        return false;
+    }
+
+    __android_log_write(record.priority, record.tag, record.message);
+
+    {
+        lock_guard<mutex> lock(g_historyMutex);
+        HistoryRecord& history = g_history[g_historyNext];
+        history.priority = record.priority;
+        history.tag = record.tag;
+        history.timestamp = record.timestamp;
+        memcpy(history.message, record.message, MESSAGE_LENGTH);
+
+        g_historyNext = (g_historyNext + 1) % HISTORY_CAPACITY;
+        g_historyCount = g_historyCount < HISTORY_CAPACITY ? g_historyCount + 1 : HISTORY_CAPACITY;
+    }
+
+    record.sequence.store(g_dequeuePosition + RING_CAPACITY, memory_order_release);
+    g_dequeuePosition++;
+    return true;
+}
+
+static void drainLoop() {
+    while (true) {
+        while (drainRecord()) { }
+        this_thread::sleep_for(DRAIN_INTERVAL);
+    }
+}
+
+static void startDrain() {
+    initializeRing();
+    thread(drainLoop).detach();
+}
+
+// Returns the number of messages suppressed since the site last logged, or -1 if this message should be suppressed.
+static int64_t passRateLimit(NativeLogSite* site, int64_t now) {
+    int64_t windowStart = site->windowStart.load(memory_order_relaxed);
+    if (now - windowStart >= SITE_WINDOW && site->windowStart.compare_exchange_strong(windowStart, now, memory_order_relaxed)) {
+        site->windowCount.store(0, memory_order_relaxed);
+    }
+
+    if (site->windowCount.fetch_add(1, memory_order_relaxed) >= SITE_BURST) {
+        site->suppressed.fetch_add(1, memory_order_relaxed);
+        g_suppressed.fetch_add(1, memory_order_relaxed);
+        return -1;
+    }
+
+    return site->suppressed.exchange(0, memory_order_relaxed);
+}
+
+void nativeLog(NativeLogSite* site, int priority, const char* tag, const char* format, ...) {
+    call_once(g_drainStarted, startDrain);
+
+    int64_t now = monotonicNow();
+    int64_t suppressed = passRateLimit(site, now);
+    if (suppressed < 0) {
+        return;
+    }
+
+    uint64_t position = g_enqueuePosition.load(memory_order_relaxed);
+    LogRecord* record;
+    while (true) {
+        record = &g_ring[position % RING_CAPACITY];
+        int64_t difference = (int64_t)record->sequence.load(memory_order_acquire) - (int64_t)position;
+        if (difference == 0) {
+            if (g_enqueuePosition.compare_exchange_weak(position, position + 1, memory_order_relaxed)) {
+                break;
+            }
+        } else if (difference < 0) {
+            g_overflowed.fetch_add(1, memory_order_relaxed);
+            return;
+        } else {
+            position = g_enqueuePosition.load(memory_order_relaxed);
+        }
+    }
+
+    record->priority = priority;
+    record->tag = tag;
+    record->timestamp = now;
+
+    int prefixLength = suppressed > 0 ? snprintf(record->message, MESSAGE_LENGTH, "(%lld similar suppressed) ", (long long)suppressed) : 0;
+
+    va_list args;
+    va_start(args, format);
+    vsnprintf(record->message + prefixLength, MESSAGE_LENGTH - prefixLength, format, args);
+    va_end(args);
+
+    record->sequence.store(position + 1, memory_order_release);
+    g_logged.fetch_add(1, memory_order_relaxed);
+}
+
+void nativeLogStats(NativeLogStats* stats) {
+    stats->logged = g_logged.load(memory_order_relaxed);
+    stats->suppressed = g_suppressed.load(memory_order_relaxed);
+    stats->overflowed = g_overflowed.load(memory_order_relaxed);
+}
+
+size_t dumpNativeLog(char* buffer, size_t size) {
+    static const char priorities[] = "??VDIWEF";
+
+    lock_guard<mutex> lock(g_historyMutex);
+
+    size_t length = 0;
+    for (uint32_t i = 0; i < g_historyCount; i++) {
+        const HistoryRecord& record = g_history[(g_historyNext + HISTORY_CAPACITY - g_historyCount + i) % HISTORY_CAPACITY];
+        char priority = record.priority >= 0 && record.priority < 8 ? priorities[record.priority] : '?';
+
+        char line[MESSAGE_LENGTH + 64];
+        int lineLength = snprintf(line, sizeof(line), "%.3f %c/%s: %s\n", (double)record.timestamp / 1e9, priority, record.tag, record.message);
+        if (lineLength <= 0) {
+            continue;
+        }
+
+        if (length + 1 < size) {
+            size_t copied = min((size_t)lineLength, size - length - 1);
+            memcpy(buffer + length, line, copied);
+        }
+
+        length += min((size_t)lineLength, sizeof(line) - 1);
+    }
+
+    if (size > 0) {
+        buffer[min(length, size - 1)] = '\0';
+    }
+
+    return length;
+}
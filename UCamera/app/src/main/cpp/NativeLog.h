@@ -0,0 +1,59 @@
+// Copyright 2026 URAV ADVANCED LEARNING SYSTEMS PRIVATE LIMITED
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef UXR_QUESTCAMERA_NATIVELOG_H
+#define UXR_QUESTCAMERA_NATIVELOG_H
+
+#include <android/log.h>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+// Logs through a per-call-site rate limit into an in-memory ring, which a background thread drains into logcat.
+// Safe to use on the render thread: logging never blocks or makes a system call.
+#define NATIVE_LOG(priority, tag, ...)                          \
+    do {                                                        \
+        static NativeLogSite logSite;                           \
+        nativeLog(&logSite, priority, tag, __VA_ARGS__);        \
+    } while (0)
+
+// Rate limit state of one logging call site.
+struct NativeLogSite {
+    std::atomic<int64_t> windowStart;
+    std::atomic<uint32_t> windowCount;
+    std::atomic<uint32_t> suppressed;
+};
+
+struct NativeLogStats {
+    // Messages written to the ring.
+    uint64_t logged;
+
+    // Messages dropped by call site rate limits.
+    uint64_t suppressed;
+
+    // Messages dropped because the ring was full.
+    uint64_t overflowed;
+};
+
+// tag must be a string literal, or otherwise outlive the library.
+void nativeLog(NativeLogSite* site, int priority, const char* tag, const char* format, ...) __attribute__((format(printf, 4, 5)));
+
+void nativeLogStats(NativeLogStats* stats);
+
+// Writes the most recently drained messages, oldest first, as newline-separated text. Returns the full length of the text,
+// which may be more than size; buffer is always null-terminated if size is not 0.
+size_t dumpNativeLog(char* buffer, size_t size);
+
+
+#endif //UXR_QUESTCAMERA_NATIVELOG_H
@@ -0,0 +1,63 @@
+// Copyright 2026 URAV ADVANCED LEARNING SYSTEMS PRIVATE LIMITED
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "PlaneKernels.h"
+
+#if defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+// P010 samples are 10 bits, left aligned in 16 bits.
+#define P010_SHIFT 6
+
+void unpackP010Plane(uint16_t* dst, const uint8_t* src, size_t srcRowStride, int32_t samplesPerRow, int32_t rows) {
+    for (int32_t row = 0; row < rows; row++) {
+        auto srcRow = reinterpret_cast<const uint16_t*>(src + srcRowStride * row);
+        uint16_t* dstRow = dst + (size_t)samplesPerRow * row;
+
+        int32_t i = 0;
+#if defined(__ARM_NEON)
+        for (; i + 16 <= samplesPerRow; i += 16) {
+            uint16x8_t low = vld1q_u16(srcRow + i);
+            uint16x8_t high = vld1q_u16(srcRow + i + 8);
+            vst1q_u16(dstRow + i, vshrq_n_u16(low, P010_SHIFT));
+            vst1q_u16(dstRow + i + 8, vshrq_n_u16(high, P010_SHIFT));
+        }
+#endif
+        for (; i < samplesPerRow; i++) {
+            dstRow[i] = srcRow[i] >> P010_SHIFT;
+        }
+    }
+}
+
+void unpackP010Chroma(uint16_t* dstU, uint16_t* dstV, const uint8_t* src, size_t srcRowStride, int32_t pairsPerRow, int32_t rows) {
+    for (int32_t row = 0; row < rows; row++) {
+        auto srcRow = reinterpret_cast<const uint16_t*>(src + srcRowStride * row);
+        uint16_t* dstURow = dstU + (size_t)pairsPerRow * row;
+        uint16_t* dstVRow = dstV + (size_t)pairsPerRow * row;
+
+        int32_t i = 0;
+#if defined(__ARM_NEON)
+        for (; i + 8 <= pairsPerRow; i += 8) {
+            uint16x8x2_t pairs = vld2q_u16(srcRow + i * 2);
+            vst1q_u16(dstURow + i, vshrq_n_u16(pairs.val[0], P010_SHIFT));
+            vst1q_u16(dstVRow + i, vshrq_n_u16(pairs.val[1], P010_SHIFT));
+        }
+#endif
+        for (; i < pairsPerRow; i++) {
+            dstURow[i] = srcRow[i * 2] >> P010_SHIFT;
+            dstVRow[i] = srcRow[i * 2 + 1] >> P010_SHIFT;
+        }
+    }
+}
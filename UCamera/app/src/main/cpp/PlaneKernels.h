@@ -0,0 +1,33 @@
+// Copyright 2026 URAV ADVANCED LEARNING SYSTEMS PRIVATE LIMITED
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef UXR_QUESTCAMERA_PLANEKERNELS_H
+#define UXR_QUESTCAMERA_PLANEKERNELS_H
+
+#include <cstddef>
+#include <cstdint>
+
+// Sample layouts of CPU-side YUV 4:2:0 planes. Mirrored in C#.
+#define PLANE_SAMPLES_8BIT  0
+#define PLANE_SAMPLES_P010  1
+
+// Unpacks rows of 16-bit P010 samples, which hold 10 bits in their high bits, into 10-bit values in the low bits.
+// Source rows are srcRowStride bytes apart, destination rows are tightly packed.
+void unpackP010Plane(uint16_t* dst, const uint8_t* src, size_t srcRowStride, int32_t samplesPerRow, int32_t rows);
+
+// Like unpackP010Plane, but splits rows of interleaved (Cb, Cr) sample pairs into two planes.
+void unpackP010Chroma(uint16_t* dstU, uint16_t* dstV, const uint8_t* src, size_t srcRowStride, int32_t pairsPerRow, int32_t rows);
+
+
+#endif //UXR_QUESTCAMERA_PLANEKERNELS_H
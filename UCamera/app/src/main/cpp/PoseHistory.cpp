@@ -0,0 +1,73 @@
+// Copyright 2026 URAV ADVANCED LEARNING SYSTEMS PRIVATE LIMITED
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "PoseHistory.h"
+#include <cmath>
+
+using namespace std;
+
+static void slerp(const float from[4], const float to[4], float t, float result[4]) {
+    float dot = from[0] * to[0] + from[1] * to[1] + from[2] * to[2] + from[3] * to[3];
+
+    // Take the shortest path.
+    float sign = dot < 0.0f ? -1.0f : 1.0f;
+    dot *= sign;
+
+    float fromWeight = 1.0f - t;
+    float toWeight = t;
+
+    // Nearly parallel rotations are lerped, which is accurate enough and avoids dividing by ~0.
+    if (dot < 0.9995f) {
+        float angle = acosf(dot);
+        float sinAngle = sinf(angle);
+        fromWeight = sinf((1.0f - t) * angle) / sinAngle;
+        toWeight = sinf(t * angle) / sinAngle;
+    }
+
+    float length = 0.0f;
+    for (int i = 0; i < 4; i++) {
+        result[i] = from[i] * fromWeight + to[i] * toWeight * sign;
+        length += result[i] * result[i];
+    }
+
+    length = sqrtf(length);
+    for (int i = 0; i < 4; i++) {
+        result[i] /= length;
+    }
+}
+
+bool PoseHistory::sample(int64_t timestamp, Pose* pose) const {
+    int64_t lowTimestamp, highTimestamp;
+    Pose lowPose, highPose;
+
+    if (!bracket(timestamp, &lowTimestamp, &lowPose, &highTimestamp, &highPose)) {
+        return false;
+    }
+
+    float t = highTimestamp > lowTimestamp
+            ? (float)(timestamp - lowTimestamp) / (float)(highTimestamp - lowTimestamp)
+            : 0.0f;
+
+    slerp(lowPose.rotation, highPose.rotation, t, pose->rotation);
+    for (int i = 0; i < 3; i++) {
+        pose->position[i] = lowPose.position[i] + (highPose.position[i] - lowPose.position[i]) * t;
+    }
+
+    return true;
+}
+
+PoseHistory& headPoseHistory() {
+    static PoseHistory history;
+    return history;
+}
@@ -0,0 +1,38 @@
+// Copyright 2026 URAV ADVANCED LEARNING SYSTEMS PRIVATE LIMITED
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef UXR_QUESTCAMERA_POSEHISTORY_H
+#define UXR_QUESTCAMERA_POSEHISTORY_H
+
+#include <cstdint>
+#include "TimestampedHistory.h"
+
+struct Pose {
+    float rotation[4]; // x, y, z, w
+    float position[3];
+};
+
+// History of head poses, sampled with rotation slerp and position lerp between records.
+class PoseHistory : public TimestampedHistory<Pose, 512> {
+
+public:
+    // Interpolates the pose at timestamp. Returns false if timestamp is outside the recorded range.
+    bool sample(int64_t timestamp, Pose* pose) const;
+};
+
+// Head poses pushed from Unity, in the camera timestamp domain. Shared by all native stages.
+PoseHistory& headPoseHistory();
+
+
+#endif //UXR_QUESTCAMERA_POSEHISTORY_H
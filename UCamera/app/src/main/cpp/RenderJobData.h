@@ -0,0 +1,121 @@
+// Copyright 2026 URAV ADVANCED LEARNING SYSTEMS PRIVATE LIMITED
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef UXR_QUESTCAMERA_RENDERJOBDATA_H
+#define UXR_QUESTCAMERA_RENDERJOBDATA_H
+
+#include <cstdint>
+
+// Data passed with the render events of native jobs. Shared by every rendering backend, and mirrored in C#.
+
+#define JOBMODE_CONVERT      0
+#define JOBMODE_PASSTHROUGH  1
+#define JOBMODE_STEREO       2
+#define JOBMODE_CROP_BATCH   3
+#define JOBMODE_PLANAR       4
+
+struct GLES_CropBatch;
+
+#define EVENTID_SETUP_JOB    1
+#define EVENTID_DISPOSE_JOB  2
+#define EVENTID_RUN_JOB      3
+
+#define JOBFLAG_REPROJECT    0x1
+#define JOBFLAG_BT2020       0x2
+
+struct JobSetupData {
+    uint32_t renderTexture;
+    int32_t width; int32_t height;
+
+    uint32_t sourceJob;
+    uint32_t secondSourceJob;
+    float cropRect[4];
+    int32_t mode;
+    int32_t filter;
+    float sharpness;
+    uint32_t flags;
+
+    void (*onDone)(uint32_t nativeTexture, uint32_t renderTexture);
+
+    // The texture's native pointer from Unity, used by backends which can't identify textures by renderTexture.
+    void* nativeTexture;
+
+    // For JOBMODE_PLANAR, the half-size two channel texture which receives chroma. renderTexture receives luma.
+    uint32_t chromaTexture;
+
+    // For JOBMODE_CONVERT, the layer count of a GL_TEXTURE_2D_ARRAY renderTexture which new frames are written to in turn.
+    // 0 if renderTexture is a GL_TEXTURE_2D.
+    int32_t historyLayers;
+};
+
+#define FRAMEFLAG_REPEATED  0x1
+#define FRAMEFLAG_DROPPED   0x2
+
+struct JobFrameInfo {
+    int64_t timestamp;
+    uint32_t sourceTexture;
+    float transformMatrix[16];
+
+    // The job's sequence number of the frame, starting from 1.
+    uint64_t sequence;
+
+    // Camera frames estimated to have been skipped since the job's previous frame.
+    uint32_t droppedFrames;
+
+    // FRAMEFLAG_* values.
+    uint32_t flags;
+
+    // The layer of a history ring job's texture array holding the frame, or -1 for other jobs.
+    int32_t historyLayer;
+};
+
+struct JobReprojection {
+    // Predicted head rotation when the output will be displayed (x, y, z, w).
+    float displayRotation[4];
+
+    // Camera rotation relative to the head (x, y, z, w).
+    float cameraRotation[4];
+
+    // Camera intrinsics (fx, fy, cx, cy), in UV units.
+    float intrinsics[4];
+};
+
+// Written by the app while the job runs. The writer fills poses[(published + 1) & 1], then increments published,
+// so the render thread always copies a complete pose without locking.
+struct JobReprojectionBuffer {
+    uint32_t published;
+    JobReprojection poses[2];
+};
+
+struct JobRunData {
+    uint32_t renderTexture;
+    void (*onDone)(int64_t timestamp, uint32_t renderTexture);
+
+    // Optional, filled before onDone is invoked.
+    JobFrameInfo* frameInfo;
+
+    // Regions to render for crop batch jobs, read when the job runs.
+    const GLES_CropBatch* cropBatch;
+
+    // Display-time pose for reprojecting jobs, read when the job runs.
+    const JobReprojectionBuffer* reprojection;
+};
+
+struct JobDisposeData {
+    uint32_t renderTexture;
+    void (*onDone)(bool result, uint32_t renderTexture);
+};
+
+
+#endif //UXR_QUESTCAMERA_RENDERJOBDATA_H
@@ -0,0 +1,95 @@
+// Copyright 2026 URAV ADVANCED LEARNING SYSTEMS PRIVATE LIMITED
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "Reprojection.h"
+
+static void multiply(const float a[4], const float b[4], float result[4]) {
+    result[0] = a[3] * b[0] + a[0] * b[3] + a[1] * b[2] - a[2] * b[1];
+    result[1] = a[3] * b[1] - a[0] * b[2] + a[1] * b[3] + a[2] * b[0];
+    result[2] = a[3] * b[2] + a[0] * b[1] - a[1] * b[0] + a[2] * b[3];
+    result[3] = a[3] * b[3] - a[0] * b[0] - a[1] * b[1] - a[2] * b[2];
+}
+
+static void conjugate(const float q[4], float result[4]) {
+    result[0] = -q[0];
+    result[1] = -q[1];
+    result[2] = -q[2];
+    result[3] =  q[3];
+}
+
+// Row-major rotation matrix of a unit quaternion.
+static void toMatrix(const float q[4], float m[3][3]) {
+    float x = q[0], y = q[1], z = q[2], w = q[3];
+
+    m[0][0] = 1 - 2 * (y * y + z * z); m[0][1] = 2 * (x * y - z * w);     m[0][2] = 2 * (x * z + y * w);
+    m[1][0] = 2 * (x * y + z * w);     m[1][1] = 1 - 2 * (x * x + z * z); m[1][2] = 2 * (y * z - x * w);
+    m[2][0] = 2 * (x * z - y * w);     m[2][1] = 2 * (y * z + x * w);     m[2][2] = 1 - 2 * (x * x + y * y);
+}
+
+void computeReprojectionHomography(const float captureRotation[4],
+                                   const float displayRotation[4],
+                                   const float cameraRotation[4],
+                                   const float intrinsics[4],
+                                   float homography[9]) {
+
+    // Rotation from the display-time camera frame to the capture-time camera frame:
+    // conj(camera) * conj(capture) * display * camera
+    float inverseCamera[4], inverseCapture[4], temp0[4], temp1[4], relative[4];
+    conjugate(cameraRotation, inverseCamera);
+    conjugate(captureRotation, inverseCapture);
+
+    multiply(inverseCamera, inverseCapture, temp0);
+    multiply(temp0, displayRotation, temp1);
+    multiply(temp1, cameraRotation, relative);
+
+    float r[3][3];
+    toMatrix(relative, r);
+
+    float fx = intrinsics[0], fy = intrinsics[1];
+    float cx = intrinsics[2], cy = intrinsics[3];
+
+    // H = K * R * K^-1, with K = [fx 0 cx; 0 fy cy; 0 0 1]
+    float kInverse[3][3] = {
+            { 1.0f / fx, 0.0f,      -cx / fx },
+            { 0.0f,      1.0f / fy, -cy / fy },
+            { 0.0f,      0.0f,      1.0f     },
+    };
+
+    float k[3][3] = {
+            { fx,   0.0f, cx   },
+            { 0.0f, fy,   cy   },
+            { 0.0f, 0.0f, 1.0f },
+    };
+
+    float rk[3][3];
+    for (int row = 0; row < 3; row++) {
+        for (int column = 0; column < 3; column++) {
+            rk[row][column] = 0.0f;
+            for (int i = 0; i < 3; i++) {
+                rk[row][column] += r[row][i] * kInverse[i][column];
+            }
+        }
+    }
+
+    for (int row = 0; row < 3; row++) {
+        for (int column = 0; column < 3; column++) {
+            float value = 0.0f;
+            for (int i = 0; i < 3; i++) {
+                value += k[row][i] * rk[i][column];
+            }
+
+            homography[column * 3 + row] = value;
+        }
+    }
+}
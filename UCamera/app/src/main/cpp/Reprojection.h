@@ -0,0 +1,31 @@
+// Copyright 2026 URAV ADVANCED LEARNING SYSTEMS PRIVATE LIMITED
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef UXR_QUESTCAMERA_REPROJECTION_H
+#define UXR_QUESTCAMERA_REPROJECTION_H
+
+// Computes the column-major homography which maps camera UVs seen at displayRotation to camera UVs seen
+// at captureRotation, assuming all content is at infinity (rotation-only reprojection).
+//
+// captureRotation and displayRotation are head rotations (x, y, z, w). cameraRotation is the camera's
+// rotation relative to the head. intrinsics are (fx, fy, cx, cy) in UV units, in a camera frame
+// looking down +z with u along +x and v along +y.
+void computeReprojectionHomography(const float captureRotation[4],
+                                   const float displayRotation[4],
+                                   const float cameraRotation[4],
+                                   const float intrinsics[4],
+                                   float homography[9]);
+
+
+#endif //UXR_QUESTCAMERA_REPROJECTION_H
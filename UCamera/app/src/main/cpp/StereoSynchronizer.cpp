@@ -0,0 +1,110 @@
+// Copyright 2026 URAV ADVANCED LEARNING SYSTEMS PRIVATE LIMITED
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "StereoSynchronizer.h"
+
+using namespace std;
+
+void StereoSynchronizer::PendingFrames::popFront() {
+    head = (head + 1) % MAX_PENDING;
+    count--;
+}
+
+StereoSynchronizer::StereoSynchronizer(int64_t tolerance, uint32_t queueDepth) {
+    _tolerance = tolerance;
+    _pending[STEREO_EYE_LEFT] = {};
+    _pending[STEREO_EYE_RIGHT] = {};
+
+    _queueDepth = queueDepth;
+    _queueHead = 0;
+    _queued = 0;
+
+    _stats = {};
+}
+
+void StereoSynchronizer::dropFront(int32_t eye) {
+    _pending[eye].popFront();
+    if (eye == STEREO_EYE_LEFT) {
+        _stats.unpairedLeft++;
+    } else {
+        _stats.unpairedRight++;
+    }
+}
+
+void StereoSynchronizer::push(int32_t eye, const StereoFrame& frame) {
+    lock_guard<mutex> lock(_mutex);
+
+    PendingFrames& pending = _pending[eye];
+    if (pending.count > 0 && frame.timestamp <= pending.frames[(pending.head + pending.count - 1) % MAX_PENDING].timestamp) {
+        // Out of order frames would break matching, and can't be closer than the frame before them anyway.
+        return;
+    }
+
+    if (pending.count == MAX_PENDING) {
+        dropFront(eye);
+    }
+
+    pending.frames[(pending.head + pending.count) % MAX_PENDING] = frame;
+    pending.count++;
+    match();
+}
+
+void StereoSynchronizer::match() {
+    PendingFrames& left = _pending[STEREO_EYE_LEFT];
+    PendingFrames& right = _pending[STEREO_EYE_RIGHT];
+
+    while (left.count > 0 && right.count > 0) {
+        int64_t delta = right.front().timestamp - left.front().timestamp;
+        if (delta > _tolerance) {
+            dropFront(STEREO_EYE_LEFT);
+            continue;
+        }
+
+        if (-delta > _tolerance) {
+            dropFront(STEREO_EYE_RIGHT);
+            continue;
+        }
+
+        if (_queued == _queueDepth) {
+            _queueHead = (_queueHead + 1) % _queueDepth;
+            _queued--;
+            _stats.droppedPairs++;
+        }
+
+        _queue[(_queueHead + _queued) % _queueDepth] = { left.front(), right.front(), delta };
+        _queued++;
+        _stats.pairs++;
+
+        left.popFront();
+        right.popFront();
+    }
+}
+
+bool StereoSynchronizer::poll(StereoFramePair* pair) {
+    lock_guard<mutex> lock(_mutex);
+    if (_queued == 0) {
+        return false;
+    }
+
+    *pair = _queue[_queueHead];
+    _queueHead = (_queueHead + 1) % _queueDepth;
+    _queued--;
+    return true;
+}
+
+void StereoSynchronizer::stats(StereoSyncStats* stats) {
+    lock_guard<mutex> lock(_mutex);
+    *stats = _stats;
+    stats->queued = _queued;
+}
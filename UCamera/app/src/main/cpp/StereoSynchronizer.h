@@ -0,0 +1,102 @@
+// Copyright 2026 URAV ADVANCED LEARNING SYSTEMS PRIVATE LIMITED
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef UXR_QUESTCAMERA_STEREOSYNCHRONIZER_H
+#define UXR_QUESTCAMERA_STEREOSYNCHRONIZER_H
+
+#include <cstdint>
+#include <mutex>
+
+#define STEREO_EYE_LEFT     0
+#define STEREO_EYE_RIGHT    1
+
+// A frame of one eye's job. Mirrored in C#.
+struct StereoFrame {
+    uint32_t job;
+    uint64_t sequence;
+    int64_t timestamp;
+};
+
+// Frames of both eyes captured within the synchronizer's tolerance. Mirrored in C#.
+struct StereoFramePair {
+    StereoFrame left;
+    StereoFrame right;
+
+    // Right timestamp minus left timestamp, in nanoseconds.
+    int64_t delta;
+};
+
+// Mirrored in C#.
+struct StereoSyncStats {
+    uint64_t pairs;
+
+    // Frames of each eye which had no frame of the other eye within the tolerance.
+    uint64_t unpairedLeft;
+    uint64_t unpairedRight;
+
+    // Pairs replaced in the full queue before being polled.
+    uint64_t droppedPairs;
+    uint32_t queued;
+};
+
+// Pairs the frames of two camera streams by nearest timestamp. Each eye's frames must arrive in timestamp order,
+// so pending frames are matched like a merge: the oldest pending frame of either eye is paired with the oldest of
+// the other if they are within the tolerance, and dropped otherwise, as no later frame could be closer.
+// Every push takes constant time, and pairs are kept in a bounded queue, replacing the oldest when full.
+class StereoSynchronizer {
+
+public:
+    static constexpr uint32_t MAX_QUEUE_DEPTH = 16;
+
+    // Frames kept per eye while waiting for the other eye, like while one stream is stalled.
+    static constexpr uint32_t MAX_PENDING = 8;
+
+    // tolerance should be under half the frame period, so each frame has at most one candidate in the other stream.
+    StereoSynchronizer(int64_t tolerance, uint32_t queueDepth);
+
+    // Can be called from any thread.
+    void push(int32_t eye, const StereoFrame& frame);
+
+    // Returns false if no pair is queued.
+    bool poll(StereoFramePair* pair);
+    void stats(StereoSyncStats* stats);
+
+private:
+    struct PendingFrames {
+        StereoFrame frames[MAX_PENDING];
+        uint32_t head;
+        uint32_t count;
+
+        const StereoFrame& front() const { return frames[head]; }
+        void popFront();
+    };
+
+    void match();
+    void dropFront(int32_t eye);
+
+    std::mutex _mutex;
+    int64_t _tolerance;
+
+    PendingFrames _pending[2];
+
+    StereoFramePair _queue[MAX_QUEUE_DEPTH];
+    uint32_t _queueDepth;
+    uint32_t _queueHead;
+    uint32_t _queued;
+
+    StereoSyncStats _stats;
+};
+
+
+#endif //UXR_QUESTCAMERA_STEREOSYNCHRONIZER_H
@@ -0,0 +1,165 @@
+// Copyright 2026 URAV ADVANCED LEARNING SYSTEMS PRIVATE LIMITED
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ConverterBackend.h"
+#include "VK_Context.h"
+#include "NativeLog.h"
+#include "RenderJobData.h"
+#include "IUnityInterface.h"
+#include "IUnityGraphics.h"
+#include "IUnityGraphicsVulkan.h"
+
+#define TAG "UXRQC.TexConvMgr"
+#define LOGI(...) NATIVE_LOG(ANDROID_LOG_INFO,  TAG, __VA_ARGS__)
+#define LOGE(...) NATIVE_LOG(ANDROID_LOG_ERROR, TAG, __VA_ARGS__)
+
+using namespace std;
+
+static IUnityInterfaces* g_unityInterfaces = nullptr;
+static IUnityGraphics* g_unityGraphics = nullptr;
+
+// Selected when Unity's graphics device is created, and only used on the render thread.
+static ConverterBackend* g_backend = nullptr;
+
+//region Unity interface
+
+static void failEvent(int eventId, void* data) {
+    switch (eventId) {
+        case EVENTID_SETUP_JOB: {
+            auto setupData = reinterpret_cast<JobSetupData*>(data);
+            setupData->onDone(0, setupData->renderTexture);
+            break;
+        }
+
+        case EVENTID_RUN_JOB: {
+            auto runData = reinterpret_cast<JobRunData*>(data);
+            runData->onDone(-1, runData->renderTexture);
+            break;
+        }
+
+        case EVENTID_DISPOSE_JOB: {
+            auto disposeData = reinterpret_cast<JobDisposeData*>(data);
+            disposeData->onDone(false, disposeData->renderTexture);
+            break;
+        }
+
+        default:
+            LOGE("Unknown event '%i'", eventId);
+            break;
+    }
+}
+
+static void UNITY_INTERFACE_API manageConverterJob(int eventId, void* data) {
+    if (data == nullptr) {
+        LOGE("nullptr passed to manageConverterJob.");
+        return;
+    }
+
+    // Jobs still complete, so C# never waits for an event which was dropped.
+    if (g_backend == nullptr) {
+        LOGE("No converter backend for Unity's renderer.");
+        failEvent(eventId, data);
+        return;
+    }
+
+    switch (eventId) {
+        case EVENTID_SETUP_JOB:
+            g_backend->setupJob(reinterpret_cast<JobSetupData*>(data));
+            break;
+
+        case EVENTID_RUN_JOB:
+            g_backend->runJob(reinterpret_cast<JobRunData*>(data));
+            break;
+
+        case EVENTID_DISPOSE_JOB:
+            g_backend->disposeJob(reinterpret_cast<JobDisposeData*>(data));
+            break;
+
+        default:
+            LOGE("Unknown event '%i'", eventId);
+            break;
+    }
+}
+
+static void UNITY_INTERFACE_API onGraphicsDeviceEvent(UnityGfxDeviceEventType eventType) {
+    if (eventType == kUnityGfxDeviceEventInitialize) {
+        if (g_backend != nullptr) {
+            return;
+        }
+
+        UnityGfxRenderer renderer = g_unityGraphics->GetRenderer();
+        switch (renderer) {
+            case kUnityGfxRendererOpenGLES30:
+                g_backend = createGLESConverterBackend();
+                break;
+
+            case kUnityGfxRendererVulkan:
+                g_backend = createVulkanConverterBackend(g_unityInterfaces);
+                break;
+
+            default:
+                break;
+        }
+
+        if (g_backend == nullptr) {
+            LOGE("No converter backend supports renderer %i.", renderer);
+            return;
+        }
+
+        LOGI("Using converter backend %i.", g_backend->type());
+    } else if (eventType == kUnityGfxDeviceEventShutdown) {
+        delete g_backend;
+        g_backend = nullptr;
+    }
+}
+
+extern "C" void UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API
+UnityPluginLoad(IUnityInterfaces* unityInterfaces) {
+    g_unityInterfaces = unityInterfaces;
+    g_unityGraphics = unityInterfaces->Get<IUnityGraphics>();
+
+    // Vulkan's device can only be configured before it exists, which is before the renderer can be checked.
+    IUnityGraphicsVulkan* vulkanGraphics = unityInterfaces->Get<IUnityGraphicsVulkan>();
+    if (vulkanGraphics != nullptr) {
+        interceptVulkanInitialization(vulkanGraphics);
+    }
+
+    g_unityGraphics->RegisterDeviceEventCallback(onGraphicsDeviceEvent);
+
+    // The device already exists if the plugin was loaded after Unity's graphics initialization.
+    onGraphicsDeviceEvent(kUnityGfxDeviceEventInitialize);
+}
+
+extern "C" void UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API
+UnityPluginUnload() {
+    g_unityGraphics->UnregisterDeviceEventCallback(onGraphicsDeviceEvent);
+}
+
+extern "C" UnityRenderingEventAndData UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API
+getManageConverterJobEvent() {
+    return manageConverterJob;
+}
+
+// Kept for existing callers; every job event now goes through the active backend.
+extern "C" UnityRenderingEventAndData UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API
+getGLESManageConverterJobEvent() {
+    return manageConverterJob;
+}
+
+extern "C" int32_t UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API
+getConverterBackend() {
+    return g_backend != nullptr ? g_backend->type() : BACKEND_NONE;
+}
+
+//endregion
@@ -0,0 +1,172 @@
+// Copyright 2026 URAV ADVANCED LEARNING SYSTEMS PRIVATE LIMITED
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef UXR_QUESTCAMERA_TIMESTAMPEDHISTORY_H
+#define UXR_QUESTCAMERA_TIMESTAMPEDHISTORY_H
+
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+
+// Lock-free ring of timestamped records, written by one thread and read by any number of threads.
+// Each record is guarded by its own sequence counter, so readers never block the writer and
+// retry or skip records that were overwritten while being read. Lookups are O(log n).
+template<typename T, uint32_t Capacity>
+class TimestampedHistory {
+    static_assert(std::is_trivially_copyable<T>::value, "Records are copied without locks, so must be trivially copyable.");
+
+public:
+    static constexpr uint32_t CAPACITY = Capacity;
+
+    TimestampedHistory() {
+        for (auto& record : _records) {
+            record.sequence = 0;
+            record.index = 0;
+            record.timestamp = 0;
+            record.value = {};
+        }
+
+        _count = 0;
+    }
+
+    // Must only be called from one thread at a time, with increasing timestamps.
+    void push(int64_t timestamp, const T& value) {
+        uint64_t index = _count.load(std::memory_order_relaxed);
+        Record& record = _records[index % CAPACITY];
+
+        // Odd sequence numbers mark records which are being written.
+        uint32_t sequence = record.sequence.load(std::memory_order_relaxed);
+        record.sequence.store(sequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        record.index = index;
+        record.timestamp = timestamp;
+        record.value = value;
+
+        record.sequence.store(sequence + 2, std::memory_order_release);
+        _count.store(index + 1, std::memory_order_release);
+    }
+
+    // Finds the records at or before, and at or after timestamp, for interpolation.
+    // Returns false if timestamp is outside the recorded range.
+    bool bracket(int64_t timestamp, int64_t* lowTimestamp, T* low, int64_t* highTimestamp, T* high) const {
+        return search(timestamp, lowTimestamp, low, highTimestamp, high)
+               && timestamp >= *lowTimestamp && timestamp <= *highTimestamp;
+    }
+
+    // Finds the record closest to timestamp. Returns false if there is none within maxDelta.
+    bool nearest(int64_t timestamp, int64_t maxDelta, int64_t* foundTimestamp, T* value) const {
+        int64_t lowTimestamp, highTimestamp;
+        T low, high;
+
+        if (!search(timestamp, &lowTimestamp, &low, &highTimestamp, &high)) {
+            return false;
+        }
+
+        int64_t lowDelta = timestamp > lowTimestamp ? timestamp - lowTimestamp : lowTimestamp - timestamp;
+        int64_t highDelta = timestamp > highTimestamp ? timestamp - highTimestamp : highTimestamp - timestamp;
+        if (lowDelta <= highDelta) {
+            *foundTimestamp = lowTimestamp;
+            *value = low;
+            return lowDelta <= maxDelta;
+        }
+
+        *foundTimestamp = highTimestamp;
+        *value = high;
+        return highDelta <= maxDelta;
+    }
+
+private:
+    // Records this close to being overwritten are not searched, as the writer will likely reach them mid-read.
+    static constexpr uint32_t WRITER_MARGIN = CAPACITY / 16 > 0 ? CAPACITY / 16 : 1;
+
+    struct Record {
+        std::atomic<uint32_t> sequence;
+        uint64_t index;
+        int64_t timestamp;
+        T value;
+    };
+
+    Record _records[CAPACITY];
+    std::atomic<uint64_t> _count;
+
+    bool read(uint64_t index, int64_t* timestamp, T* value) const {
+        const Record& record = _records[index % CAPACITY];
+
+        uint32_t sequenceBefore = record.sequence.load(std::memory_order_acquire);
+        if (sequenceBefore & 1) {
+            return false;
+        }
+
+        uint64_t recordIndex = record.index;
+        *timestamp = record.timestamp;
+        *value = record.value;
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return record.sequence.load(std::memory_order_relaxed) == sequenceBefore && recordIndex == index;
+    }
+
+    // Finds the last record at or before timestamp and the record after it, clamped to the oldest and newest records.
+    bool search(int64_t timestamp, int64_t* lowTimestamp, T* low, int64_t* highTimestamp, T* high) const {
+        uint64_t count = _count.load(std::memory_order_acquire);
+        if (count == 0) {
+            return false;
+        }
+
+        uint64_t oldest = count > CAPACITY - WRITER_MARGIN ? count - (CAPACITY - WRITER_MARGIN) : 0;
+        uint64_t newest = count - 1;
+
+        if (!read(oldest, lowTimestamp, low) || !read(newest, highTimestamp, high)) {
+            return false;
+        }
+
+        if (timestamp <= *lowTimestamp) {
+            *highTimestamp = *lowTimestamp;
+            *high = *low;
+            return true;
+        }
+
+        if (timestamp >= *highTimestamp) {
+            *lowTimestamp = *highTimestamp;
+            *low = *high;
+            return true;
+        }
+
+        uint64_t lowIndex = oldest, highIndex = newest;
+        while (highIndex - lowIndex > 1) {
+            uint64_t middleIndex = lowIndex + (highIndex - lowIndex) / 2;
+
+            int64_t middleTimestamp;
+            T middle;
+            if (!read(middleIndex, &middleTimestamp, &middle)) {
+                return false;
+            }
+
+            if (middleTimestamp <= timestamp) {
+                lowIndex = middleIndex;
+                *lowTimestamp = middleTimestamp;
+                *low = middle;
+            } else {
+                highIndex = middleIndex;
+                *highTimestamp = middleTimestamp;
+                *high = middle;
+            }
+        }
+
+        return true;
+    }
+};
+
+
+#endif //UXR_QUESTCAMERA_TIMESTAMPEDHISTORY_H
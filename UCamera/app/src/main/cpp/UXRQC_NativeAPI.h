@@ -0,0 +1,145 @@
+// Copyright 2026 URAV ADVANCED LEARNING SYSTEMS PRIVATE LIMITED
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef UXR_QUESTCAMERA_UXRQC_NATIVEAPI_H
+#define UXR_QUESTCAMERA_UXRQC_NATIVEAPI_H
+
+// Public C interface of libUXRQC_NativeConverters.so, for native plugins which consume camera frames without going through C#.
+// Fields and functions are only ever appended, check getUXRQCNativeAPIVersion() against UXRQC_NATIVEAPI_VERSION before use.
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define UXRQC_NATIVEAPI_VERSION        2
+
+// Matches any camera or format when subscribing.
+#define FRAMEBUS_ANY_CAMERA            0
+#define FRAMEBUS_ANY_FORMAT            -1
+
+// The camera's latched GL_TEXTURE_EXTERNAL_OES texture, published once per camera frame.
+#define FRAMEBUS_FORMAT_EXTERNAL_OES   0
+
+// A converting job's RGBA output texture, published once per new frame the job renders.
+// Jobs rendering into RGB10_A2 or RGBA16F textures publish FRAMEBUS_FORMAT_RGB10A2 or FRAMEBUS_FORMAT_RGBA16F instead.
+#define FRAMEBUS_FORMAT_RGBA           1
+
+// A converting job's RGBA output, read back into CPU memory with rows in GL order, bottom row first.
+// Published one or two frames after the texture. Stereo jobs are not read back.
+#define FRAMEBUS_FORMAT_RGBA_CPU       2
+
+// A YUV_420_888 camera image from a natively opened camera, in CPU memory with rows top first.
+// Planes are Y, U and V, with the strides reported by the camera. Published once per camera frame.
+#define FRAMEBUS_FORMAT_YUV420_CPU     3
+
+// Since version 2. Like FRAMEBUS_FORMAT_RGBA and FRAMEBUS_FORMAT_RGBA_CPU, for jobs rendering into GL_RGB10_A2 textures.
+// CPU pixels are GL_UNSIGNED_INT_2_10_10_10_REV, 4 bytes each with red in the lowest bits.
+#define FRAMEBUS_FORMAT_RGB10A2        4
+#define FRAMEBUS_FORMAT_RGB10A2_CPU    5
+
+// Since version 2. Like FRAMEBUS_FORMAT_RGBA and FRAMEBUS_FORMAT_RGBA_CPU, for jobs rendering into GL_RGBA16F textures.
+// CPU pixels are four GL_HALF_FLOAT channels, 8 bytes each. Only read back if the GPU supports reading half floats.
+#define FRAMEBUS_FORMAT_RGBA16F        6
+#define FRAMEBUS_FORMAT_RGBA16F_CPU    7
+
+// When a subscriber's queue is full, the oldest queued frame is replaced by the new one.
+#define FRAMEBUS_POLICY_DROP_OLDEST    0
+
+// When a subscriber's queue is full, new frames are dropped until it polls.
+#define FRAMEBUS_POLICY_DROP_NEWEST    1
+
+#define FRAMEBUS_MAX_PLANES            3
+
+struct FrameBusPlane {
+    const void* data;
+    int32_t rowStride;
+    int32_t pixelStride;
+};
+
+// A frame published on the bus. CPU frames are valid until the last reference is released.
+// Texture frames are overwritten when their producer renders its next frame, which references cannot prevent. Since version 2,
+// they are only delivered to callback subscribers, and are only valid during the call: retaining or releasing them does nothing,
+// so copy the texture during the callback to keep it. fence can be waited on by a context shared with Unity's.
+struct FrameBusFrame {
+    // The ID of the camera source's external texture, which identifies the camera.
+    uint32_t camera;
+    int32_t format;
+
+    // The ID of the job or plugin which published the frame.
+    uint32_t producer;
+
+    // 0 for CPU frames. Size is 0 for external textures, which have the size of the camera stream.
+    uint32_t textureId;
+    uint32_t textureTarget;
+    int32_t width;
+    int32_t height;
+    int32_t layers;
+
+    // SurfaceTexture timestamp of the camera frame, in nanoseconds.
+    int64_t timestamp;
+    uint64_t sequence;
+    float transformMatrix[16];
+
+    // GLsync signalled when the texture has been rendered, or null if the frame needs no synchronization.
+    void* fence;
+
+    // CPU planes, planeCount is 0 for texture frames.
+    struct FrameBusPlane planes[FRAMEBUS_MAX_PLANES];
+    int32_t planeCount;
+};
+
+struct FrameBusStats {
+    uint64_t delivered;
+    uint64_t dropped;
+    uint32_t queued;
+};
+
+typedef void (*FrameBusCallback)(const struct FrameBusFrame* frame, void* userData);
+typedef void (*FrameBusReleaseCallback)(const struct FrameBusFrame* frame, void* userData);
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+uint32_t getUXRQCNativeAPIVersion(void);
+
+// Subscribes to CPU frames of a camera and format with a bounded queue. Returns the subscriber ID, or 0 if the parameters are
+// invalid or format is a texture format. Queues subscribed to FRAMEBUS_ANY_FORMAT skip texture frames.
+uint32_t subscribeFrameBus(uint32_t camera, int32_t format, int32_t policy, uint32_t queueDepth);
+
+// Subscribes to frames of a camera and format with a callback, called synchronously on the publishing thread.
+// The frame is only valid during the call, unless retained.
+uint32_t subscribeFrameBusCallback(uint32_t camera, int32_t format, FrameBusCallback callback, void* userData);
+
+// Removes a subscriber and releases its queued frames. The callback is never called after this returns, so this waits for
+// calls running on other threads. A callback may unsubscribe itself.
+bool unsubscribeFrameBus(uint32_t subscriber);
+
+// Returns the oldest queued frame of a subscriber, which must be released, or null if the queue is empty.
+const struct FrameBusFrame* pollFrameBus(uint32_t subscriber);
+
+bool getFrameBusStats(uint32_t subscriber, struct FrameBusStats* stats);
+
+// Do nothing for texture frames.
+void retainFrameBusFrame(const struct FrameBusFrame* frame);
+void releaseFrameBusFrame(const struct FrameBusFrame* frame);
+
+// Publishes a copy of frame. onRelease, if not null, is called when the last reference to the frame is released.
+void publishFrameBusFrame(const struct FrameBusFrame* frame, FrameBusReleaseCallback onRelease, void* userData);
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif //UXR_QUESTCAMERA_UXRQC_NATIVEAPI_H
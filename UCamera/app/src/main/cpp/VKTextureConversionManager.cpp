@@ -0,0 +1,437 @@
+// Copyright 2026 URAV ADVANCED LEARNING SYSTEMS PRIVATE LIMITED
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mutex>
+#include <map>
+#include <cstring>
+#include <memory>
+#include <atomic>
+#include <jni.h>
+
+#include "ConverterBackend.h"
+#include "VK_Context.h"
+#include "VK_CameraSource.h"
+#include "VK_YUVConverter.h"
+#include "VK_PlaneConverter.h"
+#include "NativeLog.h"
+#include "RenderJobData.h"
+#include "IUnityInterface.h"
+#include "IUnityGraphics.h"
+#include "IUnityGraphicsVulkan.h"
+
+#define TAG "UXRQC.VKTexConvMgr"
+#define LOGI(...) NATIVE_LOG(ANDROID_LOG_INFO,  TAG, __VA_ARGS__)
+#define LOGE(...) NATIVE_LOG(ANDROID_LOG_ERROR, TAG, __VA_ARGS__)
+
+using namespace std;
+
+// Vulkan jobs always own their source, and only support JOBMODE_CONVERT.
+struct VKRenderJob {
+    VK_CameraSource* source;
+    VK_YUVConverter* converter;
+
+    uint64_t lastSeenFrame;
+    bool awaitingDispose;
+
+    // Incremented for every new frame processed by the job.
+    uint64_t sequence;
+};
+
+static map<uint32_t, VKRenderJob> g_renderJobs;
+static mutex g_renderJobsMutex;
+
+// Shared, as the camera thread may still be submitting to a converter while the render thread disposes it.
+static map<uint32_t, shared_ptr<VK_PlaneConverter>> g_planeConverters;
+static mutex g_planeConvertersMutex;
+static atomic<uint32_t> g_nextPlaneConverterId(1);
+
+//region Kotlin interface
+
+extern "C"
+JNIEXPORT jobject JNICALL
+Java_com_uralstech_uxr_questcamera_VKCaptureSessionManager_getJobSurface(JNIEnv *env,
+                                                                         jobject,
+                                                                         jint jobId) {
+
+    LOGI("Creating surface for job.");
+
+    lock_guard<mutex> lock(g_renderJobsMutex);
+    auto jobIt = g_renderJobs.find(jobId);
+    if (jobIt == g_renderJobs.end()) {
+        LOGE("Unknown job ID provided.");
+        return nullptr;
+    }
+
+    if (jobIt->second.awaitingDispose) {
+        LOGE("Cannot bind to disposing job.");
+        return nullptr;
+    }
+
+    return jobIt->second.source->surface(env);
+}
+
+extern "C"
+JNIEXPORT void JNICALL
+Java_com_uralstech_uxr_questcamera_VKCaptureSessionManager_unbindJob(JNIEnv *,
+                                                                     jobject,
+                                                                     jint jobId) {
+
+    LOGI("Unbinding surface from job.");
+
+    lock_guard<mutex> lock(g_renderJobsMutex);
+    auto jobIt = g_renderJobs.find(jobId);
+    if (jobIt == g_renderJobs.end()) {
+        LOGE("Unknown job ID provided.");
+        return;
+    }
+
+    jobIt->second.source->unbind();
+    jobIt->second.awaitingDispose = true;
+    LOGI("Surface unbound, awaiting dispose.");
+}
+
+//endregion
+
+//region Unity interface
+
+static void setupJob(void* data, const UnityVulkanRecordingState& recordingState) {
+    auto setupData = reinterpret_cast<JobSetupData*>(data);
+    uint32_t jobId = setupData->renderTexture;
+
+    lock_guard<mutex> lock(g_renderJobsMutex);
+    if (g_renderJobs.find(jobId) != g_renderJobs.end()) {
+        LOGE("Tried to register ID to multiple jobs!");
+        setupData->onDone(0, jobId);
+        return;
+    }
+
+    if (setupData->mode != JOBMODE_CONVERT || setupData->sourceJob != 0 || setupData->nativeTexture == nullptr || setupData->historyLayers != 0) {
+        LOGE("Vulkan jobs only support converting their own source into a texture.");
+        setupData->onDone(0, jobId);
+        return;
+    }
+
+    auto source = new VK_CameraSource(setupData->width, setupData->height);
+    if (!source->initialize()) {
+        LOGE("Could not initialize source.");
+        source->dispose(recordingState.currentFrameNumber);
+        delete source;
+
+        setupData->onDone(0, jobId);
+        return;
+    }
+
+    auto converter = new VK_YUVConverter(setupData->nativeTexture, setupData->width, setupData->height, setupData->cropRect);
+    if (!converter->initialize()) {
+        LOGE("Could not initialize converter.");
+        converter->dispose(recordingState.currentFrameNumber);
+        delete converter;
+
+        source->dispose(recordingState.currentFrameNumber);
+        delete source;
+
+        setupData->onDone(0, jobId);
+        return;
+    }
+
+    g_renderJobs[jobId] = {
+            source,
+            converter,
+            0,
+            false,
+            0
+    };
+
+    // There is no GL texture, so the job ID signals success.
+    LOGI("Job initialized.");
+    setupData->onDone(jobId, jobId);
+}
+
+static void completeRunJob(JobRunData* renderData, int64_t timestamp, uint64_t sequence = 0, uint32_t flags = 0) {
+    if (timestamp >= 0 && renderData->frameInfo != nullptr) {
+        JobFrameInfo* frameInfo = renderData->frameInfo;
+        frameInfo->timestamp = timestamp;
+        frameInfo->sourceTexture = 0;
+
+        // AImageReader buffers are not transformed like SurfaceTexture frames.
+        for (int i = 0; i < 16; i++) {
+            frameInfo->transformMatrix[i] = (i % 5 == 0) ? 1.0f : 0.0f;
+        }
+
+        frameInfo->sequence = sequence;
+        frameInfo->droppedFrames = 0;
+        frameInfo->flags = flags;
+        frameInfo->historyLayer = -1;
+    }
+
+    renderData->onDone(timestamp, renderData->renderTexture);
+}
+
+static void runJob(void* data, const UnityVulkanRecordingState& recordingState) {
+    auto renderData = reinterpret_cast<JobRunData*>(data);
+
+    lock_guard<mutex> lock(g_renderJobsMutex);
+    auto jobIt = g_renderJobs.find(renderData->renderTexture);
+    if (jobIt == g_renderJobs.end()) {
+        LOGE("Unknown job ID provided.");
+        completeRunJob(renderData, -1);
+        return;
+    }
+
+    VKRenderJob& job = jobIt->second;
+    if (job.awaitingDispose) {
+        LOGE("Cannot run disposing job.");
+        completeRunJob(renderData, -1);
+        return;
+    }
+
+    if (!job.source->update(recordingState.currentFrameNumber)) {
+        completeRunJob(renderData, -1);
+        return;
+    }
+
+    // The texture still holds the last conversion.
+    if (job.source->frameIndex() == job.lastSeenFrame) {
+        completeRunJob(renderData, job.source->timestamp(), job.sequence, FRAMEFLAG_REPEATED);
+        return;
+    }
+
+    if (!job.converter->render(*job.source, recordingState)) {
+        LOGE("Could not render frame.");
+        completeRunJob(renderData, -1);
+        return;
+    }
+
+    job.lastSeenFrame = job.source->frameIndex();
+    job.sequence++;
+    completeRunJob(renderData, job.source->timestamp(), job.sequence);
+}
+
+static void disposeJob(void* data, const UnityVulkanRecordingState& recordingState) {
+    auto disposeData = reinterpret_cast<JobDisposeData*>(data);
+    uint32_t jobId = disposeData->renderTexture;
+
+    lock_guard<mutex> lock(g_renderJobsMutex);
+    auto jobIt = g_renderJobs.find(jobId);
+    if (jobIt == g_renderJobs.end()) {
+        LOGE("Unknown job ID provided.");
+        disposeData->onDone(false, jobId);
+        return;
+    }
+
+    VKRenderJob& job = jobIt->second;
+    if (job.source->isBound()) {
+        LOGE("Cannot dispose job with active source surface.");
+        disposeData->onDone(false, jobId);
+        return;
+    }
+
+    // GPU objects are destroyed once the frames which may still use them have finished.
+    job.converter->dispose(recordingState.currentFrameNumber);
+    delete job.converter;
+
+    job.source->dispose(recordingState.currentFrameNumber);
+    delete job.source;
+
+    g_renderJobs.erase(jobIt);
+    LOGI("Job successfully disposed.");
+
+    disposeData->onDone(true, jobId);
+}
+
+// Records into Unity's current command buffer, and collects the objects of finished frames first.
+static bool beginRecording(UnityVulkanRecordingState& recordingState) {
+    const VK_Context* context = vulkanContext();
+    if (context == nullptr || !context->graphics->CommandRecordingState(&recordingState, kUnityVulkanGraphicsQueueAccess_DontCare)) {
+        LOGE("Vulkan is not available.");
+        return false;
+    }
+
+    collectVulkanGarbage(recordingState.safeFrameNumber);
+    return true;
+}
+
+class VKConverterBackend : public ConverterBackend {
+
+public:
+    ~VKConverterBackend() override {
+        shutdownVulkanContext();
+    }
+
+    int32_t type() const override {
+        return BACKEND_VULKAN;
+    }
+
+    void setupJob(JobSetupData* setupData) override {
+        UnityVulkanRecordingState recordingState;
+        if (!beginRecording(recordingState)) {
+            setupData->onDone(0, setupData->renderTexture);
+            return;
+        }
+
+        ::setupJob(setupData, recordingState);
+    }
+
+    void runJob(JobRunData* runData) override {
+        UnityVulkanRecordingState recordingState;
+        if (!beginRecording(recordingState)) {
+            completeRunJob(runData, -1);
+            return;
+        }
+
+        ::runJob(runData, recordingState);
+    }
+
+    void disposeJob(JobDisposeData* disposeData) override {
+        UnityVulkanRecordingState recordingState;
+        if (!beginRecording(recordingState)) {
+            disposeData->onDone(false, disposeData->renderTexture);
+            return;
+        }
+
+        ::disposeJob(disposeData, recordingState);
+    }
+};
+
+ConverterBackend* createVulkanConverterBackend(IUnityInterfaces* unityInterfaces) {
+    IUnityGraphicsVulkan* graphics = unityInterfaces->Get<IUnityGraphicsVulkan>();
+    if (graphics == nullptr || !initializeVulkanContext(graphics)) {
+        return nullptr;
+    }
+
+    // Jobs record render passes of their own into Unity's command buffer.
+    UnityVulkanPluginEventConfig eventConfig = {};
+    eventConfig.renderPassPrecondition = kUnityVulkanRenderPass_EnsureOutside;
+    eventConfig.graphicsQueueAccess = kUnityVulkanGraphicsQueueAccess_DontCare;
+    eventConfig.flags = kUnityVulkanEventConfigFlag_ModifiesCommandBuffersState;
+
+    graphics->ConfigureEvent(EVENTID_SETUP_JOB, &eventConfig);
+    graphics->ConfigureEvent(EVENTID_RUN_JOB, &eventConfig);
+    graphics->ConfigureEvent(EVENTID_DISPOSE_JOB, &eventConfig);
+
+    return new VKConverterBackend();
+}
+
+// The event data is the converter's ID, not a pointer.
+static void UNITY_INTERFACE_API managePlaneConverter(int eventId, void* data) {
+    auto converterId = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(data));
+
+    UnityVulkanRecordingState recordingState;
+    bool recording = beginRecording(recordingState);
+
+    lock_guard<mutex> lock(g_planeConvertersMutex);
+    auto converterIt = g_planeConverters.find(converterId);
+    if (converterIt == g_planeConverters.end()) {
+        LOGE("Unknown plane converter ID provided.");
+        return;
+    }
+
+    if (!recording) {
+        if (eventId != EVENTID_DISPOSE_JOB) {
+            return;
+        }
+
+        if (vulkanContext() == nullptr) {
+            // The device is gone, and its objects with it.
+            g_planeConverters.erase(converterIt);
+            LOGI("Plane converter dropped after Vulkan shut down.");
+        } else if (!converterIt->second->hasDispatched()) {
+            // Nothing has been recorded with the converter's objects yet.
+            converterIt->second->dispose(0);
+            g_planeConverters.erase(converterIt);
+            LOGI("Plane converter disposed.");
+        } else {
+            LOGE("Could not dispose plane converter, it is kept for another dispose event.");
+        }
+
+        return;
+    }
+
+    switch (eventId) {
+        case EVENTID_RUN_JOB:
+            converterIt->second->dispatch(recordingState);
+            break;
+
+        case EVENTID_DISPOSE_JOB:
+            converterIt->second->dispose(recordingState.currentFrameNumber);
+            g_planeConverters.erase(converterIt);
+            LOGI("Plane converter disposed.");
+            break;
+
+        default:
+            LOGE("Unknown event '%i'", eventId);
+            break;
+    }
+}
+
+extern "C" bool UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API
+isVKConverterAvailable() {
+    return vulkanContext() != nullptr;
+}
+
+// Creates a converter for CPU-side planes of a PLANE_SAMPLES_* layout, writing a PLANE_OUTPUT_* texture.
+// Returns its ID, or 0 if it could not be created.
+extern "C" uint32_t UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API
+createVKPlaneConverter(void* nativeTexture, int32_t width, int32_t height, int32_t sampleFormat, int32_t outputFormat) {
+    if (vulkanContext() == nullptr || nativeTexture == nullptr) {
+        LOGE("Cannot create plane converter without Vulkan or a texture.");
+        return 0;
+    }
+
+    auto converter = make_shared<VK_PlaneConverter>(nativeTexture, width, height, sampleFormat, outputFormat);
+    if (!converter->initialize()) {
+        LOGE("Could not initialize plane converter.");
+
+        // Nothing has been recorded with the converter's objects yet.
+        converter->dispose(0);
+        return 0;
+    }
+
+    uint32_t converterId = g_nextPlaneConverterId.fetch_add(1);
+
+    lock_guard<mutex> lock(g_planeConvertersMutex);
+    g_planeConverters[converterId] = converter;
+    return converterId;
+}
+
+// Copies a frame's planes into the converter's staging memory. Called from the camera thread which owns the planes.
+extern "C" bool UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API
+submitVKPlaneFrame(uint32_t converterId,
+                   const uint8_t* yPlane, int64_t yPlaneSize,
+                   const uint8_t* uPlane, const uint8_t* vPlane, int64_t uvPlaneSize,
+                   int32_t yRowStride, int32_t uvRowStride, int32_t uvPixelStride,
+                   int64_t timestamp) {
+
+    shared_ptr<VK_PlaneConverter> converter;
+    {
+        lock_guard<mutex> lock(g_planeConvertersMutex);
+        auto converterIt = g_planeConverters.find(converterId);
+        if (converterIt == g_planeConverters.end()) {
+            return false;
+        }
+
+        converter = converterIt->second;
+    }
+
+    // The copy happens outside the lock, so it never stalls the render thread.
+    return converter->submit(yPlane, (size_t)yPlaneSize, uPlane, vPlane, (size_t)uvPlaneSize,
+                             yRowStride, uvRowStride, uvPixelStride, timestamp);
+}
+
+extern "C" UnityRenderingEventAndData UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API
+getVKPlaneConverterEvent() {
+    return managePlaneConverter;
+}
+
+//endregion
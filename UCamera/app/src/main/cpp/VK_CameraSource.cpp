@@ -0,0 +1,413 @@
+// Copyright 2026 URAV ADVANCED LEARNING SYSTEMS PRIVATE LIMITED
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "VK_CameraSource.h"
+#include "ClockMapper.h"
+#include "NativeLog.h"
+#include <android/native_window_jni.h>
+#include <vector>
+
+#define TAG "UXRQC.VKCameraSource"
+#define LOGI(...) NATIVE_LOG(ANDROID_LOG_INFO,  TAG, __VA_ARGS__)
+#define LOGE(...) NATIVE_LOG(ANDROID_LOG_ERROR, TAG, __VA_ARGS__)
+
+// Enough for the current image, the images still sampled by in-flight frames, and one being written by the camera.
+#define MAX_READER_IMAGES 6
+
+// Imports not sampled for this many frames are destroyed, as the reader no longer cycles their buffers.
+#define IMPORT_EVICTION_FRAMES 30
+
+using namespace std;
+
+VK_CameraSource::VK_CameraSource(int32_t width, int32_t height) {
+    _width = width;
+    _height = height;
+
+    _reader = nullptr;
+    _window = nullptr;
+    _isBound = false;
+
+    _currentAImage = nullptr;
+    _current = nullptr;
+
+    _externalFormat = 0;
+    _conversion = VK_NULL_HANDLE;
+    _sampler = VK_NULL_HANDLE;
+
+    _timestamp = -1;
+    _frameIndex = 0;
+    _disposed = false;
+}
+
+bool VK_CameraSource::initialize() {
+    media_status_t status = AImageReader_newWithUsage(
+            _width, _height, AIMAGE_FORMAT_PRIVATE, AHARDWAREBUFFER_USAGE_GPU_SAMPLED_IMAGE, MAX_READER_IMAGES, &_reader);
+
+    if (status != AMEDIA_OK) {
+        LOGE("Could not create image reader, error: %i", status);
+        _reader = nullptr;
+        return false;
+    }
+
+    status = AImageReader_getWindow(_reader, &_window);
+    if (status != AMEDIA_OK) {
+        LOGE("Could not get image reader window, error: %i", status);
+        AImageReader_delete(_reader);
+        _reader = nullptr;
+        return false;
+    }
+
+    LOGI("Image reader created.");
+    return true;
+}
+
+void VK_CameraSource::dispose(uint64_t currentFrameNumber) {
+    if (_disposed) {
+        return;
+    }
+
+    _disposed = true;
+    for (auto& entry : _imports) {
+        destroyImport(entry.first, entry.second, currentFrameNumber);
+    }
+
+    _imports.clear();
+    _current = nullptr;
+
+    const VK_Context* context = vulkanContext();
+    VkDevice device = context->instance.device;
+    VkSamplerYcbcrConversion conversion = _conversion;
+    VkSampler sampler = _sampler;
+
+    // Deleting the reader also releases its acquired images.
+    AImageReader* reader = _reader;
+    deferVulkanDestroy(currentFrameNumber, [context, device, conversion, sampler, reader]() {
+        if (sampler != VK_NULL_HANDLE) {
+            vkDestroySampler(device, sampler, nullptr);
+        }
+
+        if (conversion != VK_NULL_HANDLE) {
+            context->destroySamplerYcbcrConversion(device, conversion, nullptr);
+        }
+
+        if (reader != nullptr) {
+            AImageReader_delete(reader);
+        }
+    });
+
+    _conversion = VK_NULL_HANDLE;
+    _sampler = VK_NULL_HANDLE;
+    _currentAImage = nullptr;
+    _reader = nullptr;
+    _window = nullptr;
+
+    LOGI("Source disposed.");
+}
+
+jobject VK_CameraSource::surface(JNIEnv* env) {
+    lock_guard<mutex> lock(_bindingMutex);
+    if (_window == nullptr || _isBound) {
+        LOGE("Cannot bind source which is disposed or already bound.");
+        return nullptr;
+    }
+
+    jobject surface = ANativeWindow_toSurface(env, _window);
+    if (surface == nullptr) {
+        LOGE("Could not create surface for image reader.");
+        return nullptr;
+    }
+
+    _isBound = true;
+    return surface;
+}
+
+void VK_CameraSource::unbind() {
+    lock_guard<mutex> lock(_bindingMutex);
+    _isBound = false;
+}
+
+bool VK_CameraSource::isBound() {
+    lock_guard<mutex> lock(_bindingMutex);
+    return _isBound;
+}
+
+bool VK_CameraSource::update(uint64_t currentFrameNumber) {
+    lock_guard<mutex> lock(_bindingMutex);
+    if (!_isBound || _reader == nullptr) {
+        return false;
+    }
+
+    evictImports(currentFrameNumber);
+
+    AImage* aImage = nullptr;
+    media_status_t status = AImageReader_acquireLatestImage(_reader, &aImage);
+    if (status == AMEDIA_IMGREADER_NO_BUFFER_AVAILABLE || status == AMEDIA_IMGREADER_MAX_IMAGES_ACQUIRED) {
+        // Nothing new from the camera, or every image is still in flight. The last image (if any) is still current.
+        if (_current != nullptr) {
+            _current->lastUsedFrame = currentFrameNumber;
+        }
+
+        return _current != nullptr;
+    }
+
+    if (status != AMEDIA_OK) {
+        LOGE("Could not acquire image, error: %i", status);
+        return false;
+    }
+
+    AHardwareBuffer* buffer = nullptr;
+    int64_t timestamp = -1;
+    if (AImage_getHardwareBuffer(aImage, &buffer) != AMEDIA_OK || AImage_getTimestamp(aImage, &timestamp) != AMEDIA_OK) {
+        LOGE("Could not read acquired image.");
+        AImage_delete(aImage);
+        return false;
+    }
+
+    VK_ImportedImage* imported = import(buffer);
+    if (imported == nullptr) {
+        AImage_delete(aImage);
+        return false;
+    }
+
+    // The previous image may still be sampled by frames in flight.
+    if (_currentAImage != nullptr) {
+        AImage* previous = _currentAImage;
+        deferVulkanDestroy(currentFrameNumber, [previous]() {
+            AImage_delete(previous);
+        });
+    }
+
+    _currentAImage = aImage;
+    _current = imported;
+    _current->lastUsedFrame = currentFrameNumber;
+
+    _timestamp = timestamp;
+    _frameIndex++;
+
+    observeCameraFrame(_timestamp);
+    return true;
+}
+
+bool VK_CameraSource::createConversion(const VkAndroidHardwareBufferFormatPropertiesANDROID& formatProperties) {
+    const VK_Context* context = vulkanContext();
+    VkDevice device = context->instance.device;
+
+    VkExternalFormatANDROID externalFormat = {};
+    externalFormat.sType = VK_STRUCTURE_TYPE_EXTERNAL_FORMAT_ANDROID;
+    externalFormat.externalFormat = formatProperties.externalFormat;
+
+    bool supportsLinear = (formatProperties.formatFeatures & VK_FORMAT_FEATURE_SAMPLED_IMAGE_YCBCR_CONVERSION_LINEAR_FILTER_BIT) != 0;
+
+    VkSamplerYcbcrConversionCreateInfo conversionInfo = {};
+    conversionInfo.sType = VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_CREATE_INFO;
+    conversionInfo.pNext = &externalFormat;
+    conversionInfo.format = VK_FORMAT_UNDEFINED;
+    conversionInfo.ycbcrModel = formatProperties.suggestedYcbcrModel;
+    conversionInfo.ycbcrRange = formatProperties.suggestedYcbcrRange;
+    conversionInfo.components = formatProperties.samplerYcbcrConversionComponents;
+    conversionInfo.xChromaOffset = formatProperties.suggestedXChromaOffset;
+    conversionInfo.yChromaOffset = formatProperties.suggestedYChromaOffset;
+    conversionInfo.chromaFilter = supportsLinear ? VK_FILTER_LINEAR : VK_FILTER_NEAREST;
+    conversionInfo.forceExplicitReconstruction = VK_FALSE;
+
+    VkSamplerYcbcrConversion conversion;
+    if (context->createSamplerYcbcrConversion(device, &conversionInfo, nullptr, &conversion) != VK_SUCCESS) {
+        LOGE("Could not create YCbCr conversion.");
+        return false;
+    }
+
+    VkSamplerYcbcrConversionInfo samplerConversionInfo = {};
+    samplerConversionInfo.sType = VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_INFO;
+    samplerConversionInfo.conversion = conversion;
+
+    VkSamplerCreateInfo samplerInfo = {};
+    samplerInfo.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
+    samplerInfo.pNext = &samplerConversionInfo;
+    samplerInfo.magFilter = supportsLinear ? VK_FILTER_LINEAR : VK_FILTER_NEAREST;
+    samplerInfo.minFilter = samplerInfo.magFilter;
+    samplerInfo.mipmapMode = VK_SAMPLER_MIPMAP_MODE_NEAREST;
+    samplerInfo.addressModeU = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+    samplerInfo.addressModeV = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+    samplerInfo.addressModeW = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+    samplerInfo.unnormalizedCoordinates = VK_FALSE;
+
+    VkSampler sampler;
+    if (vkCreateSampler(device, &samplerInfo, nullptr, &sampler) != VK_SUCCESS) {
+        LOGE("Could not create YCbCr sampler.");
+        context->destroySamplerYcbcrConversion(device, conversion, nullptr);
+        return false;
+    }
+
+    _conversion = conversion;
+    _sampler = sampler;
+    _externalFormat = formatProperties.externalFormat;
+
+    LOGI("YCbCr conversion created (external format: %llu, model: %i, range: %i).",
+         (unsigned long long)_externalFormat, formatProperties.suggestedYcbcrModel, formatProperties.suggestedYcbcrRange);
+    return true;
+}
+
+VK_ImportedImage* VK_CameraSource::import(AHardwareBuffer* buffer) {
+    auto importIt = _imports.find(buffer);
+    if (importIt != _imports.end()) {
+        return &importIt->second;
+    }
+
+    const VK_Context* context = vulkanContext();
+    VkDevice device = context->instance.device;
+
+    VkAndroidHardwareBufferFormatPropertiesANDROID formatProperties = {};
+    formatProperties.sType = VK_STRUCTURE_TYPE_ANDROID_HARDWARE_BUFFER_FORMAT_PROPERTIES_ANDROID;
+
+    VkAndroidHardwareBufferPropertiesANDROID bufferProperties = {};
+    bufferProperties.sType = VK_STRUCTURE_TYPE_ANDROID_HARDWARE_BUFFER_PROPERTIES_ANDROID;
+    bufferProperties.pNext = &formatProperties;
+
+    if (context->getAndroidHardwareBufferProperties(device, buffer, &bufferProperties) != VK_SUCCESS) {
+        LOGE("Could not get hardware buffer properties.");
+        return nullptr;
+    }
+
+    // Every buffer of a reader has the same format, so this only happens once.
+    if (_sampler == VK_NULL_HANDLE || formatProperties.externalFormat != _externalFormat) {
+        if (_sampler != VK_NULL_HANDLE) {
+            LOGE("Camera buffer format changed, which is not supported.");
+            return nullptr;
+        }
+
+        if (!createConversion(formatProperties)) {
+            return nullptr;
+        }
+    }
+
+    AHardwareBuffer_Desc description;
+    AHardwareBuffer_describe(buffer, &description);
+
+    VkExternalFormatANDROID externalFormat = {};
+    externalFormat.sType = VK_STRUCTURE_TYPE_EXTERNAL_FORMAT_ANDROID;
+    externalFormat.externalFormat = formatProperties.externalFormat;
+
+    VkExternalMemoryImageCreateInfo externalMemoryInfo = {};
+    externalMemoryInfo.sType = VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_IMAGE_CREATE_INFO;
+    externalMemoryInfo.pNext = &externalFormat;
+    externalMemoryInfo.handleTypes = VK_EXTERNAL_MEMORY_HANDLE_TYPE_ANDROID_HARDWARE_BUFFER_BIT_ANDROID;
+
+    VkImageCreateInfo imageInfo = {};
+    imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+    imageInfo.pNext = &externalMemoryInfo;
+    imageInfo.imageType = VK_IMAGE_TYPE_2D;
+    imageInfo.format = VK_FORMAT_UNDEFINED;
+    imageInfo.extent = { description.width, description.height, 1 };
+    imageInfo.mipLevels = 1;
+    imageInfo.arrayLayers = 1;
+    imageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+    imageInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
+    imageInfo.usage = VK_IMAGE_USAGE_SAMPLED_BIT;
+    imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+
+    VK_ImportedImage imported = {};
+    if (vkCreateImage(device, &imageInfo, nullptr, &imported.image) != VK_SUCCESS) {
+        LOGE("Could not create image for hardware buffer.");
+        return nullptr;
+    }
+
+    VkImportAndroidHardwareBufferInfoANDROID importInfo = {};
+    importInfo.sType = VK_STRUCTURE_TYPE_IMPORT_ANDROID_HARDWARE_BUFFER_INFO_ANDROID;
+    importInfo.buffer = buffer;
+
+    VkMemoryDedicatedAllocateInfo dedicatedInfo = {};
+    dedicatedInfo.sType = VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO;
+    dedicatedInfo.pNext = &importInfo;
+    dedicatedInfo.image = imported.image;
+
+    uint32_t memoryTypeIndex = 0;
+    while (memoryTypeIndex < 32 && (bufferProperties.memoryTypeBits & (1u << memoryTypeIndex)) == 0) {
+        memoryTypeIndex++;
+    }
+
+    VkMemoryAllocateInfo allocateInfo = {};
+    allocateInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    allocateInfo.pNext = &dedicatedInfo;
+    allocateInfo.allocationSize = bufferProperties.allocationSize;
+    allocateInfo.memoryTypeIndex = memoryTypeIndex;
+
+    if (vkAllocateMemory(device, &allocateInfo, nullptr, &imported.memory) != VK_SUCCESS) {
+        LOGE("Could not import hardware buffer memory.");
+        vkDestroyImage(device, imported.image, nullptr);
+        return nullptr;
+    }
+
+    if (vkBindImageMemory(device, imported.image, imported.memory, 0) != VK_SUCCESS) {
+        LOGE("Could not bind hardware buffer memory.");
+        vkFreeMemory(device, imported.memory, nullptr);
+        vkDestroyImage(device, imported.image, nullptr);
+        return nullptr;
+    }
+
+    VkSamplerYcbcrConversionInfo conversionInfo = {};
+    conversionInfo.sType = VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_INFO;
+    conversionInfo.pNext = &externalFormat;
+    conversionInfo.conversion = _conversion;
+
+    VkImageViewCreateInfo viewInfo = {};
+    viewInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+    viewInfo.pNext = &conversionInfo;
+    viewInfo.image = imported.image;
+    viewInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
+    viewInfo.format = VK_FORMAT_UNDEFINED;
+    viewInfo.components = { VK_COMPONENT_SWIZZLE_IDENTITY, VK_COMPONENT_SWIZZLE_IDENTITY, VK_COMPONENT_SWIZZLE_IDENTITY, VK_COMPONENT_SWIZZLE_IDENTITY };
+    viewInfo.subresourceRange = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1 };
+
+    if (vkCreateImageView(device, &viewInfo, nullptr, &imported.view) != VK_SUCCESS) {
+        LOGE("Could not create view for hardware buffer.");
+        vkFreeMemory(device, imported.memory, nullptr);
+        vkDestroyImage(device, imported.image, nullptr);
+        return nullptr;
+    }
+
+    // Held so the buffer outlives the AImage it came from, for as long as it is cached.
+    AHardwareBuffer_acquire(buffer);
+
+    LOGI("Imported hardware buffer (%u, %u).", description.width, description.height);
+    return &(_imports[buffer] = imported);
+}
+
+void VK_CameraSource::evictImports(uint64_t currentFrameNumber) {
+    vector<AHardwareBuffer*> evicted;
+    for (auto& entry : _imports) {
+        if (&entry.second != _current && entry.second.lastUsedFrame + IMPORT_EVICTION_FRAMES < currentFrameNumber) {
+            evicted.push_back(entry.first);
+        }
+    }
+
+    for (AHardwareBuffer* buffer : evicted) {
+        destroyImport(buffer, _imports[buffer], currentFrameNumber);
+        _imports.erase(buffer);
+    }
+}
+
+void VK_CameraSource::destroyImport(AHardwareBuffer* buffer, const VK_ImportedImage& imported, uint64_t frameNumber) {
+    VkDevice device = vulkanContext()->instance.device;
+    VkImage image = imported.image;
+    VkDeviceMemory memory = imported.memory;
+    VkImageView view = imported.view;
+
+    deferVulkanDestroy(frameNumber, [device, image, memory, view, buffer]() {
+        vkDestroyImageView(device, view, nullptr);
+        vkDestroyImage(device, image, nullptr);
+        vkFreeMemory(device, memory, nullptr);
+        AHardwareBuffer_release(buffer);
+    });
+}
@@ -0,0 +1,89 @@
+// Copyright 2026 URAV ADVANCED LEARNING SYSTEMS PRIVATE LIMITED
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef UXR_QUESTCAMERA_VK_CAMERASOURCE_H
+#define UXR_QUESTCAMERA_VK_CAMERASOURCE_H
+
+#include <media/NdkImageReader.h>
+#include <android/hardware_buffer.h>
+#include <jni.h>
+#include <map>
+#include <mutex>
+
+#include "VK_ImageSource.h"
+
+// Owns the AImageReader a camera session renders into, and imports its buffers into Vulkan.
+// The Vulkan counterpart to GLES_CameraSource: instead of latching a SurfaceTexture, the newest
+// AImage's AHardwareBuffer is imported without copies and sampled through a YCbCr conversion.
+class VK_CameraSource : public VK_ImageSource {
+
+public:
+    VK_CameraSource(int32_t width, int32_t height);
+
+    bool initialize();
+
+    // Resources which may still be in use are destroyed once currentFrameNumber has finished on the GPU.
+    void dispose(uint64_t currentFrameNumber);
+
+    // Creates the Java Surface for the camera session. Returns nullptr on failure.
+    jobject surface(JNIEnv* env);
+    void unbind();
+    bool isBound();
+
+    // Acquires the newest camera image if one arrived since the last call. Must be called on the render thread.
+    // Returns false if the source is unbound, errored, or has not received a frame yet.
+    bool update(uint64_t currentFrameNumber);
+
+    // The latest image, valid until the next update(). Camera buffers are owned by the foreign queue family.
+    const VK_ImportedImage* image() const override { return _current; }
+    VkSampler sampler() const override { return _sampler; }
+    uint32_t ownerQueueFamily() const override { return VK_QUEUE_FAMILY_FOREIGN_EXT; }
+
+    int64_t timestamp() const { return _timestamp; }
+
+    // Incremented each time update() acquires a new image, so consumers can skip redundant work.
+    uint64_t frameIndex() const { return _frameIndex; }
+
+private:
+    bool createConversion(const VkAndroidHardwareBufferFormatPropertiesANDROID& formatProperties);
+    VK_ImportedImage* import(AHardwareBuffer* buffer);
+    void evictImports(uint64_t currentFrameNumber);
+    void destroyImport(AHardwareBuffer* buffer, const VK_ImportedImage& imported, uint64_t frameNumber);
+
+    int32_t _width; int32_t _height;
+
+    std::mutex _bindingMutex;
+    AImageReader* _reader;
+    ANativeWindow* _window;
+    bool _isBound;
+
+    // Images stay acquired until the frame sampling them has finished on the GPU.
+    AImage* _currentAImage;
+    VK_ImportedImage* _current;
+
+    // Keyed by acquired AHardwareBuffers, which the reader recycles between images.
+    std::map<AHardwareBuffer*, VK_ImportedImage> _imports;
+
+    uint64_t _externalFormat;
+    VkSamplerYcbcrConversion _conversion;
+    VkSampler _sampler;
+
+    int64_t _timestamp;
+    uint64_t _frameIndex;
+
+    bool _disposed;
+};
+
+
+#endif //UXR_QUESTCAMERA_VK_CAMERASOURCE_H
@@ -0,0 +1,206 @@
+// Copyright 2026 URAV ADVANCED LEARNING SYSTEMS PRIVATE LIMITED
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "VK_Context.h"
+#include "NativeLog.h"
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#define TAG "UXRQC.VKContext"
+#define LOGI(...) NATIVE_LOG(ANDROID_LOG_INFO,  TAG, __VA_ARGS__)
+#define LOGE(...) NATIVE_LOG(ANDROID_LOG_ERROR, TAG, __VA_ARGS__)
+
+using namespace std;
+
+static VK_Context s_context = {};
+static bool s_initialized = false;
+
+static deque<pair<uint64_t, function<void()>>> s_garbage;
+static mutex s_garbageMutex;
+
+static PFN_vkGetInstanceProcAddr s_getInstanceProcAddr = nullptr;
+static PFN_vkCreateDevice s_createDevice = nullptr;
+static PFN_vkEnumerateDeviceExtensionProperties s_enumerateDeviceExtensionProperties = nullptr;
+
+// Needed to import camera AHardwareBuffers and sample their YUV formats.
+static const char* const REQUIRED_DEVICE_EXTENSIONS[] = {
+#ifdef __ANDROID__
+        VK_ANDROID_EXTERNAL_MEMORY_ANDROID_HARDWARE_BUFFER_EXTENSION_NAME,
+#endif
+        VK_EXT_QUEUE_FAMILY_FOREIGN_EXTENSION_NAME,
+        VK_KHR_EXTERNAL_MEMORY_EXTENSION_NAME,
+        VK_KHR_DEDICATED_ALLOCATION_EXTENSION_NAME,
+        VK_KHR_GET_MEMORY_REQUIREMENTS_2_EXTENSION_NAME,
+        VK_KHR_SAMPLER_YCBCR_CONVERSION_EXTENSION_NAME,
+        VK_KHR_MAINTENANCE1_EXTENSION_NAME,
+        VK_KHR_BIND_MEMORY_2_EXTENSION_NAME,
+};
+
+static VKAPI_ATTR VkResult VKAPI_CALL createDevice(VkPhysicalDevice physicalDevice, const VkDeviceCreateInfo* createInfo,
+                                                   const VkAllocationCallbacks* allocator, VkDevice* device) {
+    uint32_t supportedCount = 0;
+    s_enumerateDeviceExtensionProperties(physicalDevice, nullptr, &supportedCount, nullptr);
+    vector<VkExtensionProperties> supported(supportedCount);
+    s_enumerateDeviceExtensionProperties(physicalDevice, nullptr, &supportedCount, supported.data());
+
+    vector<const char*> extensions(createInfo->ppEnabledExtensionNames, createInfo->ppEnabledExtensionNames + createInfo->enabledExtensionCount);
+    for (const char* required : REQUIRED_DEVICE_EXTENSIONS) {
+        bool isEnabled = false;
+        for (const char* extension : extensions) {
+            isEnabled |= strcmp(extension, required) == 0;
+        }
+
+        bool isSupported = false;
+        for (const VkExtensionProperties& properties : supported) {
+            isSupported |= strcmp(properties.extensionName, required) == 0;
+        }
+
+        if (!isEnabled && isSupported) {
+            extensions.push_back(required);
+        } else if (!isSupported) {
+            LOGE("Device extension %s is not supported.", required);
+        }
+    }
+
+    // Unity may already chain feature structs, in which case the YCbCr feature is enabled in them instead.
+    bool hasFeatureStruct = false;
+    for (auto next = static_cast<const VkBaseOutStructure*>(createInfo->pNext); next != nullptr; next = next->pNext) {
+        if (next->sType == VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SAMPLER_YCBCR_CONVERSION_FEATURES) {
+            const_cast<VkPhysicalDeviceSamplerYcbcrConversionFeatures*>(
+                    reinterpret_cast<const VkPhysicalDeviceSamplerYcbcrConversionFeatures*>(next))->samplerYcbcrConversion = VK_TRUE;
+            hasFeatureStruct = true;
+        } else if (next->sType == VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_1_FEATURES) {
+            const_cast<VkPhysicalDeviceVulkan11Features*>(
+                    reinterpret_cast<const VkPhysicalDeviceVulkan11Features*>(next))->samplerYcbcrConversion = VK_TRUE;
+            hasFeatureStruct = true;
+        }
+    }
+
+    VkPhysicalDeviceSamplerYcbcrConversionFeatures ycbcrFeatures = {};
+    ycbcrFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SAMPLER_YCBCR_CONVERSION_FEATURES;
+    ycbcrFeatures.pNext = const_cast<void*>(createInfo->pNext);
+    ycbcrFeatures.samplerYcbcrConversion = VK_TRUE;
+
+    VkDeviceCreateInfo modifiedCreateInfo = *createInfo;
+    modifiedCreateInfo.enabledExtensionCount = (uint32_t)extensions.size();
+    modifiedCreateInfo.ppEnabledExtensionNames = extensions.data();
+    if (!hasFeatureStruct) {
+        modifiedCreateInfo.pNext = &ycbcrFeatures;
+    }
+
+    VkResult result = s_createDevice(physicalDevice, &modifiedCreateInfo, allocator, device);
+    if (result != VK_SUCCESS) {
+        // Fall back to Unity's own configuration, the Vulkan converters will report themselves unsupported.
+        LOGE("Could not create device with converter extensions (%i), retrying without them.", result);
+        result = s_createDevice(physicalDevice, createInfo, allocator, device);
+    }
+
+    return result;
+}
+
+static VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL getInstanceProcAddr(VkInstance instance, const char* name) {
+    if (strcmp(name, "vkCreateDevice") == 0) {
+        s_createDevice = reinterpret_cast<PFN_vkCreateDevice>(s_getInstanceProcAddr(instance, name));
+        s_enumerateDeviceExtensionProperties = reinterpret_cast<PFN_vkEnumerateDeviceExtensionProperties>(
+                s_getInstanceProcAddr(instance, "vkEnumerateDeviceExtensionProperties"));
+
+        return reinterpret_cast<PFN_vkVoidFunction>(createDevice);
+    }
+
+    return s_getInstanceProcAddr(instance, name);
+}
+
+static PFN_vkGetInstanceProcAddr UNITY_INTERFACE_API onVulkanInitialization(PFN_vkGetInstanceProcAddr getInstanceProcAddr, void*) {
+    s_getInstanceProcAddr = getInstanceProcAddr;
+    return &::getInstanceProcAddr;
+}
+
+bool interceptVulkanInitialization(IUnityGraphicsVulkan* graphics) {
+    if (!graphics->InterceptInitialization(onVulkanInitialization, nullptr)) {
+        LOGE("Could not intercept Vulkan initialization, camera buffers may not be importable.");
+        return false;
+    }
+
+    return true;
+}
+
+bool initializeVulkanContext(IUnityGraphicsVulkan* graphics) {
+    VK_Context context = {};
+    context.graphics = graphics;
+    context.instance = graphics->Instance();
+
+    VkDevice device = context.instance.device;
+#ifdef __ANDROID__
+    context.getAndroidHardwareBufferProperties = reinterpret_cast<PFN_vkGetAndroidHardwareBufferPropertiesANDROID>(
+            vkGetDeviceProcAddr(device, "vkGetAndroidHardwareBufferPropertiesANDROID"));
+#endif
+    context.createSamplerYcbcrConversion = reinterpret_cast<PFN_vkCreateSamplerYcbcrConversion>(
+            vkGetDeviceProcAddr(device, "vkCreateSamplerYcbcrConversion"));
+    context.destroySamplerYcbcrConversion = reinterpret_cast<PFN_vkDestroySamplerYcbcrConversion>(
+            vkGetDeviceProcAddr(device, "vkDestroySamplerYcbcrConversion"));
+
+    // Unity only enables the extensions it is asked for, so these are missing if the device or Unity doesn't support them.
+#ifdef __ANDROID__
+    if (context.getAndroidHardwareBufferProperties == nullptr) {
+        LOGE("VK_ANDROID_external_memory_android_hardware_buffer is not enabled.");
+        return false;
+    }
+#endif
+
+    if (context.createSamplerYcbcrConversion == nullptr || context.destroySamplerYcbcrConversion == nullptr) {
+        LOGE("Sampler YCbCr conversion is not supported.");
+        return false;
+    }
+
+    s_context = context;
+    s_initialized = true;
+
+    LOGI("Vulkan context initialized.");
+    return true;
+}
+
+void shutdownVulkanContext() {
+    if (!s_initialized) {
+        return;
+    }
+
+    // The device is idle when Unity shuts it down, so everything can be destroyed.
+    collectVulkanGarbage(UINT64_MAX);
+
+    s_initialized = false;
+    s_context = {};
+    LOGI("Vulkan context shut down.");
+}
+
+const VK_Context* vulkanContext() {
+    return s_initialized ? &s_context : nullptr;
+}
+
+void deferVulkanDestroy(uint64_t frameNumber, function<void()> destroy) {
+    lock_guard<mutex> lock(s_garbageMutex);
+    s_garbage.emplace_back(frameNumber, move(destroy));
+}
+
+void collectVulkanGarbage(uint64_t safeFrameNumber) {
+    lock_guard<mutex> lock(s_garbageMutex);
+
+    // Entries are deferred in frame order, so the oldest are at the front.
+    while (!s_garbage.empty() && s_garbage.front().first <= safeFrameNumber) {
+        s_garbage.front().second();
+        s_garbage.pop_front();
+    }
+}
@@ -0,0 +1,61 @@
+// Copyright 2026 URAV ADVANCED LEARNING SYSTEMS PRIVATE LIMITED
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef UXR_QUESTCAMERA_VK_CONTEXT_H
+#define UXR_QUESTCAMERA_VK_CONTEXT_H
+
+// The converters also build on desktop Vulkan for host tests, which have no AHardwareBuffer import.
+#ifdef __ANDROID__
+#define VK_USE_PLATFORM_ANDROID_KHR
+#endif
+
+#include <vulkan/vulkan.h>
+#include <cstdint>
+#include <functional>
+
+#include "IUnityInterface.h"
+#include "IUnityGraphicsVulkan.h"
+
+// Unity's Vulkan device, and the extension functions the Vulkan converters need.
+struct VK_Context {
+    IUnityGraphicsVulkan* graphics;
+    UnityVulkanInstance instance;
+
+#ifdef __ANDROID__
+    PFN_vkGetAndroidHardwareBufferPropertiesANDROID getAndroidHardwareBufferProperties;
+#endif
+    PFN_vkCreateSamplerYcbcrConversion createSamplerYcbcrConversion;
+    PFN_vkDestroySamplerYcbcrConversion destroySamplerYcbcrConversion;
+};
+
+// Asks Unity to create its Vulkan device with the extensions and features the converters need. Must be called from
+// UnityPluginLoad, before the device is created. Returns false if Unity does not allow it.
+bool interceptVulkanInitialization(IUnityGraphicsVulkan* graphics);
+
+// Loads the context once Unity's Vulkan device exists. Returns false if the device lacks the required extensions.
+bool initializeVulkanContext(IUnityGraphicsVulkan* graphics);
+void shutdownVulkanContext();
+
+// The context, or nullptr if Unity is not rendering with Vulkan.
+const VK_Context* vulkanContext();
+
+// Destroys GPU objects once Unity's frame frameNumber, which may still use them, has finished on the GPU.
+// Objects never recorded into a frame can be deferred to frame 0 from any thread.
+void deferVulkanDestroy(uint64_t frameNumber, std::function<void()> destroy);
+
+// Runs the destructions deferred to frames up to safeFrameNumber. Must be called on the render thread.
+void collectVulkanGarbage(uint64_t safeFrameNumber);
+
+
+#endif //UXR_QUESTCAMERA_VK_CONTEXT_H
@@ -0,0 +1,48 @@
+// Copyright 2026 URAV ADVANCED LEARNING SYSTEMS PRIVATE LIMITED
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef UXR_QUESTCAMERA_VK_IMAGESOURCE_H
+#define UXR_QUESTCAMERA_VK_IMAGESOURCE_H
+
+#include "VK_Context.h"
+
+// An image sampled through its source's YCbCr conversion.
+struct VK_ImportedImage {
+    VkImage image;
+    VkDeviceMemory memory;
+    VkImageView view;
+
+    // Unity frame in which the image was last sampled.
+    uint64_t lastUsedFrame;
+};
+
+// The YCbCr images a VK_YUVConverter samples. Implemented by VK_CameraSource, which imports camera AHardwareBuffers,
+// and by sources uploading host buffers, which run the converter without Android.
+class VK_ImageSource {
+
+public:
+    virtual ~VK_ImageSource() = default;
+
+    // The latest image, or nullptr. It is kept in VK_IMAGE_LAYOUT_GENERAL while the converter is not sampling it.
+    virtual const VK_ImportedImage* image() const = 0;
+    virtual VkSampler sampler() const = 0;
+
+    // The queue family owning the image while the converter is not sampling it, like VK_QUEUE_FAMILY_FOREIGN_EXT
+    // for camera buffers, or VK_QUEUE_FAMILY_IGNORED if it is already owned by Unity's queue.
+    virtual uint32_t ownerQueueFamily() const = 0;
+};
+
+
+#endif //UXR_QUESTCAMERA_VK_IMAGESOURCE_H
@@ -0,0 +1,673 @@
+// Copyright 2026 URAV ADVANCED LEARNING SYSTEMS PRIVATE LIMITED
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "VK_PlaneConverter.h"
+#include "NativeLog.h"
+#include <cstring>
+#include <thread>
+
+#define TAG "UXRQC.VKPlaneConverter"
+#define LOGI(...) NATIVE_LOG(ANDROID_LOG_INFO,  TAG, __VA_ARGS__)
+#define LOGE(...) NATIVE_LOG(ANDROID_LOG_ERROR, TAG, __VA_ARGS__)
+
+// Camera row strides are padded for the hardware, so plane capacity assumes rows padded up to this many bytes.
+#define MAX_ROW_ALIGNMENT 256
+
+// Workgroups have at least this many invocations, even on devices with smaller subgroups.
+#define MIN_WORKGROUP_INVOCATIONS 64
+
+using namespace std;
+
+// SPIR-V compiled from shaders/ at build time, once per output format.
+static const uint32_t COMPUTE_SHADER_SPIRV_RGBA8[] = {
+#include "VK_PlaneConverter.rgba8.comp.spv.inc"
+};
+
+static const uint32_t COMPUTE_SHADER_SPIRV_RGB10A2[] = {
+#include "VK_PlaneConverter.rgb10_a2.comp.spv.inc"
+};
+
+static const uint32_t COMPUTE_SHADER_SPIRV_RGBA16F[] = {
+#include "VK_PlaneConverter.rgba16f.comp.spv.inc"
+};
+
+struct PlanePushConstants {
+    uint32_t yRowStride;
+    uint32_t uvRowStride;
+    uint32_t uvPixelStride;
+    uint32_t width;
+    uint32_t height;
+};
+
+static VkDeviceSize alignUp(VkDeviceSize value, VkDeviceSize alignment) {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+// The format of the image view written by the shader for an output format.
+static VkFormat outputViewFormat(int32_t outputFormat) {
+    switch (outputFormat) {
+        case PLANE_OUTPUT_RGBA8:    return VK_FORMAT_R8G8B8A8_UNORM;
+        case PLANE_OUTPUT_RGB10A2:  return VK_FORMAT_A2B10G10R10_UNORM_PACK32;
+        case PLANE_OUTPUT_RGBA16F:  return VK_FORMAT_R16G16B16A16_SFLOAT;
+        default:                    return VK_FORMAT_UNDEFINED;
+    }
+}
+
+// 8-bit textures are always written through a UNORM view, like Unity's compute path which writes sRGB textures as-is.
+static VkFormat storageViewFormat(VkFormat format) {
+    switch (format) {
+        case VK_FORMAT_R8G8B8A8_UNORM:
+        case VK_FORMAT_R8G8B8A8_SRGB:
+            return VK_FORMAT_R8G8B8A8_UNORM;
+
+        case VK_FORMAT_A2B10G10R10_UNORM_PACK32:
+        case VK_FORMAT_R16G16B16A16_SFLOAT:
+            return format;
+
+        default:
+            return VK_FORMAT_UNDEFINED;
+    }
+}
+
+VK_PlaneConverter::VK_PlaneConverter(void* nativeTexture, int32_t width, int32_t height, int32_t sampleFormat, int32_t outputFormat) {
+    _nativeTexture = nativeTexture;
+    _width = width;
+    _height = height;
+    _sampleFormat = sampleFormat;
+    _outputFormat = outputFormat;
+
+    _stagingBuffer = VK_NULL_HANDLE;
+    _stagingMemory = VK_NULL_HANDLE;
+    _stagingData = nullptr;
+    _slotSize = 0;
+
+    for (int32_t i = 0; i < 3; i++) {
+        _planeOffsets[i] = 0;
+        _planeSizes[i] = 0;
+    }
+
+    for (StagingSlot& slot : _slots) {
+        slot.state.store(SLOT_FREE);
+        slot.sequence = 0;
+        slot.timestamp = -1;
+        slot.strides[0] = slot.strides[1] = slot.strides[2] = 0;
+        slot.frameNumber = 0;
+        slot.descriptorSet = VK_NULL_HANDLE;
+    }
+
+    _nextSequence.store(1);
+    _disposed.store(false);
+    _dispatched = false;
+
+    _workgroupSize[0] = 8;
+    _workgroupSize[1] = 8;
+    _shader = VK_NULL_HANDLE;
+    _setLayout = VK_NULL_HANDLE;
+    _pipelineLayout = VK_NULL_HANDLE;
+    _pipeline = VK_NULL_HANDLE;
+    _descriptorPool = VK_NULL_HANDLE;
+
+    _targetImage = VK_NULL_HANDLE;
+    _targetView = VK_NULL_HANDLE;
+}
+
+bool VK_PlaneConverter::initialize() {
+    if (_sampleFormat < PLANE_SAMPLES_8BIT || _sampleFormat > PLANE_SAMPLES_P010) {
+        LOGE("Unknown sample format '%i'", _sampleFormat);
+        return false;
+    }
+
+    VkFormat viewFormat = outputViewFormat(_outputFormat);
+    if (viewFormat == VK_FORMAT_UNDEFINED) {
+        LOGE("Unknown output format '%i'", _outputFormat);
+        return false;
+    }
+
+    // Only 8-bit storage images are guaranteed by Vulkan.
+    VkFormatProperties formatProperties;
+    vkGetPhysicalDeviceFormatProperties(vulkanContext()->instance.physicalDevice, viewFormat, &formatProperties);
+    if ((formatProperties.optimalTilingFeatures & VK_FORMAT_FEATURE_STORAGE_IMAGE_BIT) == 0) {
+        LOGE("Output format '%i' can't be used as a storage image on this device.", _outputFormat);
+        return false;
+    }
+
+    if (!createStaging() || !createPipeline()) {
+        return false;
+    }
+
+    LOGI("Converter initialized (workgroup: %ux%u, samples: %i, output: %i).", _workgroupSize[0], _workgroupSize[1], _sampleFormat, _outputFormat);
+    return true;
+}
+
+bool VK_PlaneConverter::createStaging() {
+    const VK_Context* context = vulkanContext();
+    VkDevice device = context->instance.device;
+
+    VkPhysicalDeviceProperties properties;
+    vkGetPhysicalDeviceProperties(context->instance.physicalDevice, &properties);
+
+    VkDeviceSize alignment = properties.limits.minStorageBufferOffsetAlignment;
+    if (alignment < sizeof(uint32_t)) {
+        alignment = sizeof(uint32_t);
+    }
+
+    // P010 planes are unpacked into tightly packed rows, with separate chroma planes.
+    if (_sampleFormat == PLANE_SAMPLES_P010) {
+        _planeSizes[0] = alignUp((VkDeviceSize)_width * _height * sizeof(uint16_t), sizeof(uint32_t));
+        _planeSizes[1] = alignUp((VkDeviceSize)((_width + 1) / 2) * ((_height + 1) / 2) * sizeof(uint16_t), sizeof(uint32_t));
+    } else {
+        VkDeviceSize paddedRow = alignUp((VkDeviceSize)_width, MAX_ROW_ALIGNMENT);
+        _planeSizes[0] = alignUp(paddedRow * _height, sizeof(uint32_t));
+        _planeSizes[1] = alignUp(paddedRow * ((_height + 1) / 2), sizeof(uint32_t));
+    }
+
+    _planeSizes[2] = _planeSizes[1];
+
+    VkDeviceSize offset = 0;
+    for (int32_t i = 0; i < 3; i++) {
+        _planeOffsets[i] = offset;
+        offset = alignUp(offset + _planeSizes[i], alignment);
+    }
+
+    _slotSize = offset;
+
+    VkBufferCreateInfo bufferInfo = {};
+    bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    bufferInfo.size = _slotSize * VK_STAGING_RING_SIZE;
+    bufferInfo.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+    bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+    if (vkCreateBuffer(device, &bufferInfo, nullptr, &_stagingBuffer) != VK_SUCCESS) {
+        LOGE("Could not create staging buffer.");
+        _stagingBuffer = VK_NULL_HANDLE;
+        return false;
+    }
+
+    VkMemoryRequirements requirements;
+    vkGetBufferMemoryRequirements(device, _stagingBuffer, &requirements);
+
+    VkPhysicalDeviceMemoryProperties memoryProperties;
+    vkGetPhysicalDeviceMemoryProperties(context->instance.physicalDevice, &memoryProperties);
+
+    // Coherent memory needs no flushes, so the camera thread's copy is the only work done per frame on the CPU.
+    const VkMemoryPropertyFlags requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+    uint32_t memoryType = UINT32_MAX;
+    for (uint32_t i = 0; i < memoryProperties.memoryTypeCount; i++) {
+        if ((requirements.memoryTypeBits & (1u << i)) && (memoryProperties.memoryTypes[i].propertyFlags & requiredFlags) == requiredFlags) {
+            memoryType = i;
+            break;
+        }
+    }
+
+    if (memoryType == UINT32_MAX) {
+        LOGE("No host coherent memory type for the staging buffer.");
+        return false;
+    }
+
+    VkMemoryAllocateInfo allocateInfo = {};
+    allocateInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    allocateInfo.allocationSize = requirements.size;
+    allocateInfo.memoryTypeIndex = memoryType;
+
+    if (vkAllocateMemory(device, &allocateInfo, nullptr, &_stagingMemory) != VK_SUCCESS) {
+        LOGE("Could not allocate staging memory.");
+        _stagingMemory = VK_NULL_HANDLE;
+        return false;
+    }
+
+    void* mapped = nullptr;
+    if (vkBindBufferMemory(device, _stagingBuffer, _stagingMemory, 0) != VK_SUCCESS
+        || vkMapMemory(device, _stagingMemory, 0, VK_WHOLE_SIZE, 0, &mapped) != VK_SUCCESS) {
+        LOGE("Could not bind or map staging memory.");
+        return false;
+    }
+
+    _stagingData = static_cast<uint8_t*>(mapped);
+    return true;
+}
+
+bool VK_PlaneConverter::createPipeline() {
+    const VK_Context* context = vulkanContext();
+    VkDevice device = context->instance.device;
+
+    // Rows of a workgroup span whole subgroups, so neighbouring invocations read neighbouring Y bytes.
+    VkPhysicalDeviceSubgroupProperties subgroupProperties = {};
+    subgroupProperties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_PROPERTIES;
+
+    VkPhysicalDeviceProperties2 properties = {};
+    properties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2;
+    properties.pNext = &subgroupProperties;
+    vkGetPhysicalDeviceProperties2(context->instance.physicalDevice, &properties);
+
+    uint32_t subgroupSize = subgroupProperties.subgroupSize;
+    const VkPhysicalDeviceLimits& limits = properties.properties.limits;
+    if (subgroupSize != 0 && subgroupSize <= limits.maxComputeWorkGroupSize[0] && subgroupSize <= limits.maxComputeWorkGroupInvocations) {
+        _workgroupSize[0] = subgroupSize;
+        _workgroupSize[1] = subgroupSize >= MIN_WORKGROUP_INVOCATIONS ? 1 : MIN_WORKGROUP_INVOCATIONS / subgroupSize;
+    }
+
+    VkShaderModuleCreateInfo moduleInfo = {};
+    moduleInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+    switch (_outputFormat) {
+        case PLANE_OUTPUT_RGB10A2:
+            moduleInfo.codeSize = sizeof(COMPUTE_SHADER_SPIRV_RGB10A2);
+            moduleInfo.pCode = COMPUTE_SHADER_SPIRV_RGB10A2;
+            break;
+
+        case PLANE_OUTPUT_RGBA16F:
+            moduleInfo.codeSize = sizeof(COMPUTE_SHADER_SPIRV_RGBA16F);
+            moduleInfo.pCode = COMPUTE_SHADER_SPIRV_RGBA16F;
+            break;
+
+        default:
+            moduleInfo.codeSize = sizeof(COMPUTE_SHADER_SPIRV_RGBA8);
+            moduleInfo.pCode = COMPUTE_SHADER_SPIRV_RGBA8;
+            break;
+    }
+
+    if (vkCreateShaderModule(device, &moduleInfo, nullptr, &_shader) != VK_SUCCESS) {
+        LOGE("Could not create shader module.");
+        _shader = VK_NULL_HANDLE;
+        return false;
+    }
+
+    VkDescriptorSetLayoutBinding bindings[4] = {};
+    for (uint32_t i = 0; i < 4; i++) {
+        bindings[i].binding = i;
+        bindings[i].descriptorType = i == 0 ? VK_DESCRIPTOR_TYPE_STORAGE_IMAGE : VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        bindings[i].descriptorCount = 1;
+        bindings[i].stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+    }
+
+    VkDescriptorSetLayoutCreateInfo setLayoutInfo = {};
+    setLayoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+    setLayoutInfo.bindingCount = 4;
+    setLayoutInfo.pBindings = bindings;
+
+    if (vkCreateDescriptorSetLayout(device, &setLayoutInfo, nullptr, &_setLayout) != VK_SUCCESS) {
+        LOGE("Could not create descriptor set layout.");
+        _setLayout = VK_NULL_HANDLE;
+        return false;
+    }
+
+    VkPushConstantRange pushConstants = { VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(PlanePushConstants) };
+
+    VkPipelineLayoutCreateInfo layoutInfo = {};
+    layoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+    layoutInfo.setLayoutCount = 1;
+    layoutInfo.pSetLayouts = &_setLayout;
+    layoutInfo.pushConstantRangeCount = 1;
+    layoutInfo.pPushConstantRanges = &pushConstants;
+
+    if (vkCreatePipelineLayout(device, &layoutInfo, nullptr, &_pipelineLayout) != VK_SUCCESS) {
+        LOGE("Could not create pipeline layout.");
+        _pipelineLayout = VK_NULL_HANDLE;
+        return false;
+    }
+
+    // The workgroup size, then the bytes per sample of the staged planes.
+    uint32_t specializationData[3] = { _workgroupSize[0], _workgroupSize[1], _sampleFormat == PLANE_SAMPLES_P010 ? 2u : 1u };
+    VkSpecializationMapEntry specializationEntries[3] = {
+            { 0, 0, sizeof(uint32_t) },
+            { 1, sizeof(uint32_t), sizeof(uint32_t) },
+            { 2, 2 * sizeof(uint32_t), sizeof(uint32_t) }
+    };
+
+    VkSpecializationInfo specializationInfo = {};
+    specializationInfo.mapEntryCount = 3;
+    specializationInfo.pMapEntries = specializationEntries;
+    specializationInfo.dataSize = sizeof(specializationData);
+    specializationInfo.pData = specializationData;
+
+    VkComputePipelineCreateInfo pipelineInfo = {};
+    pipelineInfo.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
+    pipelineInfo.stage.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    pipelineInfo.stage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+    pipelineInfo.stage.module = _shader;
+    pipelineInfo.stage.pName = "main";
+    pipelineInfo.stage.pSpecializationInfo = &specializationInfo;
+    pipelineInfo.layout = _pipelineLayout;
+
+    if (vkCreateComputePipelines(device, context->instance.pipelineCache, 1, &pipelineInfo, nullptr, &_pipeline) != VK_SUCCESS) {
+        LOGE("Could not create pipeline.");
+        _pipeline = VK_NULL_HANDLE;
+        return false;
+    }
+
+    VkDescriptorPoolSize poolSizes[2] = {
+            { VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, VK_STAGING_RING_SIZE },
+            { VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_STAGING_RING_SIZE * 3 }
+    };
+
+    VkDescriptorPoolCreateInfo poolInfo = {};
+    poolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+    poolInfo.maxSets = VK_STAGING_RING_SIZE;
+    poolInfo.poolSizeCount = 2;
+    poolInfo.pPoolSizes = poolSizes;
+
+    if (vkCreateDescriptorPool(device, &poolInfo, nullptr, &_descriptorPool) != VK_SUCCESS) {
+        LOGE("Could not create descriptor pool.");
+        _descriptorPool = VK_NULL_HANDLE;
+        return false;
+    }
+
+    VkDescriptorSetLayout setLayouts[VK_STAGING_RING_SIZE];
+    VkDescriptorSet descriptorSets[VK_STAGING_RING_SIZE];
+    for (int32_t i = 0; i < VK_STAGING_RING_SIZE; i++) {
+        setLayouts[i] = _setLayout;
+    }
+
+    VkDescriptorSetAllocateInfo allocateInfo = {};
+    allocateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+    allocateInfo.descriptorPool = _descriptorPool;
+    allocateInfo.descriptorSetCount = VK_STAGING_RING_SIZE;
+    allocateInfo.pSetLayouts = setLayouts;
+
+    if (vkAllocateDescriptorSets(device, &allocateInfo, descriptorSets) != VK_SUCCESS) {
+        LOGE("Could not allocate descriptor sets.");
+        return false;
+    }
+
+    // The plane bindings of a slot never change; only the output image is written per dispatch.
+    for (int32_t i = 0; i < VK_STAGING_RING_SIZE; i++) {
+        _slots[i].descriptorSet = descriptorSets[i];
+
+        VkDescriptorBufferInfo bufferInfos[3];
+        VkWriteDescriptorSet writes[3] = {};
+        for (int32_t plane = 0; plane < 3; plane++) {
+            bufferInfos[plane] = { _stagingBuffer, _slotSize * i + _planeOffsets[plane], _planeSizes[plane] };
+
+            writes[plane].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+            writes[plane].dstSet = descriptorSets[i];
+            writes[plane].dstBinding = plane + 1;
+            writes[plane].descriptorCount = 1;
+            writes[plane].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+            writes[plane].pBufferInfo = &bufferInfos[plane];
+        }
+
+        vkUpdateDescriptorSets(device, 3, writes, 0, nullptr);
+    }
+
+    return true;
+}
+
+bool VK_PlaneConverter::createTarget(const UnityVulkanImage& image) {
+    VkFormat viewFormat = storageViewFormat(image.format);
+    if (viewFormat == VK_FORMAT_UNDEFINED || viewFormat != outputViewFormat(_outputFormat)) {
+        LOGE("Unsupported texture format %i for plane conversion.", image.format);
+        return false;
+    }
+
+    VkImageViewCreateInfo viewInfo = {};
+    viewInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+    viewInfo.image = image.image;
+    viewInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
+    viewInfo.format = viewFormat;
+    viewInfo.components = { VK_COMPONENT_SWIZZLE_IDENTITY, VK_COMPONENT_SWIZZLE_IDENTITY, VK_COMPONENT_SWIZZLE_IDENTITY, VK_COMPONENT_SWIZZLE_IDENTITY };
+    viewInfo.subresourceRange = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1 };
+
+    if (vkCreateImageView(vulkanContext()->instance.device, &viewInfo, nullptr, &_targetView) != VK_SUCCESS) {
+        LOGE("Could not create render texture view.");
+        _targetView = VK_NULL_HANDLE;
+        return false;
+    }
+
+    _targetImage = image.image;
+    return true;
+}
+
+void VK_PlaneConverter::destroyTarget(uint64_t frameNumber) {
+    VkDevice device = vulkanContext()->instance.device;
+    VkImageView view = _targetView;
+
+    deferVulkanDestroy(frameNumber, [device, view]() {
+        vkDestroyImageView(device, view, nullptr);
+    });
+
+    _targetImage = VK_NULL_HANDLE;
+    _targetView = VK_NULL_HANDLE;
+}
+
+bool VK_PlaneConverter::submit(const uint8_t* yPlane, size_t yPlaneSize, const uint8_t* uPlane, const uint8_t* vPlane, size_t uvPlaneSize,
+                               int32_t yRowStride, int32_t uvRowStride, int32_t uvPixelStride, int64_t timestamp) {
+    if (_disposed.load() || _stagingData == nullptr) {
+        return false;
+    }
+
+    bool isP010 = _sampleFormat == PLANE_SAMPLES_P010;
+    if (isP010 ? !fitsP010(yPlaneSize, uPlane, vPlane, uvPlaneSize, yRowStride, uvRowStride, uvPixelStride)
+               : (yPlaneSize > _planeSizes[0] || uvPlaneSize > _planeSizes[1])) {
+        LOGE("Frame planes do not fit the staging slots, dropping frame.");
+        return false;
+    }
+
+    for (int32_t i = 0; i < VK_STAGING_RING_SIZE; i++) {
+        StagingSlot& slot = _slots[i];
+
+        uint32_t expected = SLOT_FREE;
+        if (!slot.state.compare_exchange_strong(expected, SLOT_WRITING)) {
+            continue;
+        }
+
+        // Checked again now that dispose waits for this slot.
+        if (_disposed.load()) {
+            slot.state.store(SLOT_FREE);
+            return false;
+        }
+
+        uint8_t* slotData = _stagingData + _slotSize * i;
+        if (isP010) {
+            copyP010(slotData, yPlane, uPlane, vPlane, yRowStride, uvRowStride, uvPixelStride, slot.strides);
+        } else {
+            memcpy(slotData + _planeOffsets[0], yPlane, yPlaneSize);
+            memcpy(slotData + _planeOffsets[1], uPlane, uvPlaneSize);
+            memcpy(slotData + _planeOffsets[2], vPlane, uvPlaneSize);
+
+            slot.strides[0] = yRowStride;
+            slot.strides[1] = uvRowStride;
+            slot.strides[2] = uvPixelStride;
+        }
+
+        slot.sequence = _nextSequence.fetch_add(1);
+        slot.timestamp = timestamp;
+
+        // Host writes to coherent memory are visible to every queue submission made after this point.
+        slot.state.store(SLOT_READY, memory_order_release);
+        return true;
+    }
+
+    return false;
+}
+
+// P010 chroma is either interleaved, with the V plane starting one sample after the U plane, or planar.
+static bool isInterleavedP010(const uint8_t* uPlane, const uint8_t* vPlane, int32_t uvPixelStride) {
+    return uvPixelStride == 4 && vPlane == uPlane + sizeof(uint16_t);
+}
+
+bool VK_PlaneConverter::fitsP010(size_t yPlaneSize, const uint8_t* uPlane, const uint8_t* vPlane, size_t uvPlaneSize,
+                                 int32_t yRowStride, int32_t uvRowStride, int32_t uvPixelStride) const {
+    size_t chromaWidth = (_width + 1) / 2;
+    size_t chromaHeight = (_height + 1) / 2;
+    size_t yRowSize = _width * sizeof(uint16_t);
+
+    if (yRowStride < (int32_t)yRowSize || (size_t)yRowStride * (_height - 1) + yRowSize > yPlaneSize) {
+        return false;
+    }
+
+    // The U plane of interleaved chroma ends one sample before the last V sample, which is read through it.
+    size_t uvRowSize;
+    if (isInterleavedP010(uPlane, vPlane, uvPixelStride)) {
+        uvRowSize = chromaWidth * 2 * sizeof(uint16_t);
+        return uvRowStride >= (int32_t)uvRowSize && (size_t)uvRowStride * (chromaHeight - 1) + uvRowSize - sizeof(uint16_t) <= uvPlaneSize;
+    }
+
+    uvRowSize = chromaWidth * sizeof(uint16_t);
+    return uvPixelStride == sizeof(uint16_t) && uvRowStride >= (int32_t)uvRowSize
+           && (size_t)uvRowStride * (chromaHeight - 1) + uvRowSize <= uvPlaneSize;
+}
+
+void VK_PlaneConverter::copyP010(uint8_t* slotData, const uint8_t* yPlane, const uint8_t* uPlane, const uint8_t* vPlane,
+                                 int32_t yRowStride, int32_t uvRowStride, int32_t uvPixelStride, uint32_t strides[3]) const {
+    int32_t chromaWidth = (_width + 1) / 2;
+    int32_t chromaHeight = (_height + 1) / 2;
+
+    auto yStaging = reinterpret_cast<uint16_t*>(slotData + _planeOffsets[0]);
+    auto uStaging = reinterpret_cast<uint16_t*>(slotData + _planeOffsets[1]);
+    auto vStaging = reinterpret_cast<uint16_t*>(slotData + _planeOffsets[2]);
+
+    unpackP010Plane(yStaging, yPlane, yRowStride, _width, _height);
+    if (isInterleavedP010(uPlane, vPlane, uvPixelStride)) {
+        unpackP010Chroma(uStaging, vStaging, uPlane, uvRowStride, chromaWidth, chromaHeight);
+    } else {
+        unpackP010Plane(uStaging, uPlane, uvRowStride, chromaWidth, chromaHeight);
+        unpackP010Plane(vStaging, vPlane, uvRowStride, chromaWidth, chromaHeight);
+    }
+
+    strides[0] = _width * sizeof(uint16_t);
+    strides[1] = chromaWidth * sizeof(uint16_t);
+    strides[2] = sizeof(uint16_t);
+}
+
+int64_t VK_PlaneConverter::dispatch(const UnityVulkanRecordingState& recordingState) {
+    if (_disposed.load() || _pipeline == VK_NULL_HANDLE) {
+        return -1;
+    }
+
+    // Slots are recycled with Unity's frame numbers, as the dispatch is part of Unity's own submission.
+    StagingSlot* newest = nullptr;
+    for (StagingSlot& slot : _slots) {
+        uint32_t state = slot.state.load(memory_order_acquire);
+        if (state == SLOT_IN_FLIGHT && slot.frameNumber <= recordingState.safeFrameNumber) {
+            slot.state.store(SLOT_FREE);
+        } else if (state == SLOT_READY && (newest == nullptr || slot.sequence > newest->sequence)) {
+            newest = &slot;
+        }
+    }
+
+    if (newest == nullptr) {
+        return -1;
+    }
+
+    // Older frames were superseded before they could be converted.
+    for (StagingSlot& slot : _slots) {
+        // Only the render thread moves slots out of SLOT_READY, so the sequence cannot change under this check.
+        if (&slot != newest && slot.state.load(memory_order_acquire) == SLOT_READY && slot.sequence < newest->sequence) {
+            slot.state.store(SLOT_FREE);
+        }
+    }
+
+    const VK_Context* context = vulkanContext();
+    uint64_t frameNumber = recordingState.currentFrameNumber;
+
+    UnityVulkanImage target;
+    if (!context->graphics->AccessTexture(_nativeTexture, UnityVulkanWholeImage,
+                                          VK_IMAGE_LAYOUT_GENERAL,
+                                          VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                                          VK_ACCESS_SHADER_WRITE_BIT,
+                                          kUnityVulkanResourceAccess_PipelineBarrier, &target)) {
+        LOGE("Could not access render texture.");
+        return -1;
+    }
+
+    if (target.image != _targetImage) {
+        destroyTarget(frameNumber);
+        if (!createTarget(target)) {
+            destroyTarget(frameNumber);
+            return -1;
+        }
+    }
+
+    VkDescriptorImageInfo imageInfo = { VK_NULL_HANDLE, _targetView, VK_IMAGE_LAYOUT_GENERAL };
+
+    VkWriteDescriptorSet write = {};
+    write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+    write.dstSet = newest->descriptorSet;
+    write.dstBinding = 0;
+    write.descriptorCount = 1;
+    write.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
+    write.pImageInfo = &imageInfo;
+    vkUpdateDescriptorSets(context->instance.device, 1, &write, 0, nullptr);
+
+    PlanePushConstants pushConstants = {
+            newest->strides[0],
+            newest->strides[1],
+            newest->strides[2],
+            target.extent.width,
+            target.extent.height
+    };
+
+    VkCommandBuffer commandBuffer = recordingState.commandBuffer;
+    vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, _pipeline);
+    vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, _pipelineLayout, 0, 1, &newest->descriptorSet, 0, nullptr);
+    vkCmdPushConstants(commandBuffer, _pipelineLayout, VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(pushConstants), &pushConstants);
+    vkCmdDispatch(commandBuffer,
+                  (target.extent.width + _workgroupSize[0] - 1) / _workgroupSize[0],
+                  (target.extent.height + _workgroupSize[1] - 1) / _workgroupSize[1],
+                  1);
+
+    newest->frameNumber = frameNumber;
+    newest->state.store(SLOT_IN_FLIGHT);
+    _dispatched = true;
+    return newest->timestamp;
+}
+
+bool VK_PlaneConverter::hasDispatched() const {
+    return _dispatched;
+}
+
+void VK_PlaneConverter::dispose(uint64_t currentFrameNumber) {
+    if (_disposed.exchange(true)) {
+        return;
+    }
+
+    // A submit which claimed a slot before the flag was set may still be copying into the mapped memory.
+    for (StagingSlot& slot : _slots) {
+        while (slot.state.load() == SLOT_WRITING) {
+            this_thread::yield();
+        }
+    }
+
+    destroyTarget(currentFrameNumber);
+
+    VkDevice device = vulkanContext()->instance.device;
+    VkBuffer stagingBuffer = _stagingBuffer;
+    VkDeviceMemory stagingMemory = _stagingMemory;
+    VkShaderModule shader = _shader;
+    VkDescriptorPool descriptorPool = _descriptorPool;
+    VkPipeline pipeline = _pipeline;
+    VkPipelineLayout pipelineLayout = _pipelineLayout;
+    VkDescriptorSetLayout setLayout = _setLayout;
+
+    // Destroying the pool frees its sets, and freeing the memory unmaps it.
+    deferVulkanDestroy(currentFrameNumber, [device, stagingBuffer, stagingMemory, shader, descriptorPool, pipeline, pipelineLayout, setLayout]() {
+        vkDestroyDescriptorPool(device, descriptorPool, nullptr);
+        vkDestroyPipeline(device, pipeline, nullptr);
+        vkDestroyPipelineLayout(device, pipelineLayout, nullptr);
+        vkDestroyDescriptorSetLayout(device, setLayout, nullptr);
+        vkDestroyShaderModule(device, shader, nullptr);
+        vkDestroyBuffer(device, stagingBuffer, nullptr);
+        vkFreeMemory(device, stagingMemory, nullptr);
+    });
+
+    _stagingBuffer = VK_NULL_HANDLE;
+    _stagingMemory = VK_NULL_HANDLE;
+    _stagingData = nullptr;
+    _shader = VK_NULL_HANDLE;
+    _descriptorPool = VK_NULL_HANDLE;
+    _pipeline = VK_NULL_HANDLE;
+    _pipelineLayout = VK_NULL_HANDLE;
+    _setLayout = VK_NULL_HANDLE;
+
+    LOGI("Converter disposed.");
+}
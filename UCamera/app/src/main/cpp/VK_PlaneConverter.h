@@ -0,0 +1,125 @@
+// Copyright 2026 URAV ADVANCED LEARNING SYSTEMS PRIVATE LIMITED
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef UXR_QUESTCAMERA_VK_PLANECONVERTER_H
+#define UXR_QUESTCAMERA_VK_PLANECONVERTER_H
+
+#include <atomic>
+#include <cstddef>
+
+#include "PlaneKernels.h"
+#include "VK_Context.h"
+
+// Staging slots for submitted frames. One is written by the camera thread while one is read by the GPU,
+// and one more lets a new frame arrive before the last dispatch has finished.
+#define VK_STAGING_RING_SIZE 3
+
+// Formats of the output texture, each with its own compiled shader. Mirrored in C#.
+#define PLANE_OUTPUT_RGBA8      0
+#define PLANE_OUTPUT_RGB10A2    1
+#define PLANE_OUTPUT_RGBA16F    2
+
+// Converts CPU-side YUV_420_888 planes, like those given to YUVConverter.OnFrameReady, into a Unity texture with a
+// compute shader. Planes are copied straight into persistently mapped staging memory, so the only copy is the upload.
+// P010 planes are unpacked to 10-bit values on the way in, so the shader reads tightly packed 16-bit planes.
+class VK_PlaneConverter {
+
+public:
+    VK_PlaneConverter(void* nativeTexture, int32_t width, int32_t height,
+                      int32_t sampleFormat = PLANE_SAMPLES_8BIT, int32_t outputFormat = PLANE_OUTPUT_RGBA8);
+
+    // Creates the staging ring and pipeline. Can be called from any thread, as it does not record commands.
+    bool initialize();
+
+    // Copies the planes into a free staging slot. Called from the camera thread which owns the planes.
+    // Returns false if every slot is busy, in which case the frame is dropped.
+    bool submit(const uint8_t* yPlane, size_t yPlaneSize, const uint8_t* uPlane, const uint8_t* vPlane, size_t uvPlaneSize,
+                int32_t yRowStride, int32_t uvRowStride, int32_t uvPixelStride, int64_t timestamp);
+
+    // Records the conversion of the newest submitted frame into Unity's current command buffer. Must be called
+    // outside of a render pass. Returns the frame's timestamp, or -1 if no new frame was converted.
+    int64_t dispatch(const UnityVulkanRecordingState& recordingState);
+
+    // Must be called on the render thread, unless nothing has been dispatched yet. Waits for a submit in progress
+    // to finish copying.
+    void dispose(uint64_t currentFrameNumber);
+
+    // Whether a conversion has been recorded into one of Unity's frames. Called on the render thread.
+    bool hasDispatched() const;
+
+private:
+    enum SlotState : uint32_t {
+        SLOT_FREE,
+        SLOT_WRITING,
+        SLOT_READY,
+        SLOT_IN_FLIGHT
+    };
+
+    struct StagingSlot {
+        std::atomic<uint32_t> state;
+
+        // Written by submit before the slot becomes SLOT_READY.
+        uint64_t sequence;
+        int64_t timestamp;
+        uint32_t strides[3];
+
+        // The Unity frame which reads the slot, while it is SLOT_IN_FLIGHT.
+        uint64_t frameNumber;
+        VkDescriptorSet descriptorSet;
+    };
+
+    bool fitsP010(size_t yPlaneSize, const uint8_t* uPlane, const uint8_t* vPlane, size_t uvPlaneSize,
+                  int32_t yRowStride, int32_t uvRowStride, int32_t uvPixelStride) const;
+
+    // Unpacks P010 planes into a staging slot, and writes the strides of the unpacked planes.
+    void copyP010(uint8_t* slotData, const uint8_t* yPlane, const uint8_t* uPlane, const uint8_t* vPlane,
+                  int32_t yRowStride, int32_t uvRowStride, int32_t uvPixelStride, uint32_t strides[3]) const;
+
+    bool createStaging();
+    bool createPipeline();
+    bool createTarget(const UnityVulkanImage& image);
+    void destroyTarget(uint64_t frameNumber);
+
+    void* _nativeTexture;
+    int32_t _width; int32_t _height;
+    int32_t _sampleFormat;
+    int32_t _outputFormat;
+
+    // Each slot holds the Y, U and V planes in that order, at offsets aligned for storage buffer bindings.
+    VkBuffer _stagingBuffer;
+    VkDeviceMemory _stagingMemory;
+    uint8_t* _stagingData;
+    VkDeviceSize _planeOffsets[3];
+    VkDeviceSize _planeSizes[3];
+    VkDeviceSize _slotSize;
+
+    StagingSlot _slots[VK_STAGING_RING_SIZE];
+    std::atomic<uint64_t> _nextSequence;
+    std::atomic<bool> _disposed;
+    bool _dispatched;
+
+    uint32_t _workgroupSize[2];
+    VkShaderModule _shader;
+    VkDescriptorSetLayout _setLayout;
+    VkPipelineLayout _pipelineLayout;
+    VkPipeline _pipeline;
+    VkDescriptorPool _descriptorPool;
+
+    // Recreated if Unity recreates the texture's image.
+    VkImage _targetImage;
+    VkImageView _targetView;
+};
+
+
+#endif //UXR_QUESTCAMERA_VK_PLANECONVERTER_H
@@ -0,0 +1,504 @@
+// Copyright 2026 URAV ADVANCED LEARNING SYSTEMS PRIVATE LIMITED
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "VK_YUVConverter.h"
+#include "NativeLog.h"
+#include <cstring>
+
+#define TAG "UXRQC.VKYUVConverter"
+#define LOGI(...) NATIVE_LOG(ANDROID_LOG_INFO,  TAG, __VA_ARGS__)
+#define LOGE(...) NATIVE_LOG(ANDROID_LOG_ERROR, TAG, __VA_ARGS__)
+
+// Descriptor sets not used by any frame yet.
+#define NO_FRAME UINT64_MAX
+
+// YCbCr samplers may consume one combined image sampler descriptor per plane.
+#define MAX_YCBCR_PLANES 3
+
+using namespace std;
+
+// SPIR-V compiled from shaders/ at build time.
+static const uint32_t VERTEX_SHADER_SPIRV[] = {
+#include "VK_YUVConverter.vert.spv.inc"
+};
+
+static const uint32_t FRAGMENT_SHADER_SPIRV[] = {
+#include "VK_YUVConverter.frag.spv.inc"
+};
+
+static VkShaderModule createShaderModule(VkDevice device, const uint32_t* code, size_t size) {
+    VkShaderModuleCreateInfo moduleInfo = {};
+    moduleInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+    moduleInfo.codeSize = size;
+    moduleInfo.pCode = code;
+
+    VkShaderModule module;
+    if (vkCreateShaderModule(device, &moduleInfo, nullptr, &module) != VK_SUCCESS) {
+        return VK_NULL_HANDLE;
+    }
+
+    return module;
+}
+
+static bool isSrgbFormat(VkFormat format) {
+    return format == VK_FORMAT_R8G8B8A8_SRGB
+        || format == VK_FORMAT_B8G8R8A8_SRGB
+        || format == VK_FORMAT_A8B8G8R8_SRGB_PACK32;
+}
+
+VK_YUVConverter::VK_YUVConverter(void* nativeTexture, int32_t width, int32_t height, const float cropRect[4]) {
+    _nativeTexture = nativeTexture;
+    _width = width;
+    _height = height;
+    memcpy(_cropRect, cropRect, sizeof(_cropRect));
+
+    _vertexShader = VK_NULL_HANDLE;
+    _fragmentShader = VK_NULL_HANDLE;
+
+    _targetImage = VK_NULL_HANDLE;
+    _targetFormat = VK_FORMAT_UNDEFINED;
+    _targetView = VK_NULL_HANDLE;
+    _renderPass = VK_NULL_HANDLE;
+    _framebuffer = VK_NULL_HANDLE;
+
+    _pipelineSampler = VK_NULL_HANDLE;
+    _setLayout = VK_NULL_HANDLE;
+    _pipelineLayout = VK_NULL_HANDLE;
+    _pipeline = VK_NULL_HANDLE;
+    _descriptorPool = VK_NULL_HANDLE;
+
+    for (int32_t i = 0; i < VK_DESCRIPTOR_RING_SIZE; i++) {
+        _descriptorSets[i] = VK_NULL_HANDLE;
+        _descriptorSetFrames[i] = NO_FRAME;
+    }
+
+    _nextDescriptorSet = 0;
+    _disposed = false;
+}
+
+bool VK_YUVConverter::initialize() {
+    VkDevice device = vulkanContext()->instance.device;
+
+    _vertexShader = createShaderModule(device, VERTEX_SHADER_SPIRV, sizeof(VERTEX_SHADER_SPIRV));
+    _fragmentShader = createShaderModule(device, FRAGMENT_SHADER_SPIRV, sizeof(FRAGMENT_SHADER_SPIRV));
+    if (_vertexShader == VK_NULL_HANDLE || _fragmentShader == VK_NULL_HANDLE) {
+        LOGE("Could not create shader modules.");
+        return false;
+    }
+
+    LOGI("Converter initialized.");
+    return true;
+}
+
+bool VK_YUVConverter::createTarget(const UnityVulkanImage& image) {
+    VkDevice device = vulkanContext()->instance.device;
+
+    VkImageViewCreateInfo viewInfo = {};
+    viewInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+    viewInfo.image = image.image;
+    viewInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
+    viewInfo.format = image.format;
+    viewInfo.components = { VK_COMPONENT_SWIZZLE_IDENTITY, VK_COMPONENT_SWIZZLE_IDENTITY, VK_COMPONENT_SWIZZLE_IDENTITY, VK_COMPONENT_SWIZZLE_IDENTITY };
+    viewInfo.subresourceRange = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1 };
+
+    if (vkCreateImageView(device, &viewInfo, nullptr, &_targetView) != VK_SUCCESS) {
+        LOGE("Could not create render texture view.");
+        _targetView = VK_NULL_HANDLE;
+        return false;
+    }
+
+    // Unity has already moved the texture to the attachment layout, and the whole image is overwritten.
+    VkAttachmentDescription attachment = {};
+    attachment.format = image.format;
+    attachment.samples = VK_SAMPLE_COUNT_1_BIT;
+    attachment.loadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+    attachment.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+    attachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+    attachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+    attachment.initialLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+    attachment.finalLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+
+    VkAttachmentReference colorReference = { 0, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL };
+
+    VkSubpassDescription subpass = {};
+    subpass.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+    subpass.colorAttachmentCount = 1;
+    subpass.pColorAttachments = &colorReference;
+
+    VkRenderPassCreateInfo renderPassInfo = {};
+    renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
+    renderPassInfo.attachmentCount = 1;
+    renderPassInfo.pAttachments = &attachment;
+    renderPassInfo.subpassCount = 1;
+    renderPassInfo.pSubpasses = &subpass;
+
+    if (vkCreateRenderPass(device, &renderPassInfo, nullptr, &_renderPass) != VK_SUCCESS) {
+        LOGE("Could not create render pass.");
+        _renderPass = VK_NULL_HANDLE;
+        return false;
+    }
+
+    VkFramebufferCreateInfo framebufferInfo = {};
+    framebufferInfo.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
+    framebufferInfo.renderPass = _renderPass;
+    framebufferInfo.attachmentCount = 1;
+    framebufferInfo.pAttachments = &_targetView;
+    framebufferInfo.width = image.extent.width;
+    framebufferInfo.height = image.extent.height;
+    framebufferInfo.layers = 1;
+
+    if (vkCreateFramebuffer(device, &framebufferInfo, nullptr, &_framebuffer) != VK_SUCCESS) {
+        LOGE("Could not create framebuffer.");
+        _framebuffer = VK_NULL_HANDLE;
+        return false;
+    }
+
+    _targetImage = image.image;
+    _targetFormat = image.format;
+    return true;
+}
+
+bool VK_YUVConverter::createPipeline(VkSampler sampler) {
+    const VK_Context* context = vulkanContext();
+    VkDevice device = context->instance.device;
+
+    // The YCbCr conversion can only be applied by immutable samplers.
+    VkDescriptorSetLayoutBinding binding = {};
+    binding.binding = 0;
+    binding.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+    binding.descriptorCount = 1;
+    binding.stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
+    binding.pImmutableSamplers = &sampler;
+
+    VkDescriptorSetLayoutCreateInfo setLayoutInfo = {};
+    setLayoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+    setLayoutInfo.bindingCount = 1;
+    setLayoutInfo.pBindings = &binding;
+
+    if (vkCreateDescriptorSetLayout(device, &setLayoutInfo, nullptr, &_setLayout) != VK_SUCCESS) {
+        LOGE("Could not create descriptor set layout.");
+        _setLayout = VK_NULL_HANDLE;
+        return false;
+    }
+
+    VkPushConstantRange pushConstants = { VK_SHADER_STAGE_VERTEX_BIT, 0, sizeof(_cropRect) };
+
+    VkPipelineLayoutCreateInfo layoutInfo = {};
+    layoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+    layoutInfo.setLayoutCount = 1;
+    layoutInfo.pSetLayouts = &_setLayout;
+    layoutInfo.pushConstantRangeCount = 1;
+    layoutInfo.pPushConstantRanges = &pushConstants;
+
+    if (vkCreatePipelineLayout(device, &layoutInfo, nullptr, &_pipelineLayout) != VK_SUCCESS) {
+        LOGE("Could not create pipeline layout.");
+        _pipelineLayout = VK_NULL_HANDLE;
+        return false;
+    }
+
+    VkBool32 isSrgbTarget = isSrgbFormat(_targetFormat) ? VK_TRUE : VK_FALSE;
+    VkSpecializationMapEntry specializationEntry = { 0, 0, sizeof(VkBool32) };
+
+    VkSpecializationInfo specializationInfo = {};
+    specializationInfo.mapEntryCount = 1;
+    specializationInfo.pMapEntries = &specializationEntry;
+    specializationInfo.dataSize = sizeof(VkBool32);
+    specializationInfo.pData = &isSrgbTarget;
+
+    VkPipelineShaderStageCreateInfo stages[2] = {};
+    stages[0].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    stages[0].stage = VK_SHADER_STAGE_VERTEX_BIT;
+    stages[0].module = _vertexShader;
+    stages[0].pName = "main";
+    stages[1].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    stages[1].stage = VK_SHADER_STAGE_FRAGMENT_BIT;
+    stages[1].module = _fragmentShader;
+    stages[1].pName = "main";
+    stages[1].pSpecializationInfo = &specializationInfo;
+
+    VkPipelineVertexInputStateCreateInfo vertexInput = {};
+    vertexInput.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
+
+    VkPipelineInputAssemblyStateCreateInfo inputAssembly = {};
+    inputAssembly.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
+    inputAssembly.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+
+    VkPipelineViewportStateCreateInfo viewportState = {};
+    viewportState.sType = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
+    viewportState.viewportCount = 1;
+    viewportState.scissorCount = 1;
+
+    VkPipelineRasterizationStateCreateInfo rasterization = {};
+    rasterization.sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
+    rasterization.polygonMode = VK_POLYGON_MODE_FILL;
+    rasterization.cullMode = VK_CULL_MODE_NONE;
+    rasterization.frontFace = VK_FRONT_FACE_COUNTER_CLOCKWISE;
+    rasterization.lineWidth = 1.0f;
+
+    VkPipelineMultisampleStateCreateInfo multisample = {};
+    multisample.sType = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO;
+    multisample.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT;
+
+    VkPipelineColorBlendAttachmentState blendAttachment = {};
+    blendAttachment.colorWriteMask = VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT | VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT;
+
+    VkPipelineColorBlendStateCreateInfo colorBlend = {};
+    colorBlend.sType = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO;
+    colorBlend.attachmentCount = 1;
+    colorBlend.pAttachments = &blendAttachment;
+
+    VkDynamicState dynamicStates[2] = { VK_DYNAMIC_STATE_VIEWPORT, VK_DYNAMIC_STATE_SCISSOR };
+
+    VkPipelineDynamicStateCreateInfo dynamicState = {};
+    dynamicState.sType = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
+    dynamicState.dynamicStateCount = 2;
+    dynamicState.pDynamicStates = dynamicStates;
+
+    VkGraphicsPipelineCreateInfo pipelineInfo = {};
+    pipelineInfo.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+    pipelineInfo.stageCount = 2;
+    pipelineInfo.pStages = stages;
+    pipelineInfo.pVertexInputState = &vertexInput;
+    pipelineInfo.pInputAssemblyState = &inputAssembly;
+    pipelineInfo.pViewportState = &viewportState;
+    pipelineInfo.pRasterizationState = &rasterization;
+    pipelineInfo.pMultisampleState = &multisample;
+    pipelineInfo.pColorBlendState = &colorBlend;
+    pipelineInfo.pDynamicState = &dynamicState;
+    pipelineInfo.layout = _pipelineLayout;
+    pipelineInfo.renderPass = _renderPass;
+    pipelineInfo.subpass = 0;
+
+    if (vkCreateGraphicsPipelines(device, context->instance.pipelineCache, 1, &pipelineInfo, nullptr, &_pipeline) != VK_SUCCESS) {
+        LOGE("Could not create pipeline.");
+        _pipeline = VK_NULL_HANDLE;
+        return false;
+    }
+
+    VkDescriptorPoolSize poolSize = { VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, VK_DESCRIPTOR_RING_SIZE * MAX_YCBCR_PLANES };
+
+    VkDescriptorPoolCreateInfo poolInfo = {};
+    poolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+    poolInfo.maxSets = VK_DESCRIPTOR_RING_SIZE;
+    poolInfo.poolSizeCount = 1;
+    poolInfo.pPoolSizes = &poolSize;
+
+    if (vkCreateDescriptorPool(device, &poolInfo, nullptr, &_descriptorPool) != VK_SUCCESS) {
+        LOGE("Could not create descriptor pool.");
+        _descriptorPool = VK_NULL_HANDLE;
+        return false;
+    }
+
+    VkDescriptorSetLayout setLayouts[VK_DESCRIPTOR_RING_SIZE];
+    for (int32_t i = 0; i < VK_DESCRIPTOR_RING_SIZE; i++) {
+        setLayouts[i] = _setLayout;
+        _descriptorSetFrames[i] = NO_FRAME;
+    }
+
+    VkDescriptorSetAllocateInfo allocateInfo = {};
+    allocateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+    allocateInfo.descriptorPool = _descriptorPool;
+    allocateInfo.descriptorSetCount = VK_DESCRIPTOR_RING_SIZE;
+    allocateInfo.pSetLayouts = setLayouts;
+
+    if (vkAllocateDescriptorSets(device, &allocateInfo, _descriptorSets) != VK_SUCCESS) {
+        LOGE("Could not allocate descriptor sets.");
+        return false;
+    }
+
+    _pipelineSampler = sampler;
+    LOGI("Pipeline created (sRGB target: %i).", isSrgbTarget);
+    return true;
+}
+
+void VK_YUVConverter::destroyTarget(uint64_t frameNumber) {
+    VkDevice device = vulkanContext()->instance.device;
+    VkImageView view = _targetView;
+    VkRenderPass renderPass = _renderPass;
+    VkFramebuffer framebuffer = _framebuffer;
+
+    deferVulkanDestroy(frameNumber, [device, view, renderPass, framebuffer]() {
+        vkDestroyFramebuffer(device, framebuffer, nullptr);
+        vkDestroyRenderPass(device, renderPass, nullptr);
+        vkDestroyImageView(device, view, nullptr);
+    });
+
+    _targetImage = VK_NULL_HANDLE;
+    _targetView = VK_NULL_HANDLE;
+    _renderPass = VK_NULL_HANDLE;
+    _framebuffer = VK_NULL_HANDLE;
+}
+
+void VK_YUVConverter::destroyPipeline(uint64_t frameNumber) {
+    VkDevice device = vulkanContext()->instance.device;
+    VkDescriptorPool descriptorPool = _descriptorPool;
+    VkPipeline pipeline = _pipeline;
+    VkPipelineLayout pipelineLayout = _pipelineLayout;
+    VkDescriptorSetLayout setLayout = _setLayout;
+
+    // Destroying the pool frees its sets.
+    deferVulkanDestroy(frameNumber, [device, descriptorPool, pipeline, pipelineLayout, setLayout]() {
+        vkDestroyDescriptorPool(device, descriptorPool, nullptr);
+        vkDestroyPipeline(device, pipeline, nullptr);
+        vkDestroyPipelineLayout(device, pipelineLayout, nullptr);
+        vkDestroyDescriptorSetLayout(device, setLayout, nullptr);
+    });
+
+    for (int32_t i = 0; i < VK_DESCRIPTOR_RING_SIZE; i++) {
+        _descriptorSets[i] = VK_NULL_HANDLE;
+    }
+
+    _pipelineSampler = VK_NULL_HANDLE;
+    _descriptorPool = VK_NULL_HANDLE;
+    _pipeline = VK_NULL_HANDLE;
+    _pipelineLayout = VK_NULL_HANDLE;
+    _setLayout = VK_NULL_HANDLE;
+}
+
+bool VK_YUVConverter::render(const VK_ImageSource& source, const UnityVulkanRecordingState& recordingState) {
+    const VK_ImportedImage* cameraImage = source.image();
+    if (cameraImage == nullptr || source.sampler() == VK_NULL_HANDLE) {
+        return false;
+    }
+
+    const VK_Context* context = vulkanContext();
+    VkDevice device = context->instance.device;
+    uint64_t frameNumber = recordingState.currentFrameNumber;
+
+    UnityVulkanImage target;
+    if (!context->graphics->AccessTexture(_nativeTexture, UnityVulkanWholeImage,
+                                          VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
+                                          VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
+                                          VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT,
+                                          kUnityVulkanResourceAccess_PipelineBarrier, &target)) {
+        LOGE("Could not access render texture.");
+        return false;
+    }
+
+    // The pipeline depends on both the render pass and the source's sampler. Destroying null handles is a no-op,
+    // so partially created objects are cleaned up the same way.
+    if (target.image != _targetImage) {
+        destroyTarget(frameNumber);
+        destroyPipeline(frameNumber);
+
+        if (!createTarget(target)) {
+            destroyTarget(frameNumber);
+            return false;
+        }
+    }
+
+    if (source.sampler() != _pipelineSampler) {
+        destroyPipeline(frameNumber);
+        if (!createPipeline(source.sampler())) {
+            destroyPipeline(frameNumber);
+            return false;
+        }
+    }
+
+    int32_t setIndex = _nextDescriptorSet;
+    if (_descriptorSetFrames[setIndex] != NO_FRAME && _descriptorSetFrames[setIndex] > recordingState.safeFrameNumber) {
+        LOGE("Every descriptor set is still in use, skipping render.");
+        return false;
+    }
+
+    VkDescriptorSet descriptorSet = _descriptorSets[setIndex];
+    _descriptorSetFrames[setIndex] = frameNumber;
+    _nextDescriptorSet = (_nextDescriptorSet + 1) % VK_DESCRIPTOR_RING_SIZE;
+
+    VkDescriptorImageInfo imageInfo = { VK_NULL_HANDLE, cameraImage->view, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL };
+
+    VkWriteDescriptorSet write = {};
+    write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+    write.dstSet = descriptorSet;
+    write.dstBinding = 0;
+    write.descriptorCount = 1;
+    write.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+    write.pImageInfo = &imageInfo;
+    vkUpdateDescriptorSets(device, 1, &write, 0, nullptr);
+
+    VkCommandBuffer commandBuffer = recordingState.commandBuffer;
+
+    // Camera buffers are written by a foreign queue, so ownership is taken before sampling and handed back after.
+    uint32_t ownerFamily = source.ownerQueueFamily();
+    uint32_t samplingFamily = ownerFamily != VK_QUEUE_FAMILY_IGNORED ? context->instance.queueFamilyIndex : VK_QUEUE_FAMILY_IGNORED;
+
+    VkImageMemoryBarrier acquireBarrier = {};
+    acquireBarrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+    acquireBarrier.srcAccessMask = 0;
+    acquireBarrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+    acquireBarrier.oldLayout = VK_IMAGE_LAYOUT_GENERAL;
+    acquireBarrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+    acquireBarrier.srcQueueFamilyIndex = ownerFamily;
+    acquireBarrier.dstQueueFamilyIndex = samplingFamily;
+    acquireBarrier.image = cameraImage->image;
+    acquireBarrier.subresourceRange = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1 };
+
+    vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+                         0, 0, nullptr, 0, nullptr, 1, &acquireBarrier);
+
+    VkRenderPassBeginInfo beginInfo = {};
+    beginInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+    beginInfo.renderPass = _renderPass;
+    beginInfo.framebuffer = _framebuffer;
+    beginInfo.renderArea = { { 0, 0 }, { target.extent.width, target.extent.height } };
+
+    VkViewport viewport = { 0.0f, 0.0f, (float)target.extent.width, (float)target.extent.height, 0.0f, 1.0f };
+    VkRect2D scissor = beginInfo.renderArea;
+
+    vkCmdBeginRenderPass(commandBuffer, &beginInfo, VK_SUBPASS_CONTENTS_INLINE);
+    vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, _pipeline);
+    vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, _pipelineLayout, 0, 1, &descriptorSet, 0, nullptr);
+    vkCmdPushConstants(commandBuffer, _pipelineLayout, VK_SHADER_STAGE_VERTEX_BIT, 0, sizeof(_cropRect), _cropRect);
+    vkCmdSetViewport(commandBuffer, 0, 1, &viewport);
+    vkCmdSetScissor(commandBuffer, 0, 1, &scissor);
+    vkCmdDraw(commandBuffer, 3, 1, 0, 0);
+    vkCmdEndRenderPass(commandBuffer);
+
+    VkImageMemoryBarrier releaseBarrier = acquireBarrier;
+    releaseBarrier.srcAccessMask = VK_ACCESS_SHADER_READ_BIT;
+    releaseBarrier.dstAccessMask = 0;
+    releaseBarrier.oldLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+    releaseBarrier.newLayout = VK_IMAGE_LAYOUT_GENERAL;
+    releaseBarrier.srcQueueFamilyIndex = samplingFamily;
+    releaseBarrier.dstQueueFamilyIndex = ownerFamily;
+
+    vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+                         0, 0, nullptr, 0, nullptr, 1, &releaseBarrier);
+
+    return true;
+}
+
+void VK_YUVConverter::dispose(uint64_t currentFrameNumber) {
+    if (_disposed) {
+        return;
+    }
+
+    _disposed = true;
+    destroyTarget(currentFrameNumber);
+    destroyPipeline(currentFrameNumber);
+
+    VkDevice device = vulkanContext()->instance.device;
+    VkShaderModule vertexShader = _vertexShader;
+    VkShaderModule fragmentShader = _fragmentShader;
+
+    deferVulkanDestroy(currentFrameNumber, [device, vertexShader, fragmentShader]() {
+        vkDestroyShaderModule(device, vertexShader, nullptr);
+        vkDestroyShaderModule(device, fragmentShader, nullptr);
+    });
+
+    _vertexShader = VK_NULL_HANDLE;
+    _fragmentShader = VK_NULL_HANDLE;
+
+    LOGI("Converter disposed.");
+}
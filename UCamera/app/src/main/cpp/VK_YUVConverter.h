@@ -0,0 +1,72 @@
+// Copyright 2026 URAV ADVANCED LEARNING SYSTEMS PRIVATE LIMITED
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef UXR_QUESTCAMERA_VK_YUVCONVERTER_H
+#define UXR_QUESTCAMERA_VK_YUVCONVERTER_H
+
+#include "VK_ImageSource.h"
+
+// Descriptor sets are recycled once the frame which used them has finished on the GPU.
+#define VK_DESCRIPTOR_RING_SIZE 8
+
+// Converts the images of a VK_ImageSource, like a VK_CameraSource, into a Unity texture. The Vulkan counterpart to GLES_YUVConverter,
+// which only supports the plain conversion of a crop rect; filters, layouts and reprojection are GLES only.
+class VK_YUVConverter {
+
+public:
+    VK_YUVConverter(void* nativeTexture, int32_t width, int32_t height, const float cropRect[4]);
+
+    bool initialize();
+
+    // Records the conversion into Unity's current command buffer. Must be called outside of a render pass.
+    bool render(const VK_ImageSource& source, const UnityVulkanRecordingState& recordingState);
+
+    void dispose(uint64_t currentFrameNumber);
+
+private:
+    bool createTarget(const UnityVulkanImage& image);
+    bool createPipeline(VkSampler sampler);
+    void destroyTarget(uint64_t frameNumber);
+    void destroyPipeline(uint64_t frameNumber);
+
+    void* _nativeTexture;
+    int32_t _width; int32_t _height;
+    float _cropRect[4];
+
+    VkShaderModule _vertexShader;
+    VkShaderModule _fragmentShader;
+
+    // Recreated if Unity recreates the texture's image.
+    VkImage _targetImage;
+    VkFormat _targetFormat;
+    VkImageView _targetView;
+    VkRenderPass _renderPass;
+    VkFramebuffer _framebuffer;
+
+    // Recreated if the source's sampler changes, as it is immutable in the set layout.
+    VkSampler _pipelineSampler;
+    VkDescriptorSetLayout _setLayout;
+    VkPipelineLayout _pipelineLayout;
+    VkPipeline _pipeline;
+    VkDescriptorPool _descriptorPool;
+
+    VkDescriptorSet _descriptorSets[VK_DESCRIPTOR_RING_SIZE];
+    uint64_t _descriptorSetFrames[VK_DESCRIPTOR_RING_SIZE];
+    int32_t _nextDescriptorSet;
+
+    bool _disposed;
+};
+
+
+#endif //UXR_QUESTCAMERA_VK_YUVCONVERTER_H
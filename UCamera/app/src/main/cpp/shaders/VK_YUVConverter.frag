@@ -0,0 +1,38 @@
+// Copyright 2026 URAV ADVANCED LEARNING SYSTEMS PRIVATE LIMITED
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#version 450
+
+// Samples the camera image through an immutable YCbCr conversion sampler, which does the YUV to RGB conversion.
+
+// sRGB attachments always encode on write, so the already encoded camera colors are decoded first to store them as-is.
+layout(constant_id = 0) const bool IS_SRGB_TARGET = false;
+
+layout(set = 0, binding = 0) uniform sampler2D cameraImage;
+
+layout(location = 0) in vec2 vTexCoord;
+layout(location = 0) out vec4 outColor;
+
+vec3 srgbToLinear(vec3 color) {
+    return mix(color / 12.92, pow((color + 0.055) / 1.055, vec3(2.4)), step(0.04045, color));
+}
+
+void main() {
+    vec3 color = texture(cameraImage, vTexCoord).rgb;
+    if (IS_SRGB_TARGET) {
+        color = srgbToLinear(color);
+    }
+
+    outColor = vec4(color, 1.0);
+}
@@ -0,0 +1,34 @@
+// Copyright 2026 URAV ADVANCED LEARNING SYSTEMS PRIVATE LIMITED
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#version 450
+
+// Fullscreen triangle which maps the output texture onto the crop rect of the camera image.
+
+layout(push_constant) uniform PushConstants {
+    // (x, y, width, height) in Unity's UV space, where v = 0 is the bottom of the camera image.
+    vec4 cropRect;
+} pushConstants;
+
+layout(location = 0) out vec2 vTexCoord;
+
+void main() {
+    vec2 position = vec2((gl_VertexIndex << 1) & 2, gl_VertexIndex & 2);
+
+    // Unity reads texture rows bottom-up, while camera buffers store their top row first.
+    vec2 uv = pushConstants.cropRect.xy + position * pushConstants.cropRect.zw;
+    vTexCoord = vec2(uv.x, 1.0 - uv.y);
+
+    gl_Position = vec4(position * 2.0 - 1.0, 0.0, 1.0);
+}
@@ -124,11 +124,21 @@ class CameraDeviceManager(private val callbacks: Callbacks) {
     fun initializeGLESSession(
         session: GLESCaptureSessionManager,
         captureTemplate: Int, streamUseCases: LongArray,
-        width: Int, height: Int, sourceTextureId: Int
+        width: Int, height: Int, sourceTextureId: Int, tenBit: Boolean
     ) : Boolean {
 
         val device = getDeviceLogged() ?: return false
-        session.initialize(device, captureTemplate, streamUseCases, width, height, sourceTextureId)
+        session.initialize(device, captureTemplate, streamUseCases, width, height, sourceTextureId, tenBit)
+        return true
+    }
+
+    fun initializeVKSession(
+        session: VKCaptureSessionManager,
+        captureTemplate: Int, streamUseCases: LongArray
+    ) : Boolean {
+
+        val device = getDeviceLogged() ?: return false
+        session.initialize(device, captureTemplate, streamUseCases)
         return true
     }
 
@@ -20,8 +20,10 @@ import android.hardware.camera2.CameraDevice
 import android.hardware.camera2.CaptureFailure
 import android.hardware.camera2.CaptureRequest
 import android.hardware.camera2.TotalCaptureResult
+import android.hardware.camera2.params.DynamicRangeProfiles
 import android.hardware.camera2.params.OutputConfiguration
 import android.hardware.camera2.params.SessionConfiguration
+import android.os.Build
 import android.util.Log
 import android.view.Surface
 import java.util.concurrent.CountDownLatch
@@ -70,6 +72,15 @@ abstract class CaptureSessionManagerBase(
     protected val executor: ExecutorService = Executors.newSingleThreadExecutor()
     private val repeatingRequestLatch = CountDownLatch(2)
 
+    // 10-bit outputs need a 10-bit dynamic range profile, and HLG10 is supported by every 10-bit capable camera.
+    protected fun requestTenBitOutput(outputConfiguration: OutputConfiguration) {
+        if (Build.VERSION.SDK_INT < Build.VERSION_CODES.TIRAMISU) {
+            throw IllegalArgumentException("10-bit outputs need Android 13 or newer.")
+        }
+
+        outputConfiguration.dynamicRangeProfile = DynamicRangeProfiles.HLG10
+    }
+
     protected fun startSession(camera: CameraDevice, outputs: List<OutputConfiguration>, onConfigured: (CameraCaptureSession) -> Unit) {
         if (captureSession != null || isDisposed) {
             Log.e(TAG, "($logPrefix) TRIED TO START SESSION TWICE. THIS IS A FATAL ERROR AND SHOULD NEVER HAPPEN. OPEN A BUG REPORT AT (https://github.com/Uralstech/UXR.QuestCamera) WITH LOGS.")
@@ -183,7 +194,15 @@ abstract class CaptureSessionManagerBase(
     protected fun setupCaptureEvents(captureRequest: CaptureRequest, isRepeatingRequest: Boolean)
         : CameraCaptureSession.CaptureCallback {
         if (!callbacks.shouldRegisterCaptureEvents(captureRequest, isRepeatingRequest)) {
-            return object : CameraCaptureSession.CaptureCallback() { }
+            return object : CameraCaptureSession.CaptureCallback() {
+                override fun onCaptureCompleted(
+                    session: CameraCaptureSession,
+                    request: CaptureRequest,
+                    result: TotalCaptureResult
+                ) {
+                    onCaptureResult(result)
+                }
+            }
         }
 
         Log.i(TAG, "Registering callbacks for capture request.")
@@ -193,6 +212,7 @@ abstract class CaptureSessionManagerBase(
                 request: CaptureRequest,
                 result: TotalCaptureResult
             ) {
+                onCaptureResult(result)
                 callbacks.onCaptureCompleted(request, result)
             }
 
@@ -266,6 +286,9 @@ abstract class CaptureSessionManagerBase(
         return willInvokeCloseCallback
     }
 
+    // Called on the session executor for every completed capture, even if capture events are not registered.
+    protected open fun onCaptureResult(result: TotalCaptureResult) { }
+
     protected open fun disposeCleanup(session: CameraCaptureSession?) { }
 
     protected open fun additionalCloseWork() { }
@@ -24,12 +24,13 @@ import android.os.HandlerThread
 import android.util.Log
 import java.nio.ByteBuffer
 
-open class ContinuousCaptureSessionManager protected constructor(width: Int, height: Int, protected val callbacks: Callbacks, logPrefix: String)
+open class ContinuousCaptureSessionManager protected constructor(
+    width: Int, height: Int, protected val callbacks: Callbacks, logPrefix: String, private val tenBit: Boolean = false)
     : CaptureSessionManagerBase(callbacks, logPrefix)  {
 
     interface Callbacks : CallbacksBase {
 
-        // Buffers MUST be processed synchronously
+        // Buffers MUST be processed synchronously. For 10-bit sessions, they hold P010 samples.
         fun onFrameReady(
             yBuffer: ByteBuffer,
             uBuffer: ByteBuffer,
@@ -44,7 +45,7 @@ open class ContinuousCaptureSessionManager protected constructor(width: Int, hei
     private val imageThread = HandlerThread("ImageReaderThread").apply { start() }
     private val imageHandler = Handler(imageThread.looper)
 
-    protected val imageReader = ImageReader.newInstance(width, height, ImageFormat.YUV_420_888, 3).apply {
+    protected val imageReader = ImageReader.newInstance(width, height, if (tenBit) ImageFormat.YCBCR_P010 else ImageFormat.YUV_420_888, 3).apply {
         setOnImageAvailableListener({
             val image = it.acquireLatestImage() ?: return@setOnImageAvailableListener
 
@@ -63,13 +64,15 @@ open class ContinuousCaptureSessionManager protected constructor(width: Int, hei
             val timestamp = image.timestamp
 
             try {
-                callbacks.onFrameReady(
+                deliverFrame(
                     yBuffer,
                     uBuffer,
                     vBuffer,
                     yPlane.rowStride,
                     uPlane.rowStride,
                     uPlane.pixelStride,
+                    image.width,
+                    image.height,
                     timestamp
                 )
             } catch (ex: Exception) {
@@ -82,6 +85,9 @@ open class ContinuousCaptureSessionManager protected constructor(width: Int, hei
 
     constructor(width: Int, height: Int, callbacks: Callbacks) : this(width, height, callbacks, "ContinuousSession")
 
+    // Captures 10-bit P010 images with the HLG10 dynamic range profile, which needs Android 13.
+    constructor(width: Int, height: Int, callbacks: Callbacks, tenBit: Boolean) : this(width, height, callbacks, "ContinuousSession", tenBit)
+
     internal open fun initialize(
         camera: CameraDevice, captureTemplate: Int, streamUseCases: LongArray
     ) {
@@ -92,6 +98,10 @@ open class ContinuousCaptureSessionManager protected constructor(width: Int, hei
                 if (streamUseCases.isNotEmpty() && Build.VERSION.SDK_INT >= Build.VERSION_CODES.TIRAMISU) {
                     this.streamUseCase = streamUseCases[0]
                 }
+
+                if (tenBit) {
+                    requestTenBitOutput(this)
+                }
             }
 
             startSession(camera, listOf(outputConfiguration)) { session ->
@@ -100,11 +110,20 @@ open class ContinuousCaptureSessionManager protected constructor(width: Int, hei
         } catch (ex: IllegalArgumentException) {
             close()
 
-            Log.e(TAG, "($logPrefix) Could initialize due to illegal argument (likely streamUseCases)", ex)
+            Log.e(TAG, "($logPrefix) Could initialize due to illegal argument (likely streamUseCases or 10-bit output)", ex)
             callbacks.onConfigureFailed(CustomErrorCodes.ILLEGAL_ARGUMENT)
         }
     }
 
+    // Called on the image thread, the buffers are only valid during the call.
+    protected open fun deliverFrame(
+        yBuffer: ByteBuffer, uBuffer: ByteBuffer, vBuffer: ByteBuffer,
+        yRowStride: Int, uvRowStride: Int, uvPixelStride: Int,
+        width: Int, height: Int, timestamp: Long
+    ) {
+        callbacks.onFrameReady(yBuffer, uBuffer, vBuffer, yRowStride, uvRowStride, uvPixelStride, timestamp)
+    }
+
     override fun additionalCloseWork() {
 
         imageReader.setOnImageAvailableListener(null, imageHandler)
@@ -17,8 +17,12 @@ package com.uralstech.uxr.questcamera
 import android.graphics.SurfaceTexture
 import android.hardware.camera2.CameraCaptureSession
 import android.hardware.camera2.CameraDevice
+import android.hardware.camera2.CaptureResult
+import android.hardware.camera2.TotalCaptureResult
 import android.hardware.camera2.params.OutputConfiguration
 import android.os.Build
+import android.os.Handler
+import android.os.HandlerThread
 import android.util.Log
 import android.view.Surface
 
@@ -31,25 +35,33 @@ class GLESCaptureSessionManager(private val jobTexId: Int, private val callbacks
         }
     }
 
+    private val frameAvailableThread = HandlerThread("SurfaceTextureThread").apply { start() }
+    private val frameAvailableHandler = Handler(frameAvailableThread.looper)
+
     private var surface: Surface? = null
     private var surfaceTexture: SurfaceTexture? = null
     private var isBoundToJob = false
 
     internal fun initialize(
         camera: CameraDevice, captureTemplate: Int, streamUseCases: LongArray,
-        width: Int, height: Int, sourceTextureId: Int
+        width: Int, height: Int, sourceTextureId: Int, tenBit: Boolean
     ) {
         Log.i(TAG, "($logPrefix) Initializing session.")
 
         try {
-            val surfaceTexture = SurfaceTexture(sourceTextureId)
+            // Without a texture, the SurfaceTexture is created detached, and attached natively once the job is set up.
+            // This lets the camera be configured while the render thread sets up the job.
+            val detached = sourceTextureId == 0
+            val surfaceTexture = if (detached) SurfaceTexture(false) else SurfaceTexture(sourceTextureId)
             this.surfaceTexture = surfaceTexture
 
             val surface = Surface(surfaceTexture)
             this.surface = surface
 
             surfaceTexture.setDefaultBufferSize(width, height)
-            if (!bindJob(jobTexId, surfaceTexture)) {
+            surfaceTexture.setOnFrameAvailableListener({ notifyFrameAvailable(jobTexId) }, frameAvailableHandler)
+
+            if (!bindJob(jobTexId, surfaceTexture, detached)) {
                 close()
 
                 Log.e(TAG, "($logPrefix) Failed to bind to native job.")
@@ -62,6 +74,10 @@ class GLESCaptureSessionManager(private val jobTexId: Int, private val callbacks
                 if (streamUseCases.isNotEmpty() && Build.VERSION.SDK_INT >= Build.VERSION_CODES.TIRAMISU) {
                     this.streamUseCase = streamUseCases[0]
                 }
+
+                if (tenBit) {
+                    requestTenBitOutput(this)
+                }
             }
 
             startSession(camera, listOf(outputConfiguration)) { session ->
@@ -70,7 +86,7 @@ class GLESCaptureSessionManager(private val jobTexId: Int, private val callbacks
         } catch (ex: IllegalArgumentException) {
             close()
 
-            Log.e(TAG, "($logPrefix) Could initialize due to illegal argument (likely streamUseCases)", ex)
+            Log.e(TAG, "($logPrefix) Could initialize due to illegal argument (likely streamUseCases or 10-bit output)", ex)
             callbacks.onConfigureFailed(CustomErrorCodes.ILLEGAL_ARGUMENT)
         } catch (ex: Surface.OutOfResourcesException) {
             close()
@@ -80,6 +96,23 @@ class GLESCaptureSessionManager(private val jobTexId: Int, private val callbacks
         }
     }
 
+    override fun onCaptureResult(result: TotalCaptureResult) {
+        if (!isBoundToJob) {
+            return
+        }
+
+        val sensorTimestamp = result.get(CaptureResult.SENSOR_TIMESTAMP) ?: return
+        pushCaptureMetadata(
+            jobTexId,
+            sensorTimestamp,
+            result.frameNumber,
+            result.get(CaptureResult.SENSOR_EXPOSURE_TIME) ?: -1L,
+            result.get(CaptureResult.SENSOR_FRAME_DURATION) ?: -1L,
+            result.get(CaptureResult.SENSOR_ROLLING_SHUTTER_SKEW) ?: -1L,
+            result.get(CaptureResult.SENSOR_SENSITIVITY) ?: -1
+        )
+    }
+
     override fun disposeCleanup(session: CameraCaptureSession?) {
         if (isBoundToJob) {
             unbindJob(jobTexId)
@@ -89,6 +122,9 @@ class GLESCaptureSessionManager(private val jobTexId: Int, private val callbacks
 
     override fun additionalCloseWork() {
 
+        surfaceTexture?.setOnFrameAvailableListener(null)
+        frameAvailableThread.quitSafely()
+
         surface?.release()
         surface = null
 
@@ -98,6 +134,11 @@ class GLESCaptureSessionManager(private val jobTexId: Int, private val callbacks
         Log.i(TAG, "($logPrefix) Textures released.")
     }
 
-    private external fun bindJob(jobTexId: Int, surfaceTexture: SurfaceTexture): Boolean
+    private external fun bindJob(jobTexId: Int, surfaceTexture: SurfaceTexture, detached: Boolean): Boolean
     private external fun unbindJob(jobTexId: Int)
+    private external fun notifyFrameAvailable(jobTexId: Int)
+    private external fun pushCaptureMetadata(
+        jobTexId: Int, sensorTimestamp: Long, frameNumber: Long,
+        exposureTime: Long, frameDuration: Long, rollingShutterSkew: Long, sensitivity: Int
+    )
 }
\ No newline at end of file
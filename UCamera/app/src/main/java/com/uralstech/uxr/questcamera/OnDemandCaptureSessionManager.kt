@@ -16,18 +16,33 @@ package com.uralstech.uxr.questcamera
 
 import android.graphics.SurfaceTexture
 import android.hardware.camera2.CameraAccessException
+import android.hardware.camera2.CameraCaptureSession
 import android.hardware.camera2.CameraDevice
+import android.hardware.camera2.CaptureFailure
+import android.hardware.camera2.CaptureRequest
+import android.hardware.camera2.TotalCaptureResult
 import android.hardware.camera2.params.OutputConfiguration
 import android.os.Build
 import android.util.Log
 import android.view.Surface
+import java.nio.ByteBuffer
 
 class OnDemandCaptureSessionManager(width: Int, height: Int, callbacks: Callbacks)
     : ContinuousCaptureSessionManager(width, height, callbacks, "OnDemandSession") {
 
+    companion object {
+        init {
+            System.loadLibrary("UXRQC_NativeConverters")
+        }
+    }
+
     private var dummySurfaceTexture: SurfaceTexture? = null
     private var dummySurface: Surface? = null
 
+    // The native buffer ring captures are copied into, or 0 if captures go through onFrameReady.
+    @Volatile
+    private var nativeRingId = 0
+
     data class SingleRequestSetResult(
         val status: Int,
         val sequenceId: Int
@@ -82,33 +97,149 @@ class OnDemandCaptureSessionManager(width: Int, height: Int, callbacks: Callback
 
         Log.i(TAG, "($logPrefix) Setting single-capture request.")
 
+        // The slot is reserved before the request is sent, so the image always has somewhere to go.
+        val ringId = nativeRingId
+        val slot = if (ringId != 0) reserveNativeCapture(ringId) else -1
+        if (ringId != 0 && slot < 0) {
+            Log.e(TAG, "($logPrefix) No free native capture buffer.")
+            return SingleRequestSetResult(CustomErrorCodes.OUT_OF_RESOURCES, 0)
+        }
+
         try {
             val request = session.device.createCaptureRequest(captureTemplate).apply {
                 addTarget(imageReader.surface)
                 callbacks.modifyRequestBuilder(this, false)
             }.build()
 
+            val captureEvents = setupCaptureEvents(request, false)
+            val slotCallback = if (slot >= 0) NativeSlotCallback(captureEvents, ringId, slot) else null
+
             val sequenceId = session.captureSingleRequest(
                 request,
                 executor,
-                setupCaptureEvents(request, false)
+                slotCallback ?: captureEvents
             )
 
+            slotCallback?.onSent(sequenceId)
+
             Log.i(TAG, "($logPrefix) Request set.")
             return SingleRequestSetResult(0, sequenceId)
 
         } catch (ex: CameraAccessException) {
+            cancelSlot(ringId, slot)
             Log.e(TAG, "($logPrefix) Could not set request due to access error", ex)
             return SingleRequestSetResult(CustomErrorCodes.CAMERA_ACCESS, 0)
         } catch (ex: IllegalStateException) {
+            cancelSlot(ringId, slot)
             Log.e(TAG, "($logPrefix) Could not set request due to illegal state error", ex)
             return SingleRequestSetResult(CustomErrorCodes.ILLEGAL_STATE, 0)
         } catch (ex: IllegalArgumentException) {
+            cancelSlot(ringId, slot)
             Log.e(TAG, "($logPrefix) Could not set request due to illegal argument", ex)
             return SingleRequestSetResult(CustomErrorCodes.ILLEGAL_ARGUMENT, 0)
         }
     }
 
+    // Sends captures to a native buffer ring instead of onFrameReady, or back to onFrameReady if ringId is 0.
+    fun setNativeCaptureRing(ringId: Int) {
+        nativeRingId = ringId
+    }
+
+    private fun cancelSlot(ringId: Int, slot: Int) {
+        if (slot >= 0) {
+            cancelNativeCapture(ringId, slot, -1)
+        }
+    }
+
+    // Arms a request's native buffer slot once it is sent, and frees it if the request's image will never arrive,
+    // as images are copied into the oldest armed slot and a lost one would otherwise keep its slot armed forever.
+    private inner class NativeSlotCallback(
+        private val captureEvents: CameraCaptureSession.CaptureCallback,
+        private val ringId: Int,
+        private val slot: Int
+    ) : CameraCaptureSession.CaptureCallback() {
+
+        private var sequenceId = -1
+        private var imageLost = false
+
+        @Synchronized
+        fun onSent(sequenceId: Int) {
+            this.sequenceId = sequenceId
+            armNativeCapture(ringId, slot, sequenceId)
+
+            // The capture may fail before captureSingleRequest returns.
+            if (imageLost) {
+                cancelNativeCapture(ringId, slot, sequenceId)
+            }
+        }
+
+        @Synchronized
+        private fun onImageLost() {
+            imageLost = true
+            if (sequenceId >= 0) {
+                cancelNativeCapture(ringId, slot, sequenceId)
+            }
+        }
+
+        override fun onCaptureCompleted(
+            session: CameraCaptureSession,
+            request: CaptureRequest,
+            result: TotalCaptureResult
+        ) {
+            captureEvents.onCaptureCompleted(session, request, result)
+        }
+
+        override fun onCaptureFailed(
+            session: CameraCaptureSession,
+            request: CaptureRequest,
+            failure: CaptureFailure
+        ) {
+            if (!failure.wasImageCaptured()) {
+                onImageLost()
+            }
+
+            captureEvents.onCaptureFailed(session, request, failure)
+        }
+
+        override fun onCaptureBufferLost(
+            session: CameraCaptureSession,
+            request: CaptureRequest,
+            target: Surface,
+            frameNumber: Long
+        ) {
+            if (target == imageReader.surface) {
+                onImageLost()
+            }
+
+            captureEvents.onCaptureBufferLost(session, request, target, frameNumber)
+        }
+
+        override fun onCaptureSequenceCompleted(session: CameraCaptureSession, sequenceId: Int, frameNumber: Long) {
+            captureEvents.onCaptureSequenceCompleted(session, sequenceId, frameNumber)
+        }
+
+        override fun onCaptureSequenceAborted(session: CameraCaptureSession, sequenceId: Int) {
+            onImageLost()
+            captureEvents.onCaptureSequenceAborted(session, sequenceId)
+        }
+    }
+
+    override fun deliverFrame(
+        yBuffer: ByteBuffer, uBuffer: ByteBuffer, vBuffer: ByteBuffer,
+        yRowStride: Int, uvRowStride: Int, uvPixelStride: Int,
+        width: Int, height: Int, timestamp: Long
+    ) {
+        val ringId = nativeRingId
+        if (ringId == 0) {
+            super.deliverFrame(yBuffer, uBuffer, vBuffer, yRowStride, uvRowStride, uvPixelStride, width, height, timestamp)
+            return
+        }
+
+        if (!fillNativeCapture(ringId, yBuffer, uBuffer, vBuffer, yRowStride, uvRowStride, uvPixelStride, width, height, timestamp)) {
+            Log.w(TAG, "($logPrefix) Capture dropped, no armed native buffer.")
+        }
+    }
+
     override fun additionalCloseWork() {
         super.additionalCloseWork()
 
@@ -120,4 +251,12 @@ class OnDemandCaptureSessionManager(width: Int, height: Int, callbacks: Callback
 
         Log.i(TAG, "($logPrefix) Dummy textures released.")
     }
+
+    private external fun reserveNativeCapture(ringId: Int): Int
+    private external fun armNativeCapture(ringId: Int, slot: Int, sequenceId: Int)
+    private external fun cancelNativeCapture(ringId: Int, slot: Int, sequenceId: Int)
+    private external fun fillNativeCapture(
+        ringId: Int, yBuffer: ByteBuffer, uBuffer: ByteBuffer, vBuffer: ByteBuffer,
+        yRowStride: Int, uvRowStride: Int, uvPixelStride: Int, width: Int, height: Int, timestamp: Long
+    ): Boolean
 }
\ No newline at end of file
@@ -0,0 +1,86 @@
+// Copyright 2026 URAV ADVANCED LEARNING SYSTEMS PRIVATE LIMITED
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package com.uralstech.uxr.questcamera
+
+import android.hardware.camera2.CameraCaptureSession
+import android.hardware.camera2.CameraDevice
+import android.hardware.camera2.params.OutputConfiguration
+import android.os.Build
+import android.util.Log
+import android.view.Surface
+
+class VKCaptureSessionManager(private val jobId: Int, private val callbacks: CallbacksBase)
+    : CaptureSessionManagerBase(callbacks, "VKSession") {
+
+    companion object {
+        init {
+            System.loadLibrary("UXRQC_NativeConverters")
+        }
+    }
+
+    private var surface: Surface? = null
+    private var isBoundToJob = false
+
+    internal fun initialize(camera: CameraDevice, captureTemplate: Int, streamUseCases: LongArray) {
+        Log.i(TAG, "($logPrefix) Initializing session.")
+
+        try {
+            // The surface feeds the native job's AImageReader, which is sized by the job.
+            val surface = getJobSurface(jobId)
+            if (surface == null) {
+                close()
+
+                Log.e(TAG, "($logPrefix) Failed to bind to native job.")
+                callbacks.onConfigureFailed(CustomErrorCodes.NATIVE_FAILED_JOB_BINDING)
+                return
+            }
+
+            this.surface = surface
+            isBoundToJob = true
+
+            val outputConfiguration = OutputConfiguration(surface).apply {
+                if (streamUseCases.isNotEmpty() && Build.VERSION.SDK_INT >= Build.VERSION_CODES.TIRAMISU) {
+                    this.streamUseCase = streamUseCases[0]
+                }
+            }
+
+            startSession(camera, listOf(outputConfiguration)) { session ->
+                setRepeatingRequest(session, surface, captureTemplate)
+            }
+        } catch (ex: IllegalArgumentException) {
+            close()
+
+            Log.e(TAG, "($logPrefix) Could initialize due to illegal argument (likely streamUseCases)", ex)
+            callbacks.onConfigureFailed(CustomErrorCodes.ILLEGAL_ARGUMENT)
+        }
+    }
+
+    override fun disposeCleanup(session: CameraCaptureSession?) {
+        if (isBoundToJob) {
+            unbindJob(jobId)
+            isBoundToJob = false
+        }
+    }
+
+    override fun additionalCloseWork() {
+        surface?.release()
+        surface = null
+
+        Log.i(TAG, "($logPrefix) Surface released.")
+    }
+
+    private external fun getJobSurface(jobId: Int): Surface?
+    private external fun unbindJob(jobId: Int)
+}
\ No newline at end of file
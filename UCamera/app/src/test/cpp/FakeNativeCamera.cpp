@@ -0,0 +1,104 @@
+// Copyright 2026 URAV ADVANCED LEARNING SYSTEMS PRIVATE LIMITED
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "FakeNativeCamera.h"
+
+using namespace std;
+
+FakeNativeCamera::FakeNativeCamera()
+    : _config(), _startCount(0), _stopCount(0), _heldImages(0) {
+}
+
+FakeNativeCamera::~FakeNativeCamera() {
+    stop();
+}
+
+bool FakeNativeCamera::start(const CameraStreamConfig& config, CameraListener* listener) {
+    _config = config;
+    _startCount++;
+
+    _listenerGate.open(listener);
+    deliverState(CAMERASTATE_OPENING);
+    return true;
+}
+
+void FakeNativeCamera::stop() {
+    if (_listenerGate.close()) {
+        _stopCount++;
+    }
+}
+
+void FakeNativeCamera::releaseImage(void* handle) {
+    delete static_cast<FakeImage*>(handle);
+    _heldImages--;
+}
+
+bool FakeNativeCamera::deliverState(int32_t state, int32_t error) {
+    CameraListener* listener = _listenerGate.begin();
+    if (listener == nullptr) {
+        return false;
+    }
+
+    listener->onCameraState(state, error);
+    _listenerGate.end();
+    return true;
+}
+
+bool FakeNativeCamera::deliverImage(int64_t timestamp) {
+    CameraListener* listener = _listenerGate.begin();
+    if (listener == nullptr) {
+        return false;
+    }
+
+    // Like an image reader which has run out of images.
+    if (_heldImages.load() >= _config.maxCpuImages) {
+        _listenerGate.end();
+        return false;
+    }
+
+    // Semi-planar chroma, like most camera HALs: U and V interleaved in one buffer, V one byte after U.
+    int32_t chromaWidth = (_config.width + 1) / 2;
+    int32_t chromaHeight = (_config.height + 1) / 2;
+    auto image = new FakeImage {
+            vector<uint8_t>((size_t)_config.width * _config.height, 128),
+            vector<uint8_t>((size_t)chromaWidth * 2 * chromaHeight, 128)
+    };
+
+    CameraImage cameraImage = {};
+    cameraImage.handle = image;
+    cameraImage.width = _config.width;
+    cameraImage.height = _config.height;
+    cameraImage.timestamp = timestamp;
+    cameraImage.planeCount = 3;
+    cameraImage.planes[0] = { image->y.data(), (int32_t)image->y.size(), _config.width, 1 };
+    cameraImage.planes[1] = { image->uv.data(), (int32_t)image->uv.size() - 1, chromaWidth * 2, 2 };
+    cameraImage.planes[2] = { image->uv.data() + 1, (int32_t)image->uv.size() - 1, chromaWidth * 2, 2 };
+
+    _heldImages++;
+    listener->onCameraImage(cameraImage);
+    _listenerGate.end();
+    return true;
+}
+
+bool FakeNativeCamera::deliverCaptureResult(int64_t sensorTimestamp, const CaptureMetadata& metadata) {
+    CameraListener* listener = _listenerGate.begin();
+    if (listener == nullptr) {
+        return false;
+    }
+
+    listener->onCaptureResult(sensorTimestamp, metadata);
+    _listenerGate.end();
+    return true;
+}
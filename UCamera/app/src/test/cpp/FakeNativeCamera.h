@@ -0,0 +1,69 @@
+// Copyright 2026 URAV ADVANCED LEARNING SYSTEMS PRIVATE LIMITED
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef UXR_QUESTCAMERA_FAKENATIVECAMERA_H
+#define UXR_QUESTCAMERA_FAKENATIVECAMERA_H
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+#include "NativeCamera.h"
+#include "CameraListenerGate.h"
+
+// A NativeCamera without camera hardware. Tests deliver states, images and capture results from any thread,
+// and the fake passes them through the same listener gate as the NDK camera.
+class FakeNativeCamera : public NativeCamera {
+
+public:
+    FakeNativeCamera();
+    ~FakeNativeCamera() override;
+
+    bool start(const CameraStreamConfig& config, CameraListener* listener) override;
+    void stop() override;
+    void releaseImage(void* handle) override;
+
+    // Returns false if the camera is stopped, so the listener was not called.
+    bool deliverState(int32_t state, int32_t error = 0);
+
+    // Delivers a gray YUV_420_888 image of the configured size. Returns false if the camera is stopped,
+    // or if the listener already holds as many images as the config allows.
+    bool deliverImage(int64_t timestamp);
+
+    bool deliverCaptureResult(int64_t sensorTimestamp, const CaptureMetadata& metadata);
+
+    const CameraStreamConfig& config() const { return _config; }
+    uint32_t startCount() const { return _startCount.load(); }
+    uint32_t stopCount() const { return _stopCount.load(); }
+
+    // Images delivered to the listener and not yet released.
+    int32_t heldImages() const { return _heldImages.load(); }
+
+private:
+    struct FakeImage {
+        std::vector<uint8_t> y;
+        std::vector<uint8_t> uv;
+    };
+
+    CameraListenerGate _listenerGate;
+    CameraStreamConfig _config;
+
+    std::atomic<uint32_t> _startCount;
+    std::atomic<uint32_t> _stopCount;
+    std::atomic<int32_t> _heldImages;
+};
+
+
+#endif //UXR_QUESTCAMERA_FAKENATIVECAMERA_H
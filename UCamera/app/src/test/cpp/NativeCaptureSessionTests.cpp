@@ -0,0 +1,260 @@
+// Copyright 2026 URAV ADVANCED LEARNING SYSTEMS PRIVATE LIMITED
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <condition_variable>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "FakeNativeCamera.h"
+#include "FrameBus.h"
+#include "NativeCaptureSession.h"
+
+using namespace std;
+
+#define TEST_WIDTH      64
+#define TEST_HEIGHT     48
+
+// Long enough for any callback to return, short enough that a deadlock fails the test instead of hanging it.
+#define CALLBACK_TIMEOUT chrono::seconds(5)
+
+// Sessions without a GLES source publish CPU frames as camera 0.
+#define CPU_ONLY_CAMERA 0
+
+struct ReceivedFrame {
+    uint32_t producer;
+    uint64_t sequence;
+    int64_t timestamp;
+    int32_t width;
+    int32_t height;
+    int32_t planeCount;
+    int32_t uvPixelStride;
+};
+
+// Records the frames a callback subscriber receives, and runs an optional action inside the callback.
+struct FrameRecorder {
+    mutex framesMutex;
+    vector<ReceivedFrame> frames;
+    function<void(const FrameBusFrame*)> action;
+
+    static void onFrame(const FrameBusFrame* frame, void* userData) {
+        auto recorder = static_cast<FrameRecorder*>(userData);
+        {
+            lock_guard<mutex> lock(recorder->framesMutex);
+            recorder->frames.push_back({ frame->producer, frame->sequence, frame->timestamp, frame->width,
+                                         frame->height, frame->planeCount, frame->planes[1].pixelStride });
+        }
+
+        if (recorder->action) {
+            recorder->action(frame);
+        }
+    }
+
+    size_t count() {
+        lock_guard<mutex> lock(framesMutex);
+        return frames.size();
+    }
+};
+
+class NativeCaptureSessionTest : public ::testing::Test {
+
+protected:
+    void SetUp() override {
+        camera = make_shared<FakeNativeCamera>();
+        session = make_shared<NativeCaptureSession>(7, camera, nullptr, true);
+        subscriber = 0;
+    }
+
+    void TearDown() override {
+        if (subscriber != 0) {
+            frameBus().unsubscribe(subscriber);
+        }
+
+        session->stop();
+    }
+
+    void subscribe() {
+        subscriber = frameBus().subscribe(CPU_ONLY_CAMERA, FRAMEBUS_FORMAT_YUV420_CPU, FrameRecorder::onFrame, &recorder);
+        ASSERT_NE(subscriber, 0u);
+    }
+
+    void startStreaming() {
+        ASSERT_TRUE(session->start("0", TEST_WIDTH, TEST_HEIGHT, 1, nullptr));
+        ASSERT_TRUE(camera->deliverState(CAMERASTATE_STREAMING));
+        ASSERT_EQ(session->state(), CAMERASTATE_STREAMING);
+    }
+
+    shared_ptr<FakeNativeCamera> camera;
+    shared_ptr<NativeCaptureSession> session;
+    FrameRecorder recorder;
+    uint32_t subscriber;
+};
+
+TEST_F(NativeCaptureSessionTest, StartConfiguresCpuOutput) {
+    ASSERT_TRUE(session->start("1", TEST_WIDTH, TEST_HEIGHT, 3, nullptr));
+
+    EXPECT_EQ(camera->startCount(), 1u);
+    EXPECT_STREQ(camera->config().cameraId, "1");
+    EXPECT_EQ(camera->config().width, TEST_WIDTH);
+    EXPECT_EQ(camera->config().height, TEST_HEIGHT);
+    EXPECT_EQ(camera->config().captureTemplate, 3);
+    EXPECT_EQ(camera->config().window, nullptr);
+    EXPECT_GT(camera->config().maxCpuImages, 0);
+    EXPECT_EQ(session->state(), CAMERASTATE_OPENING);
+}
+
+TEST_F(NativeCaptureSessionTest, PublishesFramesUntilStopped) {
+    subscribe();
+    startStreaming();
+
+    for (int64_t timestamp = 1000; timestamp <= 3000; timestamp += 1000) {
+        ASSERT_TRUE(camera->deliverImage(timestamp));
+    }
+
+    ASSERT_EQ(recorder.count(), 3u);
+    for (size_t i = 0; i < recorder.frames.size(); i++) {
+        const ReceivedFrame& frame = recorder.frames[i];
+        EXPECT_EQ(frame.producer, 7u);
+        EXPECT_EQ(frame.sequence, i + 1);
+        EXPECT_EQ(frame.timestamp, (int64_t)(i + 1) * 1000);
+        EXPECT_EQ(frame.width, TEST_WIDTH);
+        EXPECT_EQ(frame.height, TEST_HEIGHT);
+        EXPECT_EQ(frame.planeCount, 3);
+        EXPECT_EQ(frame.uvPixelStride, 2);
+    }
+
+    // Callback subscribers did not retain the frames, so every image went back to the camera.
+    EXPECT_EQ(camera->heldImages(), 0);
+
+    session->stop();
+    EXPECT_EQ(session->state(), CAMERASTATE_CLOSED);
+    EXPECT_EQ(camera->stopCount(), 1u);
+
+    EXPECT_FALSE(camera->deliverImage(4000));
+    EXPECT_EQ(recorder.count(), 3u);
+}
+
+TEST_F(NativeCaptureSessionTest, RetainedFramesKeepImages) {
+    const FrameBusFrame* retained = nullptr;
+    recorder.action = [&retained](const FrameBusFrame* frame) {
+        FrameBus::retain(frame);
+        retained = frame;
+    };
+
+    subscribe();
+    startStreaming();
+
+    ASSERT_TRUE(camera->deliverImage(1000));
+    ASSERT_NE(retained, nullptr);
+    EXPECT_EQ(camera->heldImages(), 1);
+
+    // Images outlive the session, as the published frame keeps the camera alive.
+    session->stop();
+    EXPECT_EQ(camera->heldImages(), 1);
+
+    FrameBus::release(retained);
+    EXPECT_EQ(camera->heldImages(), 0);
+}
+
+TEST_F(NativeCaptureSessionTest, ReleasesImagesWithoutSubscribers) {
+    startStreaming();
+
+    ASSERT_TRUE(camera->deliverImage(1000));
+    EXPECT_EQ(camera->heldImages(), 0);
+}
+
+TEST_F(NativeCaptureSessionTest, ErrorsUpdateState) {
+    startStreaming();
+
+    ASSERT_TRUE(camera->deliverState(CAMERASTATE_ERRED, 4));
+    EXPECT_EQ(session->state(), CAMERASTATE_ERRED);
+}
+
+// A subscriber stopping the session runs inside the camera's image callback, which used to deadlock.
+TEST_F(NativeCaptureSessionTest, SubscriberCanStopSessionFromCallback) {
+    recorder.action = [this](const FrameBusFrame*) {
+        session->stop();
+    };
+
+    subscribe();
+    startStreaming();
+
+    promise<bool> delivered;
+    future<bool> result = delivered.get_future();
+    thread cameraThread([this, &delivered] {
+        delivered.set_value(camera->deliverImage(1000));
+    });
+
+    if (result.wait_for(CALLBACK_TIMEOUT) != future_status::ready) {
+        cameraThread.detach();
+        FAIL() << "Stopping the session from its own callback deadlocked.";
+    }
+
+    cameraThread.join();
+    EXPECT_TRUE(result.get());
+    EXPECT_EQ(recorder.count(), 1u);
+    EXPECT_EQ(session->state(), CAMERASTATE_CLOSED);
+    EXPECT_EQ(camera->stopCount(), 1u);
+    EXPECT_EQ(camera->heldImages(), 0);
+
+    EXPECT_FALSE(camera->deliverImage(2000));
+}
+
+// stop() on another thread must not return while a callback is still running.
+TEST_F(NativeCaptureSessionTest, StopWaitsForRunningCallbacks) {
+    mutex gateMutex;
+    condition_variable gateChanged;
+    bool entered = false;
+    bool released = false;
+
+    recorder.action = [&](const FrameBusFrame*) {
+        unique_lock<mutex> lock(gateMutex);
+        entered = true;
+        gateChanged.notify_all();
+        gateChanged.wait(lock, [&released] { return released; });
+    };
+
+    subscribe();
+    startStreaming();
+
+    thread cameraThread([this] {
+        camera->deliverImage(1000);
+    });
+
+    {
+        unique_lock<mutex> lock(gateMutex);
+        ASSERT_TRUE(gateChanged.wait_for(lock, CALLBACK_TIMEOUT, [&entered] { return entered; }));
+    }
+
+    future<void> stopped = async(launch::async, [this] {
+        session->stop();
+    });
+
+    EXPECT_EQ(stopped.wait_for(chrono::milliseconds(100)), future_status::timeout);
+
+    {
+        lock_guard<mutex> lock(gateMutex);
+        released = true;
+        gateChanged.notify_all();
+    }
+
+    EXPECT_EQ(stopped.wait_for(CALLBACK_TIMEOUT), future_status::ready);
+    cameraThread.join();
+    EXPECT_EQ(camera->heldImages(), 0);
+}
@@ -0,0 +1,465 @@
+// Copyright 2026 URAV ADVANCED LEARNING SYSTEMS PRIVATE LIMITED
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <gtest/gtest.h>
+#include <cstring>
+#include <vector>
+
+#include "VK_Context.h"
+#include "VK_YUVConverter.h"
+#include "VK_HostImageSource.h"
+
+using namespace std;
+
+#define TEST_WIDTH      64
+#define TEST_HEIGHT     48
+
+// 8-bit values may differ by rounding, and by how the implementation rounds the YCbCr conversion.
+#define COLOR_TOLERANCE 4
+
+// BT.601 narrow range YCbCr of pure red and pure blue.
+static const uint8_t RED_YUV[3] = { 81, 90, 240 };
+static const uint8_t BLUE_YUV[3] = { 41, 240, 110 };
+
+// The Unity texture a converter renders into, passed to it as the native texture pointer.
+struct FakeUnityTexture {
+    VkImage image;
+    VkDeviceMemory memory;
+    VkFormat format;
+    VkExtent3D extent;
+    VkImageLayout layout;
+};
+
+// The parts of Unity's Vulkan renderer the converter uses: its device, the command buffer of the current frame,
+// and texture access, which records a barrier into the layout requested by the converter.
+static UnityVulkanInstance s_instance;
+static VkCommandBuffer s_commandBuffer;
+static uint64_t s_currentFrameNumber;
+
+static UnityVulkanInstance UNITY_INTERFACE_API fakeInstance() {
+    return s_instance;
+}
+
+static bool UNITY_INTERFACE_API fakeCommandRecordingState(UnityVulkanRecordingState* state, UnityVulkanGraphicsQueueAccess) {
+    *state = {};
+    state->commandBuffer = s_commandBuffer;
+    state->commandBufferLevel = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    state->currentFrameNumber = s_currentFrameNumber;
+    state->safeFrameNumber = s_currentFrameNumber - 1;
+    return true;
+}
+
+static bool UNITY_INTERFACE_API fakeAccessTexture(void* nativeTexture, const VkImageSubresource*, VkImageLayout layout,
+                                                  VkPipelineStageFlags stageFlags, VkAccessFlags accessFlags,
+                                                  UnityVulkanResourceAccessMode, UnityVulkanImage* image) {
+    auto texture = static_cast<FakeUnityTexture*>(nativeTexture);
+
+    VkImageMemoryBarrier barrier = {};
+    barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+    barrier.srcAccessMask = VK_ACCESS_MEMORY_WRITE_BIT;
+    barrier.dstAccessMask = accessFlags;
+    barrier.oldLayout = texture->layout;
+    barrier.newLayout = layout;
+    barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.image = texture->image;
+    barrier.subresourceRange = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1 };
+
+    vkCmdPipelineBarrier(s_commandBuffer, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, stageFlags, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+    texture->layout = layout;
+
+    *image = {};
+    image->image = texture->image;
+    image->layout = layout;
+    image->aspect = VK_IMAGE_ASPECT_COLOR_BIT;
+    image->usage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
+    image->format = texture->format;
+    image->extent = texture->extent;
+    image->tiling = VK_IMAGE_TILING_OPTIMAL;
+    image->type = VK_IMAGE_TYPE_2D;
+    image->samples = VK_SAMPLE_COUNT_1_BIT;
+    image->layers = 1;
+    image->mipCount = 1;
+    return true;
+}
+
+static uint32_t findMemoryType(VkPhysicalDevice physicalDevice, uint32_t memoryTypeBits, VkMemoryPropertyFlags properties) {
+    VkPhysicalDeviceMemoryProperties memoryProperties;
+    vkGetPhysicalDeviceMemoryProperties(physicalDevice, &memoryProperties);
+
+    for (uint32_t i = 0; i < memoryProperties.memoryTypeCount; i++) {
+        if ((memoryTypeBits & (1u << i)) != 0 && (memoryProperties.memoryTypes[i].propertyFlags & properties) == properties) {
+            return i;
+        }
+    }
+
+    return UINT32_MAX;
+}
+
+// Fills an NV12 frame whose top half is topYuv and bottom half is bottomYuv.
+static void fillFrame(vector<uint8_t>& yPlane, vector<uint8_t>& uvPlane, const uint8_t topYuv[3], const uint8_t bottomYuv[3]) {
+    yPlane.resize(TEST_WIDTH * TEST_HEIGHT);
+    uvPlane.resize(TEST_WIDTH * (TEST_HEIGHT / 2));
+
+    for (int32_t row = 0; row < TEST_HEIGHT; row++) {
+        memset(yPlane.data() + row * TEST_WIDTH, row < TEST_HEIGHT / 2 ? topYuv[0] : bottomYuv[0], TEST_WIDTH);
+    }
+
+    for (int32_t row = 0; row < TEST_HEIGHT / 2; row++) {
+        const uint8_t* yuv = row < TEST_HEIGHT / 4 ? topYuv : bottomYuv;
+        for (int32_t column = 0; column < TEST_WIDTH; column += 2) {
+            uvPlane[row * TEST_WIDTH + column] = yuv[1];
+            uvPlane[row * TEST_WIDTH + column + 1] = yuv[2];
+        }
+    }
+}
+
+// Runs the Vulkan converter on a Vulkan 1.1 device, like Mesa's lavapipe, with VK_HostImageSource standing in
+// for camera AHardwareBuffers. CPU devices are preferred, so the results do not depend on the host's GPU.
+class VKYUVConverterTest : public ::testing::Test {
+
+protected:
+    void SetUp() override {
+        VkApplicationInfo applicationInfo = {};
+        applicationInfo.sType = VK_STRUCTURE_TYPE_APPLICATION_INFO;
+        applicationInfo.pApplicationName = "UXRQC_NativeTests";
+        applicationInfo.apiVersion = VK_API_VERSION_1_1;
+
+        VkInstanceCreateInfo instanceInfo = {};
+        instanceInfo.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
+        instanceInfo.pApplicationInfo = &applicationInfo;
+
+        if (vkCreateInstance(&instanceInfo, nullptr, &instance) != VK_SUCCESS) {
+            GTEST_SKIP() << "No Vulkan 1.1 implementation is available.";
+        }
+
+        if (!selectPhysicalDevice()) {
+            GTEST_SKIP() << "No device supports sampler YCbCr conversion.";
+        }
+
+        ASSERT_TRUE(createDevice());
+        ASSERT_TRUE(createTarget());
+
+        s_instance = {};
+        s_instance.instance = instance;
+        s_instance.physicalDevice = physicalDevice;
+        s_instance.device = device;
+        s_instance.graphicsQueue = queue;
+        s_instance.getInstanceProcAddr = vkGetInstanceProcAddr;
+        s_instance.queueFamilyIndex = queueFamilyIndex;
+        s_commandBuffer = commandBuffer;
+        s_currentFrameNumber = 1;
+
+        graphics = {};
+        graphics.Instance = fakeInstance;
+        graphics.CommandRecordingState = fakeCommandRecordingState;
+        graphics.AccessTexture = fakeAccessTexture;
+        ASSERT_TRUE(initializeVulkanContext(&graphics));
+    }
+
+    void TearDown() override {
+        if (device != VK_NULL_HANDLE) {
+            vkDeviceWaitIdle(device);
+        }
+
+        // Runs every deferred destruction.
+        shutdownVulkanContext();
+
+        if (device != VK_NULL_HANDLE) {
+            vkDestroyBuffer(device, readbackBuffer, nullptr);
+            vkFreeMemory(device, readbackMemory, nullptr);
+            vkDestroyImage(device, target.image, nullptr);
+            vkFreeMemory(device, target.memory, nullptr);
+            vkDestroyFence(device, fence, nullptr);
+            vkDestroyCommandPool(device, commandPool, nullptr);
+            vkDestroyDevice(device, nullptr);
+        }
+
+        if (instance != VK_NULL_HANDLE) {
+            vkDestroyInstance(instance, nullptr);
+        }
+    }
+
+    bool selectPhysicalDevice() {
+        uint32_t deviceCount = 0;
+        vkEnumeratePhysicalDevices(instance, &deviceCount, nullptr);
+        vector<VkPhysicalDevice> devices(deviceCount);
+        vkEnumeratePhysicalDevices(instance, &deviceCount, devices.data());
+
+        for (VkPhysicalDevice candidate : devices) {
+            VkPhysicalDeviceProperties properties;
+            vkGetPhysicalDeviceProperties(candidate, &properties);
+
+            VkPhysicalDeviceSamplerYcbcrConversionFeatures ycbcrFeatures = {};
+            ycbcrFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SAMPLER_YCBCR_CONVERSION_FEATURES;
+
+            VkPhysicalDeviceFeatures2 features = {};
+            features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+            features.pNext = &ycbcrFeatures;
+            vkGetPhysicalDeviceFeatures2(candidate, &features);
+
+            if (properties.apiVersion < VK_API_VERSION_1_1 || !ycbcrFeatures.samplerYcbcrConversion) {
+                continue;
+            }
+
+            if (physicalDevice == VK_NULL_HANDLE || properties.deviceType == VK_PHYSICAL_DEVICE_TYPE_CPU) {
+                physicalDevice = candidate;
+            }
+        }
+
+        return physicalDevice != VK_NULL_HANDLE;
+    }
+
+    bool createDevice() {
+        uint32_t familyCount = 0;
+        vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice, &familyCount, nullptr);
+        vector<VkQueueFamilyProperties> families(familyCount);
+        vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice, &familyCount, families.data());
+
+        queueFamilyIndex = UINT32_MAX;
+        for (uint32_t i = 0; i < familyCount && queueFamilyIndex == UINT32_MAX; i++) {
+            if ((families[i].queueFlags & VK_QUEUE_GRAPHICS_BIT) != 0) {
+                queueFamilyIndex = i;
+            }
+        }
+
+        if (queueFamilyIndex == UINT32_MAX) {
+            return false;
+        }
+
+        float priority = 1.0f;
+        VkDeviceQueueCreateInfo queueInfo = {};
+        queueInfo.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+        queueInfo.queueFamilyIndex = queueFamilyIndex;
+        queueInfo.queueCount = 1;
+        queueInfo.pQueuePriorities = &priority;
+
+        // Enabled by the plugin's device interception under Unity.
+        VkPhysicalDeviceSamplerYcbcrConversionFeatures ycbcrFeatures = {};
+        ycbcrFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SAMPLER_YCBCR_CONVERSION_FEATURES;
+        ycbcrFeatures.samplerYcbcrConversion = VK_TRUE;
+
+        VkDeviceCreateInfo deviceInfo = {};
+        deviceInfo.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+        deviceInfo.pNext = &ycbcrFeatures;
+        deviceInfo.queueCreateInfoCount = 1;
+        deviceInfo.pQueueCreateInfos = &queueInfo;
+
+        if (vkCreateDevice(physicalDevice, &deviceInfo, nullptr, &device) != VK_SUCCESS) {
+            device = VK_NULL_HANDLE;
+            return false;
+        }
+
+        vkGetDeviceQueue(device, queueFamilyIndex, 0, &queue);
+
+        VkCommandPoolCreateInfo poolInfo = {};
+        poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+        poolInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+        poolInfo.queueFamilyIndex = queueFamilyIndex;
+
+        VkCommandBufferAllocateInfo allocateInfo = {};
+        allocateInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        allocateInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        allocateInfo.commandBufferCount = 1;
+
+        VkFenceCreateInfo fenceInfo = {};
+        fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+
+        return vkCreateCommandPool(device, &poolInfo, nullptr, &commandPool) == VK_SUCCESS
+            && (allocateInfo.commandPool = commandPool, vkAllocateCommandBuffers(device, &allocateInfo, &commandBuffer) == VK_SUCCESS)
+            && vkCreateFence(device, &fenceInfo, nullptr, &fence) == VK_SUCCESS;
+    }
+
+    bool createTarget() {
+        target = {};
+        target.format = VK_FORMAT_R8G8B8A8_UNORM;
+        target.extent = { TEST_WIDTH, TEST_HEIGHT, 1 };
+        target.layout = VK_IMAGE_LAYOUT_UNDEFINED;
+
+        VkImageCreateInfo imageInfo = {};
+        imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+        imageInfo.imageType = VK_IMAGE_TYPE_2D;
+        imageInfo.format = target.format;
+        imageInfo.extent = target.extent;
+        imageInfo.mipLevels = 1;
+        imageInfo.arrayLayers = 1;
+        imageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+        imageInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
+        imageInfo.usage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
+        imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+        imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+
+        if (vkCreateImage(device, &imageInfo, nullptr, &target.image) != VK_SUCCESS) {
+            return false;
+        }
+
+        VkMemoryRequirements requirements;
+        vkGetImageMemoryRequirements(device, target.image, &requirements);
+
+        VkMemoryAllocateInfo allocateInfo = {};
+        allocateInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+        allocateInfo.allocationSize = requirements.size;
+        allocateInfo.memoryTypeIndex = findMemoryType(physicalDevice, requirements.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+
+        if (vkAllocateMemory(device, &allocateInfo, nullptr, &target.memory) != VK_SUCCESS
+            || vkBindImageMemory(device, target.image, target.memory, 0) != VK_SUCCESS) {
+            return false;
+        }
+
+        VkBufferCreateInfo bufferInfo = {};
+        bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+        bufferInfo.size = TEST_WIDTH * TEST_HEIGHT * 4;
+        bufferInfo.usage = VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+        bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+        if (vkCreateBuffer(device, &bufferInfo, nullptr, &readbackBuffer) != VK_SUCCESS) {
+            return false;
+        }
+
+        vkGetBufferMemoryRequirements(device, readbackBuffer, &requirements);
+        allocateInfo.allocationSize = requirements.size;
+        allocateInfo.memoryTypeIndex = findMemoryType(physicalDevice, requirements.memoryTypeBits,
+                                                      VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+
+        return vkAllocateMemory(device, &allocateInfo, nullptr, &readbackMemory) == VK_SUCCESS
+            && vkBindBufferMemory(device, readbackBuffer, readbackMemory, 0) == VK_SUCCESS;
+    }
+
+    void beginFrame() {
+        VkCommandBufferBeginInfo beginInfo = {};
+        beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+
+        vkResetCommandBuffer(commandBuffer, 0);
+        vkBeginCommandBuffer(commandBuffer, &beginInfo);
+    }
+
+    // Copies the target into the readback buffer, then submits the frame and waits for it, like Unity would.
+    bool endFrame() {
+        VkImageMemoryBarrier barrier = {};
+        barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        barrier.srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+        barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+        barrier.oldLayout = target.layout;
+        barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+        barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.image = target.image;
+        barrier.subresourceRange = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1 };
+
+        vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                             0, 0, nullptr, 0, nullptr, 1, &barrier);
+        target.layout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+
+        VkBufferImageCopy region = {};
+        region.imageSubresource = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1 };
+        region.imageExtent = target.extent;
+        vkCmdCopyImageToBuffer(commandBuffer, target.image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, readbackBuffer, 1, &region);
+
+        if (vkEndCommandBuffer(commandBuffer) != VK_SUCCESS) {
+            return false;
+        }
+
+        VkSubmitInfo submitInfo = {};
+        submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.commandBufferCount = 1;
+        submitInfo.pCommandBuffers = &commandBuffer;
+
+        bool finished = vkQueueSubmit(queue, 1, &submitInfo, fence) == VK_SUCCESS
+                        && vkWaitForFences(device, 1, &fence, VK_TRUE, UINT64_MAX) == VK_SUCCESS;
+
+        vkResetFences(device, 1, &fence);
+        collectVulkanGarbage(s_currentFrameNumber++);
+        return finished;
+    }
+
+    void expectPixel(int32_t row, int32_t column, uint8_t red, uint8_t green, uint8_t blue) {
+        void* mapped = nullptr;
+        ASSERT_EQ(vkMapMemory(device, readbackMemory, 0, VK_WHOLE_SIZE, 0, &mapped), VK_SUCCESS);
+
+        const uint8_t* pixel = static_cast<const uint8_t*>(mapped) + (row * TEST_WIDTH + column) * 4;
+        EXPECT_NEAR(pixel[0], red, COLOR_TOLERANCE) << "at row " << row;
+        EXPECT_NEAR(pixel[1], green, COLOR_TOLERANCE) << "at row " << row;
+        EXPECT_NEAR(pixel[2], blue, COLOR_TOLERANCE) << "at row " << row;
+        EXPECT_EQ(pixel[3], 255) << "at row " << row;
+
+        vkUnmapMemory(device, readbackMemory);
+    }
+
+    VkInstance instance = VK_NULL_HANDLE;
+    VkPhysicalDevice physicalDevice = VK_NULL_HANDLE;
+    VkDevice device = VK_NULL_HANDLE;
+    VkQueue queue = VK_NULL_HANDLE;
+    uint32_t queueFamilyIndex = 0;
+
+    VkCommandPool commandPool = VK_NULL_HANDLE;
+    VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
+    VkFence fence = VK_NULL_HANDLE;
+
+    FakeUnityTexture target = {};
+    VkBuffer readbackBuffer = VK_NULL_HANDLE;
+    VkDeviceMemory readbackMemory = VK_NULL_HANDLE;
+
+    IUnityGraphicsVulkan graphics = {};
+};
+
+TEST_F(VKYUVConverterTest, ConvertsHostFrame) {
+    VK_HostImageSource source(TEST_WIDTH, TEST_HEIGHT);
+    if (!source.initialize()) {
+        GTEST_SKIP() << "The device cannot sample two-plane 4:2:0 images.";
+    }
+
+    const float cropRect[4] = { 0.0f, 0.0f, 1.0f, 1.0f };
+    VK_YUVConverter converter(&target, TEST_WIDTH, TEST_HEIGHT, cropRect);
+    ASSERT_TRUE(converter.initialize());
+
+    vector<uint8_t> yPlane;
+    vector<uint8_t> uvPlane;
+    fillFrame(yPlane, uvPlane, RED_YUV, BLUE_YUV);
+
+    beginFrame();
+    source.upload(commandBuffer, yPlane.data(), uvPlane.data());
+
+    UnityVulkanRecordingState recordingState;
+    ASSERT_TRUE(graphics.CommandRecordingState(&recordingState, kUnityVulkanGraphicsQueueAccess_DontCare));
+    ASSERT_TRUE(converter.render(source, recordingState));
+    ASSERT_TRUE(endFrame());
+
+    // Unity's first row is the bottom of the camera image.
+    expectPixel(1, TEST_WIDTH / 2, 0, 0, 255);
+    expectPixel(TEST_HEIGHT - 2, TEST_WIDTH / 2, 255, 0, 0);
+
+    // The converter's set layout holds the source's sampler, so it is destroyed first.
+    converter.dispose(s_currentFrameNumber);
+    collectVulkanGarbage(UINT64_MAX);
+}
+
+TEST_F(VKYUVConverterTest, SkipsSourceWithoutFrame) {
+    VK_HostImageSource source(TEST_WIDTH, TEST_HEIGHT);
+    if (!source.initialize()) {
+        GTEST_SKIP() << "The device cannot sample two-plane 4:2:0 images.";
+    }
+
+    const float cropRect[4] = { 0.0f, 0.0f, 1.0f, 1.0f };
+    VK_YUVConverter converter(&target, TEST_WIDTH, TEST_HEIGHT, cropRect);
+    ASSERT_TRUE(converter.initialize());
+
+    UnityVulkanRecordingState recordingState;
+    ASSERT_TRUE(graphics.CommandRecordingState(&recordingState, kUnityVulkanGraphicsQueueAccess_DontCare));
+    EXPECT_FALSE(converter.render(source, recordingState));
+
+    converter.dispose(s_currentFrameNumber);
+    collectVulkanGarbage(UINT64_MAX);
+}
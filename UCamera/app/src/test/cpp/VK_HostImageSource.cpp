@@ -0,0 +1,294 @@
+// Copyright 2026 URAV ADVANCED LEARNING SYSTEMS PRIVATE LIMITED
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "VK_HostImageSource.h"
+#include "NativeLog.h"
+#include <cstring>
+
+#define TAG "UXRQC.VKHostSource"
+#define LOGE(...) NATIVE_LOG(ANDROID_LOG_ERROR, TAG, __VA_ARGS__)
+
+#define HOST_IMAGE_FORMAT VK_FORMAT_G8_B8R8_2PLANE_420_UNORM
+
+// Needed to sample HOST_IMAGE_FORMAT through a YCbCr conversion with the settings below.
+#define REQUIRED_FORMAT_FEATURES (VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT                \
+                                  | VK_FORMAT_FEATURE_TRANSFER_DST_BIT              \
+                                  | VK_FORMAT_FEATURE_MIDPOINT_CHROMA_SAMPLES_BIT)
+
+using namespace std;
+
+static uint32_t findMemoryType(uint32_t memoryTypeBits, VkMemoryPropertyFlags properties) {
+    VkPhysicalDeviceMemoryProperties memoryProperties;
+    vkGetPhysicalDeviceMemoryProperties(vulkanContext()->instance.physicalDevice, &memoryProperties);
+
+    for (uint32_t i = 0; i < memoryProperties.memoryTypeCount; i++) {
+        if ((memoryTypeBits & (1u << i)) != 0 && (memoryProperties.memoryTypes[i].propertyFlags & properties) == properties) {
+            return i;
+        }
+    }
+
+    return UINT32_MAX;
+}
+
+VK_HostImageSource::VK_HostImageSource(int32_t width, int32_t height) {
+    _width = width;
+    _height = height;
+
+    _conversion = VK_NULL_HANDLE;
+    _sampler = VK_NULL_HANDLE;
+    _image = {};
+
+    _stagingBuffer = VK_NULL_HANDLE;
+    _stagingMemory = VK_NULL_HANDLE;
+    _stagingData = nullptr;
+
+    _hasFrame = false;
+}
+
+VK_HostImageSource::~VK_HostImageSource() {
+    dispose();
+}
+
+bool VK_HostImageSource::initialize() {
+    const VK_Context* context = vulkanContext();
+    VkDevice device = context->instance.device;
+
+    VkFormatProperties formatProperties;
+    vkGetPhysicalDeviceFormatProperties(context->instance.physicalDevice, HOST_IMAGE_FORMAT, &formatProperties);
+    if ((formatProperties.optimalTilingFeatures & REQUIRED_FORMAT_FEATURES) != REQUIRED_FORMAT_FEATURES) {
+        LOGE("Two-plane 4:2:0 images cannot be sampled through a YCbCr conversion.");
+        return false;
+    }
+
+    // Like a camera's suggested conversion, with nearest filtering, which every implementation supports.
+    VkSamplerYcbcrConversionCreateInfo conversionInfo = {};
+    conversionInfo.sType = VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_CREATE_INFO;
+    conversionInfo.format = HOST_IMAGE_FORMAT;
+    conversionInfo.ycbcrModel = VK_SAMPLER_YCBCR_MODEL_CONVERSION_YCBCR_601;
+    conversionInfo.ycbcrRange = VK_SAMPLER_YCBCR_RANGE_ITU_NARROW;
+    conversionInfo.components = { VK_COMPONENT_SWIZZLE_IDENTITY, VK_COMPONENT_SWIZZLE_IDENTITY, VK_COMPONENT_SWIZZLE_IDENTITY, VK_COMPONENT_SWIZZLE_IDENTITY };
+    conversionInfo.xChromaOffset = VK_CHROMA_LOCATION_MIDPOINT;
+    conversionInfo.yChromaOffset = VK_CHROMA_LOCATION_MIDPOINT;
+    conversionInfo.chromaFilter = VK_FILTER_NEAREST;
+    conversionInfo.forceExplicitReconstruction = VK_FALSE;
+
+    if (context->createSamplerYcbcrConversion(device, &conversionInfo, nullptr, &_conversion) != VK_SUCCESS) {
+        LOGE("Could not create YCbCr conversion.");
+        _conversion = VK_NULL_HANDLE;
+        return false;
+    }
+
+    VkSamplerYcbcrConversionInfo samplerConversionInfo = {};
+    samplerConversionInfo.sType = VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_INFO;
+    samplerConversionInfo.conversion = _conversion;
+
+    VkSamplerCreateInfo samplerInfo = {};
+    samplerInfo.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
+    samplerInfo.pNext = &samplerConversionInfo;
+    samplerInfo.magFilter = VK_FILTER_NEAREST;
+    samplerInfo.minFilter = VK_FILTER_NEAREST;
+    samplerInfo.mipmapMode = VK_SAMPLER_MIPMAP_MODE_NEAREST;
+    samplerInfo.addressModeU = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+    samplerInfo.addressModeV = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+    samplerInfo.addressModeW = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+    samplerInfo.unnormalizedCoordinates = VK_FALSE;
+
+    if (vkCreateSampler(device, &samplerInfo, nullptr, &_sampler) != VK_SUCCESS) {
+        LOGE("Could not create YCbCr sampler.");
+        _sampler = VK_NULL_HANDLE;
+        return false;
+    }
+
+    return createImage() && createStaging();
+}
+
+bool VK_HostImageSource::createImage() {
+    VkDevice device = vulkanContext()->instance.device;
+
+    VkImageCreateInfo imageInfo = {};
+    imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+    imageInfo.imageType = VK_IMAGE_TYPE_2D;
+    imageInfo.format = HOST_IMAGE_FORMAT;
+    imageInfo.extent = { (uint32_t)_width, (uint32_t)_height, 1 };
+    imageInfo.mipLevels = 1;
+    imageInfo.arrayLayers = 1;
+    imageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+    imageInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
+    imageInfo.usage = VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+    imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+
+    if (vkCreateImage(device, &imageInfo, nullptr, &_image.image) != VK_SUCCESS) {
+        LOGE("Could not create host image.");
+        _image.image = VK_NULL_HANDLE;
+        return false;
+    }
+
+    VkMemoryRequirements requirements;
+    vkGetImageMemoryRequirements(device, _image.image, &requirements);
+
+    VkMemoryAllocateInfo allocateInfo = {};
+    allocateInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    allocateInfo.allocationSize = requirements.size;
+    allocateInfo.memoryTypeIndex = findMemoryType(requirements.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+
+    if (allocateInfo.memoryTypeIndex == UINT32_MAX
+        || vkAllocateMemory(device, &allocateInfo, nullptr, &_image.memory) != VK_SUCCESS) {
+        LOGE("Could not allocate host image memory.");
+        _image.memory = VK_NULL_HANDLE;
+        return false;
+    }
+
+    if (vkBindImageMemory(device, _image.image, _image.memory, 0) != VK_SUCCESS) {
+        LOGE("Could not bind host image memory.");
+        return false;
+    }
+
+    VkSamplerYcbcrConversionInfo conversionInfo = {};
+    conversionInfo.sType = VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_INFO;
+    conversionInfo.conversion = _conversion;
+
+    VkImageViewCreateInfo viewInfo = {};
+    viewInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+    viewInfo.pNext = &conversionInfo;
+    viewInfo.image = _image.image;
+    viewInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
+    viewInfo.format = HOST_IMAGE_FORMAT;
+    viewInfo.components = { VK_COMPONENT_SWIZZLE_IDENTITY, VK_COMPONENT_SWIZZLE_IDENTITY, VK_COMPONENT_SWIZZLE_IDENTITY, VK_COMPONENT_SWIZZLE_IDENTITY };
+    viewInfo.subresourceRange = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1 };
+
+    if (vkCreateImageView(device, &viewInfo, nullptr, &_image.view) != VK_SUCCESS) {
+        LOGE("Could not create host image view.");
+        _image.view = VK_NULL_HANDLE;
+        return false;
+    }
+
+    return true;
+}
+
+bool VK_HostImageSource::createStaging() {
+    VkDevice device = vulkanContext()->instance.device;
+
+    // Y at full resolution, followed by interleaved UV at half resolution in both directions.
+    VkDeviceSize size = (VkDeviceSize)_width * _height + (VkDeviceSize)_width * (_height / 2);
+
+    VkBufferCreateInfo bufferInfo = {};
+    bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    bufferInfo.size = size;
+    bufferInfo.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+    bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+    if (vkCreateBuffer(device, &bufferInfo, nullptr, &_stagingBuffer) != VK_SUCCESS) {
+        LOGE("Could not create staging buffer.");
+        _stagingBuffer = VK_NULL_HANDLE;
+        return false;
+    }
+
+    VkMemoryRequirements requirements;
+    vkGetBufferMemoryRequirements(device, _stagingBuffer, &requirements);
+
+    VkMemoryAllocateInfo allocateInfo = {};
+    allocateInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    allocateInfo.allocationSize = requirements.size;
+    allocateInfo.memoryTypeIndex = findMemoryType(requirements.memoryTypeBits,
+                                                  VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+
+    if (allocateInfo.memoryTypeIndex == UINT32_MAX
+        || vkAllocateMemory(device, &allocateInfo, nullptr, &_stagingMemory) != VK_SUCCESS) {
+        LOGE("Could not allocate staging memory.");
+        _stagingMemory = VK_NULL_HANDLE;
+        return false;
+    }
+
+    void* mapped = nullptr;
+    if (vkBindBufferMemory(device, _stagingBuffer, _stagingMemory, 0) != VK_SUCCESS
+        || vkMapMemory(device, _stagingMemory, 0, VK_WHOLE_SIZE, 0, &mapped) != VK_SUCCESS) {
+        LOGE("Could not map staging memory.");
+        return false;
+    }
+
+    _stagingData = static_cast<uint8_t*>(mapped);
+    return true;
+}
+
+void VK_HostImageSource::upload(VkCommandBuffer commandBuffer, const uint8_t* yPlane, const uint8_t* uvPlane) {
+    size_t ySize = (size_t)_width * _height;
+    memcpy(_stagingData, yPlane, ySize);
+    memcpy(_stagingData + ySize, uvPlane, (size_t)_width * (_height / 2));
+
+    // The previous contents are replaced, so the image is transitioned from undefined.
+    VkImageMemoryBarrier barrier = {};
+    barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+    barrier.srcAccessMask = 0;
+    barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+    barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.image = _image.image;
+    barrier.subresourceRange = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1 };
+
+    vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                         0, 0, nullptr, 0, nullptr, 1, &barrier);
+
+    VkBufferImageCopy regions[2] = {};
+    regions[0].bufferOffset = 0;
+    regions[0].imageSubresource = { VK_IMAGE_ASPECT_PLANE_0_BIT, 0, 0, 1 };
+    regions[0].imageExtent = { (uint32_t)_width, (uint32_t)_height, 1 };
+    regions[1].bufferOffset = ySize;
+    regions[1].imageSubresource = { VK_IMAGE_ASPECT_PLANE_1_BIT, 0, 0, 1 };
+    regions[1].imageExtent = { (uint32_t)_width / 2, (uint32_t)_height / 2, 1 };
+
+    vkCmdCopyBufferToImage(commandBuffer, _stagingBuffer, _image.image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 2, regions);
+
+    // Left in the layout camera buffers have while the converter is not sampling them.
+    barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+    barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+    barrier.newLayout = VK_IMAGE_LAYOUT_GENERAL;
+
+    vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+                         0, 0, nullptr, 0, nullptr, 1, &barrier);
+
+    _hasFrame = true;
+}
+
+void VK_HostImageSource::dispose() {
+    const VK_Context* context = vulkanContext();
+    if (context == nullptr) {
+        return;
+    }
+
+    // Destroying null handles is a no-op, so a partially initialized source is cleaned up the same way.
+    VkDevice device = context->instance.device;
+    vkDestroyImageView(device, _image.view, nullptr);
+    vkDestroyImage(device, _image.image, nullptr);
+    vkFreeMemory(device, _image.memory, nullptr);
+    vkDestroyBuffer(device, _stagingBuffer, nullptr);
+    vkFreeMemory(device, _stagingMemory, nullptr);
+    vkDestroySampler(device, _sampler, nullptr);
+
+    if (_conversion != VK_NULL_HANDLE) {
+        context->destroySamplerYcbcrConversion(device, _conversion, nullptr);
+    }
+
+    _image = {};
+    _stagingBuffer = VK_NULL_HANDLE;
+    _stagingMemory = VK_NULL_HANDLE;
+    _stagingData = nullptr;
+    _sampler = VK_NULL_HANDLE;
+    _conversion = VK_NULL_HANDLE;
+    _hasFrame = false;
+}
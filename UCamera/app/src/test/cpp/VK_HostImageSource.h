@@ -0,0 +1,63 @@
+// Copyright 2026 URAV ADVANCED LEARNING SYSTEMS PRIVATE LIMITED
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef UXR_QUESTCAMERA_VK_HOSTIMAGESOURCE_H
+#define UXR_QUESTCAMERA_VK_HOSTIMAGESOURCE_H
+
+#include <cstdint>
+
+#include "VK_ImageSource.h"
+
+// The host-buffer stand-in for VK_CameraSource. Instead of importing AHardwareBuffers, NV12 frames from host memory
+// are uploaded into a two-plane image, which is sampled through the same kind of YCbCr conversion.
+class VK_HostImageSource : public VK_ImageSource {
+
+public:
+    VK_HostImageSource(int32_t width, int32_t height);
+    ~VK_HostImageSource() override;
+
+    // Returns false if the device cannot sample two-plane 4:2:0 images through a YCbCr conversion.
+    bool initialize();
+
+    // Records the upload of an NV12 frame, with tightly packed rows, into commandBuffer. The planes are copied
+    // into the source's staging buffer, which must not be written again before the commands have finished.
+    void upload(VkCommandBuffer commandBuffer, const uint8_t* yPlane, const uint8_t* uvPlane);
+
+    // The device must be idle.
+    void dispose();
+
+    const VK_ImportedImage* image() const override { return _hasFrame ? &_image : nullptr; }
+    VkSampler sampler() const override { return _sampler; }
+    uint32_t ownerQueueFamily() const override { return VK_QUEUE_FAMILY_IGNORED; }
+
+private:
+    bool createImage();
+    bool createStaging();
+
+    int32_t _width; int32_t _height;
+
+    VkSamplerYcbcrConversion _conversion;
+    VkSampler _sampler;
+    VK_ImportedImage _image;
+
+    VkBuffer _stagingBuffer;
+    VkDeviceMemory _stagingMemory;
+    uint8_t* _stagingData;
+
+    bool _hasFrame;
+};
+
+
+#endif //UXR_QUESTCAMERA_VK_HOSTIMAGESOURCE_H
@@ -0,0 +1,40 @@
+// Copyright 2026 URAV ADVANCED LEARNING SYSTEMS PRIVATE LIMITED
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// The parts of the NDK's log.h used by the native library, writing to stderr on the host.
+
+#ifndef UXR_QUESTCAMERA_HOST_ANDROID_LOG_H
+#define UXR_QUESTCAMERA_HOST_ANDROID_LOG_H
+
+#include <cstdio>
+
+enum android_LogPriority {
+    ANDROID_LOG_UNKNOWN = 0,
+    ANDROID_LOG_DEFAULT,
+    ANDROID_LOG_VERBOSE,
+    ANDROID_LOG_DEBUG,
+    ANDROID_LOG_INFO,
+    ANDROID_LOG_WARN,
+    ANDROID_LOG_ERROR,
+    ANDROID_LOG_FATAL,
+    ANDROID_LOG_SILENT
+};
+
+inline int __android_log_write(int priority, const char* tag, const char* text) {
+    return fprintf(stderr, "%i %s: %s\n", priority, tag, text);
+}
+
+
+#endif //UXR_QUESTCAMERA_HOST_ANDROID_LOG_H
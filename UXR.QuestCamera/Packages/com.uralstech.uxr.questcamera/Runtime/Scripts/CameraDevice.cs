@@ -17,6 +17,7 @@ using System.Threading.Tasks;
 using UnityEngine;
 using UnityEngine.Experimental.Rendering;
 using Uralstech.UXR.QuestCamera.GLES;
+using Uralstech.UXR.QuestCamera.Vulkan;
 
 #nullable enable
 namespace Uralstech.UXR.QuestCamera
@@ -140,25 +141,26 @@ namespace Uralstech.UXR.QuestCamera
         }
 
         /// <summary>Creates a continuous capture pipeline (session + linked YUV to RGBA converter) for use.</summary>
-        /// <param name="textureFormat">See <see cref="YUVConverter(Resolution, ComputeShaderKernel, GraphicsFormat)"/> for default texture format.</param>
+        /// <param name="textureFormat">See <see cref="YUVConverter(Resolution, ComputeShaderKernel, GraphicsFormat, CaptureFormat)"/> for default texture format.</param>
         /// <returns>The created pipeline, or <see langword="null"/> if creation failed.</returns>
         /// <inheritdoc cref="CreateContinuousSession"/>
         public CapturePipeline<ContinuousCaptureSession>? CreateContinuousPipeline(Resolution resolution,
-            CaptureTemplate template = CaptureTemplate.Preview, StreamUseCase streamUseCase = StreamUseCase.None, GraphicsFormat textureFormat = GraphicsFormat.None)
+            CaptureTemplate template = CaptureTemplate.Preview, StreamUseCase streamUseCase = StreamUseCase.None, GraphicsFormat textureFormat = GraphicsFormat.None,
+            CaptureFormat captureFormat = CaptureFormat.YUV420_888)
         {
             ThrowIfDisposed();
-            ContinuousCaptureSession session = CreateContinuousSession(resolution, template, streamUseCase);
+            ContinuousCaptureSession session = CreateContinuousSession(resolution, template, streamUseCase, captureFormat);
             if (session.State == ResourceState.Invalid)
                 return null;
 
-            YUVConverter converter = new(resolution, textureFormat);
+            YUVConverter converter = new(resolution, textureFormat, captureFormat);
             session.NativeProxy.OnFrameReady += converter.OnFrameReady;
 
             return new CapturePipeline<ContinuousCaptureSession>(session, converter);
         }
 
         /// <summary>Creates an on-demand capture pipeline (session + linked YUV to RGBA converter) for use.</summary>
-        /// <param name="textureFormat">See <see cref="YUVConverter(Resolution, ComputeShaderKernel, GraphicsFormat)"/> for default texture format.</param>
+        /// <param name="textureFormat">See <see cref="YUVConverter(Resolution, ComputeShaderKernel, GraphicsFormat, CaptureFormat)"/> for default texture format.</param>
         /// <returns>The created pipeline, or <see langword="null"/> if creation failed.</returns>
         /// <inheritdoc cref="CreateOnDemandSession"/>
         public CapturePipeline<OnDemandCaptureSession>? CreateOnDemandPipeline(Resolution resolution,
@@ -180,16 +182,18 @@ namespace Uralstech.UXR.QuestCamera
         /// <param name="resolution">The capture resolution. Must be from <see cref="CameraInfo.SupportedResolutions"/>.</param>
         /// <param name="template">The template to use for the captures.</param>
         /// <param name="streamUseCase">The stream use case for this session. Must be from <see cref="CameraInfo.SupportedStreamUseCases"/> or <see cref="StreamUseCase.None"/>.</param>
+        /// <param name="captureFormat">The sample format of the captured frames.</param>
         /// <returns>Returns the session. Check <see cref="StatefulResource.State"/> (inherited by <see cref="ContinuousCaptureSession"/>) for the state of the session.</returns>
         /// <exception cref="ObjectDisposedException"/>
-        public ContinuousCaptureSession CreateContinuousSession(Resolution resolution, CaptureTemplate template = CaptureTemplate.Preview, StreamUseCase streamUseCase = StreamUseCase.None)
+        public ContinuousCaptureSession CreateContinuousSession(Resolution resolution, CaptureTemplate template = CaptureTemplate.Preview, StreamUseCase streamUseCase = StreamUseCase.None,
+            CaptureFormat captureFormat = CaptureFormat.YUV420_888)
         {
             ThrowIfDisposed();
             long[] streamUseCases = streamUseCase is not StreamUseCase.None
                 ? new long[] { (long)streamUseCase }
                 : Array.Empty<long>();
 
-            ContinuousCaptureSession session = new(resolution);
+            ContinuousCaptureSession session = new(resolution, captureFormat);
 
             bool initResult = _native.Call<bool>("initializeSession", session._native, (int)template, streamUseCases);
             if (!initResult)
@@ -235,29 +239,70 @@ namespace Uralstech.UXR.QuestCamera
         /// <param name="resolution">The capture resolution. Must be from <see cref="CameraInfo.SupportedResolutions"/>.</param>
         /// <param name="template">The template to use for the captures.</param>
         /// <param name="streamUseCase">The stream use case for this session. Must be from <see cref="CameraInfo.SupportedStreamUseCases"/> or <see cref="StreamUseCase.None"/>.</param>
-        /// <param name="textureFormat">The output texture format for the converted frames. See <see cref="GLESCaptureSession(Resolution, GraphicsFormat)"/> for default.</param>
+        /// <param name="textureFormat">The output texture format for the converted frames. See <see cref="GLESCaptureSession(Resolution, GraphicsFormat, CaptureFormat)"/> for default.</param>
+        /// <param name="captureFormat">
+        /// The sample format of the camera stream. With <see cref="CaptureFormat.P010"/>, use a 10 or 16-bit <paramref name="textureFormat"/>
+        /// like <see cref="GraphicsFormat.A2B10G10R10_UNormPack32"/> or <see cref="GraphicsFormat.R16G16B16A16_SFloat"/> to keep the extra precision.
+        /// </param>
         /// <returns>Returns the session. Check <see cref="StatefulResource.State"/> (inherited by <see cref="GLESCaptureSession"/>) for the state of the session.</returns>
         /// <exception cref="ObjectDisposedException"/>
         public async ValueTask<GLESCaptureSession> CreateGLESSessionAsync(Resolution resolution,
             CaptureTemplate template = CaptureTemplate.Preview, StreamUseCase streamUseCase = StreamUseCase.None,
-            GraphicsFormat textureFormat = GraphicsFormat.None)
+            GraphicsFormat textureFormat = GraphicsFormat.None, CaptureFormat captureFormat = CaptureFormat.YUV420_888)
         {
             ThrowIfDisposed();
             long[] streamUseCases = streamUseCase is not StreamUseCase.None
                 ? new long[] { (long)streamUseCase }
                 : Array.Empty<long>();
 
-            GLESCaptureSession session = new(resolution, textureFormat);
-            uint textureId = await session.SetupJobAsync();
+            GLESCaptureSession session = new(resolution, textureFormat, captureFormat);
+
+            // The job is set up on the render thread while the camera is configured with a detached SurfaceTexture,
+            // which is attached to the job's source texture when the first frame is latched.
+            ValueTask<uint> setupTask = session.SetupJobAsync();
+            bool initResult = _native.Call<bool>("initializeGLESSession", session._native, (int)template, streamUseCases, resolution.width, resolution.height, 0,
+                captureFormat == CaptureFormat.P010);
+
+            uint textureId = await setupTask;
+            if (!initResult || textureId == 0)
+            {
+                // Invalidates the session immediately.
+                _ = session.DisposeAsync();
+            }
+
+            return session;
+        }
+
+        /// <summary>Creates a Vulkan based capture session.</summary>
+        /// <remarks>
+        /// This initializes a native capture session backed by an AImageReader and a Vulkan conversion job, and can only be
+        /// used when <see cref="VKAPI.IsAvailable"/>. The returned session must be started manually (e.g., via its run loop or
+        /// single-run methods) and disposed using <see cref="VKCaptureSession.DisposeAsync"/>.
+        /// </remarks>
+        /// <param name="resolution">The capture resolution. Must be from <see cref="CameraInfo.SupportedResolutions"/>.</param>
+        /// <param name="template">The template to use for the captures.</param>
+        /// <param name="streamUseCase">The stream use case for this session. Must be from <see cref="CameraInfo.SupportedStreamUseCases"/> or <see cref="StreamUseCase.None"/>.</param>
+        /// <param name="textureFormat">The output texture format for the converted frames. See <see cref="VKCaptureSession(Resolution, GraphicsFormat)"/> for default.</param>
+        /// <returns>Returns the session. Check <see cref="StatefulResource.State"/> (inherited by <see cref="VKCaptureSession"/>) for the state of the session.</returns>
+        /// <exception cref="ObjectDisposedException"/>
+        public async ValueTask<VKCaptureSession> CreateVKSessionAsync(Resolution resolution,
+            CaptureTemplate template = CaptureTemplate.Preview, StreamUseCase streamUseCase = StreamUseCase.None,
+            GraphicsFormat textureFormat = GraphicsFormat.None)
+        {
+            ThrowIfDisposed();
+            long[] streamUseCases = streamUseCase is not StreamUseCase.None
+                ? new long[] { (long)streamUseCase }
+                : Array.Empty<long>();
 
-            if (textureId == 0)
+            VKCaptureSession session = new(resolution, textureFormat);
+            if (await session.SetupJobAsync() == 0)
             {
                 // Invalidates the session immediately.
                 _ = session.DisposeAsync();
                 return session;
             }
 
-            bool initResult = _native.Call<bool>("initializeGLESSession", session._native, (int)template, streamUseCases, resolution.width, resolution.height, (int)textureId);
+            bool initResult = _native.Call<bool>("initializeVKSession", session._native, (int)template, streamUseCases);
             if (!initResult)
             {
                 // Invalidates the session immediately.
@@ -64,6 +64,21 @@ namespace Uralstech.UXR.QuestCamera
         VideoCall           = 5
     }
 
+    /// <summary>The sample format of camera frames.</summary>
+    public enum CaptureFormat
+    {
+        /// <summary>8-bit YUV 4:2:0 samples, with full range BT.601 colors.</summary>
+        /// <remarks><a href="https://developer.android.com/reference/android/graphics/ImageFormat#YUV_420_888"/></remarks>
+        YUV420_888 = 0,
+
+        /// <summary>10-bit YUV 4:2:0 samples in the high bits of 16-bit words, with narrow range BT.2020 colors and the HLG transfer function.</summary>
+        /// <remarks>
+        /// Needs Android 13 and a camera with 10-bit output support, otherwise the session fails to configure.
+        /// <a href="https://developer.android.com/reference/android/graphics/ImageFormat#YCBCR_P010"/>
+        /// </remarks>
+        P010 = 1,
+    }
+
     public enum PCASupport
     {
         /// <summary>Support status cannot be determined.</summary>
@@ -66,5 +66,16 @@ namespace Uralstech.UXR.QuestCamera
 
             action.Invoke(arg0, arg1);
         }
+
+        public static async Task OnMainThread<T1, T2, T3>(this Action<T1, T2, T3> action, T1 arg0, T2 arg1, T3 arg2)
+        {
+#if UNITY_6000_0_OR_NEWER
+            await Awaitable.MainThreadAsync();
+#else
+            await Awaiters.UnityMainThread;
+#endif
+
+            action.Invoke(arg0, arg1, arg2);
+        }
     }
 }
@@ -91,8 +91,16 @@ namespace Uralstech.UXR.QuestCamera
         }
 
         private const string ClassName = "com.uralstech.uxr.questcamera.ContinuousCaptureSessionManager";
-        
-        public ContinuousCaptureSession(Resolution resolution) : this(resolution, ClassName) { }
+
+        /// <summary>The sample format of the frames given to <see cref="Proxy.OnFrameReady"/>.</summary>
+        public readonly CaptureFormat CaptureFormat;
+
+        /// <param name="captureFormat">The sample format of the captured frames.</param>
+        public ContinuousCaptureSession(Resolution resolution, CaptureFormat captureFormat = CaptureFormat.YUV420_888)
+            : base(MakeProxy(out Proxy proxy), new(ClassName, resolution.width, resolution.height, proxy, captureFormat == CaptureFormat.P010))
+        {
+            CaptureFormat = captureFormat;
+        }
 
         // Creates proxy and returns it via out param so it can be passed to both base and native constructor
         private static Proxy MakeProxy(out Proxy proxy) => proxy = new Proxy();
@@ -14,6 +14,7 @@
 
 using System;
 using System.Runtime.InteropServices;
+using UnityEngine;
 
 #nullable enable
 namespace Uralstech.UXR.QuestCamera.GLES
@@ -33,6 +34,103 @@ namespace Uralstech.UXR.QuestCamera.GLES
         Run         = 3,
     }
 
+    /// <summary>The native backend which runs Render Job events, selected from Unity's active renderer.</summary>
+    public enum ConverterBackend
+    {
+        /// <summary>No backend supports Unity's renderer, or its graphics device has not been created yet. Every job event fails.</summary>
+        None        = 0,
+
+        /// <summary>Jobs are run with OpenGL-ES.</summary>
+        GLES        = 1,
+
+        /// <summary>Jobs are run with Vulkan. Only <see cref="Vulkan.VKConverterJob"/> is supported.</summary>
+        Vulkan      = 2,
+    }
+
+    /// <summary>States of a camera opened natively by <see cref="GLESNativeCaptureSession"/>.</summary>
+    public enum NativeCameraState
+    {
+        /// <summary>The camera is closed, or the session does not exist.</summary>
+        Closed      = 0,
+
+        /// <summary>The camera is being opened and configured.</summary>
+        Opening     = 1,
+
+        /// <summary>The camera is streaming frames.</summary>
+        Streaming   = 2,
+
+        /// <summary>The camera could not be opened, was disconnected or encountered an error.</summary>
+        Erred       = 3,
+    }
+
+    /// <summary>What a Render Job does with each camera frame.</summary>
+    public enum RenderJobMode
+    {
+        /// <summary>Converts the camera frame into the job's render texture.</summary>
+        Convert     = 0,
+
+        /// <summary>Only latches the camera frame, so it can be sampled directly from the external source texture.</summary>
+        Passthrough = 1,
+
+        /// <summary>Converts two camera frames into the layers of the job's 2-layer texture array in one draw, using OVR_multiview.</summary>
+        Stereo      = 2,
+
+        /// <summary>Converts a per-run batch of camera regions into slots of the job's render texture, with one instanced draw.</summary>
+        CropBatch   = 3,
+
+        /// <summary>Renders unconverted luma into the job's render texture and half-resolution chroma into <see cref="RenderJobSetupData.ChromaTextureId"/>.</summary>
+        Planar      = 4,
+    }
+
+    /// <summary>How a Render Job resamples the camera image when the output size differs from the camera size.</summary>
+    public enum RenderJobFilter
+    {
+        /// <summary>Single bilinear tap. Fastest, but aliases when downscaling by more than 2x.</summary>
+        Bilinear    = 0,
+
+        /// <summary>4x4 Catmull-Rom filter, scaled to the downscale ratio.</summary>
+        Bicubic     = 1,
+
+        /// <summary>4x4 Lanczos filter (a = 2), scaled to the downscale ratio. Sharpest, may ring on hard edges.</summary>
+        Lanczos     = 2,
+
+        /// <summary>Averages up to 4x4 bilinear taps over each output pixel. Cheapest clean option for large downscales.</summary>
+        Box         = 3,
+    }
+
+    /// <summary>Which new camera frames a Render Job processes. Skipped frames are latched, but not converted.</summary>
+    public enum RenderJobSamplingMode
+    {
+        /// <summary>Processes every camera frame.</summary>
+        All         = 0,
+
+        /// <summary>Processes one camera frame out of every N, counting dropped frames.</summary>
+        EveryNth    = 1,
+
+        /// <summary>Processes camera frames whose mean luma differs from the last processed frame by more than a threshold.</summary>
+        OnChange    = 2,
+
+        /// <summary>Only processes frames requested with <see cref="GLESJobBase.RequestBurst(int)"/>.</summary>
+        Burst       = 3,
+    }
+
+    /// <summary>Optional behaviours of a Render Job.</summary>
+    [Flags]
+    public enum RenderJobFlags : uint
+    {
+        /// <summary>No optional behaviours.</summary>
+        None        = 0,
+
+        /// <summary>Warps each frame from its capture-time head pose to a display-time head pose, see <see cref="RenderJobReprojection"/>.</summary>
+        Reproject   = 1 << 0,
+
+        /// <summary>
+        /// Converts the job's camera stream as narrow range BT.2020, like <see cref="CaptureFormat.P010"/> streams, instead of full range BT.601.
+        /// Only read from jobs which create a new source; jobs reading another job's source inherit it.
+        /// </summary>
+        BT2020      = 1 << 1,
+    }
+
     /// <summary>Data for <see cref="RenderJobEvent.Setup"/>.</summary>
     [StructLayout(LayoutKind.Sequential)]
     public readonly struct RenderJobSetupData
@@ -46,23 +144,347 @@ namespace Uralstech.UXR.QuestCamera.GLES
         /// <summary>The height of <see cref="RenderTextureId"/>.</summary>
         public readonly int Height;
 
+        /// <summary>The ID of an existing job whose source texture this job should read from, or 0 to create a new source.</summary>
+        public readonly uint SourceJobId;
+
+        /// <summary>For <see cref="RenderJobMode.Stereo"/>, the ID of the job whose source is rendered into the second layer.</summary>
+        public readonly uint SecondSourceJobId;
+
+        /// <summary>The region of the camera image to convert, in normalized UV coordinates.</summary>
+        public readonly Rect CropRect;
+
+        /// <summary>What the job does with each camera frame.</summary>
+        public readonly RenderJobMode Mode;
+
+        /// <summary>The filter used to resample the camera image, for converting modes.</summary>
+        public readonly RenderJobFilter Filter;
+
+        /// <summary>Strength of the contrast-adaptive sharpening applied during conversion, in [0, 1]. 0 disables sharpening.</summary>
+        public readonly float Sharpness;
+
+        /// <summary>Optional behaviours of the job.</summary>
+        public readonly RenderJobFlags Flags;
+
         /// <summary>Method with signature of <see cref="Callback"/>.</summary>
         public readonly IntPtr OnDone;
 
+        /// <summary>The native pointer of the output texture, for backends which can't identify it by <see cref="RenderTextureId"/>, like Vulkan.</summary>
+        public readonly IntPtr NativeTexture;
+
+        /// <summary>For <see cref="RenderJobMode.Planar"/>, the GLES ID of the half-resolution two channel texture which receives chroma.</summary>
+        public readonly uint ChromaTextureId;
+
+        /// <summary>
+        /// For <see cref="RenderJobMode.Convert"/>, the layer count of the texture array <see cref="RenderTextureId"/>, which new frames are written to in turn.
+        /// 0 if <see cref="RenderTextureId"/> is a 2D texture.
+        /// </summary>
+        public readonly int HistoryLayers;
+
         /// <summary>Callback for when the job is setup or the process fails.</summary>
-        /// <param name="nativeTexture">The created texture, or 0 if the operation failed.</param>
+        /// <param name="nativeTexture">The source texture of the job, or 0 if the operation failed.</param>
         /// <param name="renderTextureId"><see cref="RenderTextureId"/>, for lookup.</param>
         public delegate void Callback(uint nativeTexture, uint renderTextureId);
 
         public RenderJobSetupData(uint renderTextureId, int width, int height, IntPtr onDone)
+            : this(renderTextureId, width, height, 0, new Rect(0f, 0f, 1f, 1f), RenderJobMode.Convert, onDone) { }
+
+        public RenderJobSetupData(uint renderTextureId, int width, int height, uint sourceJobId, Rect cropRect, RenderJobMode mode, IntPtr onDone)
+            : this(renderTextureId, width, height, sourceJobId, 0, cropRect, mode, RenderJobFilter.Bilinear, 0f, onDone) { }
+
+        public RenderJobSetupData(uint renderTextureId, int width, int height, uint sourceJobId, uint secondSourceJobId, Rect cropRect, RenderJobMode mode, RenderJobFilter filter, float sharpness, IntPtr onDone)
+            : this(renderTextureId, width, height, sourceJobId, secondSourceJobId, cropRect, mode, filter, sharpness, RenderJobFlags.None, onDone) { }
+
+        public RenderJobSetupData(uint renderTextureId, int width, int height, uint sourceJobId, uint secondSourceJobId, Rect cropRect, RenderJobMode mode, RenderJobFilter filter, float sharpness, RenderJobFlags flags, IntPtr onDone)
+            : this(renderTextureId, width, height, sourceJobId, secondSourceJobId, cropRect, mode, filter, sharpness, flags, onDone, IntPtr.Zero) { }
+
+        public RenderJobSetupData(uint renderTextureId, int width, int height, uint sourceJobId, uint secondSourceJobId, Rect cropRect, RenderJobMode mode, RenderJobFilter filter, float sharpness, RenderJobFlags flags, IntPtr onDone, IntPtr nativeTexture)
+            : this(renderTextureId, width, height, sourceJobId, secondSourceJobId, cropRect, mode, filter, sharpness, flags, onDone, nativeTexture, 0) { }
+
+        public RenderJobSetupData(uint renderTextureId, int width, int height, uint sourceJobId, uint secondSourceJobId, Rect cropRect, RenderJobMode mode, RenderJobFilter filter, float sharpness, RenderJobFlags flags, IntPtr onDone, IntPtr nativeTexture, uint chromaTextureId)
+            : this(renderTextureId, width, height, sourceJobId, secondSourceJobId, cropRect, mode, filter, sharpness, flags, onDone, nativeTexture, chromaTextureId, 0) { }
+
+        public RenderJobSetupData(uint renderTextureId, int width, int height, uint sourceJobId, uint secondSourceJobId, Rect cropRect, RenderJobMode mode, RenderJobFilter filter, float sharpness, RenderJobFlags flags, IntPtr onDone, IntPtr nativeTexture, uint chromaTextureId, int historyLayers)
         {
             RenderTextureId = renderTextureId;
             Width = width;
             Height = height;
+            SourceJobId = sourceJobId;
+            SecondSourceJobId = secondSourceJobId;
+            CropRect = cropRect;
+            Mode = mode;
+            Filter = filter;
+            Sharpness = sharpness;
+            Flags = flags;
             OnDone = onDone;
+            NativeTexture = nativeTexture;
+            ChromaTextureId = chromaTextureId;
+            HistoryLayers = historyLayers;
         }
     }
 
+    /// <summary>Describes how a frame processed by a Render Job relates to the job's previous frames.</summary>
+    [Flags]
+    public enum RenderJobFrameFlags : uint
+    {
+        /// <summary>A new camera frame, directly following the job's previous frame.</summary>
+        None        = 0,
+
+        /// <summary>The job had already processed this camera frame. Converting jobs only re-render repeated frames if their output can change, like crop batches.</summary>
+        Repeated    = 1 << 0,
+
+        /// <summary>Camera frames were skipped since the job's previous frame, see <see cref="RenderJobFrameInfo.DroppedFrames"/>.</summary>
+        Dropped     = 1 << 1,
+    }
+
+    /// <summary>Details of the frame processed by a <see cref="RenderJobEvent.Run"/>, written natively before its callback.</summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public readonly struct RenderJobFrameInfo
+    {
+        /// <summary>The timestamp returned by the SurfaceTexture.</summary>
+        public readonly long Timestamp;
+
+        /// <summary>The GLES ID of the job's external (<c>GL_TEXTURE_EXTERNAL_OES</c>) source texture.</summary>
+        public readonly uint SourceTextureId;
+
+        /// <summary>The texture coordinate transform matrix returned by the SurfaceTexture.</summary>
+        public readonly Matrix4x4 TransformMatrix;
+
+        /// <summary>The job's sequence number of the frame, starting from 1 and incremented for every new camera frame the job processes.</summary>
+        public readonly ulong Sequence;
+
+        /// <summary>The number of camera frames estimated to have been skipped since the job's previous frame.</summary>
+        /// <remarks>Estimated from the gap between frame timestamps and the camera's frame period.</remarks>
+        public readonly uint DroppedFrames;
+
+        /// <summary>How the frame relates to the job's previous frames.</summary>
+        public readonly RenderJobFrameFlags Flags;
+
+        /// <summary>The layer of a <see cref="GLESHistoryJob"/>'s texture array holding the frame, or -1 for other jobs.</summary>
+        public readonly int HistoryLayer;
+    }
+
+    /// <summary>Counters of a Render Job since it was set up, for monitoring throughput.</summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public readonly struct RenderJobCounters
+    {
+        /// <summary>The number of <see cref="RenderJobEvent.Run"/> events received by the job.</summary>
+        public readonly ulong Runs;
+
+        /// <summary>The number of runs which processed a camera frame the job had not processed before.</summary>
+        public readonly ulong Frames;
+
+        /// <summary>The number of runs which processed a camera frame the job had already processed.</summary>
+        public readonly ulong RepeatedFrames;
+
+        /// <summary>The number of camera frames estimated to have been skipped between the job's frames.</summary>
+        public readonly ulong DroppedFrames;
+
+        /// <summary>The number of runs which failed after the camera delivered its first frame.</summary>
+        public readonly ulong FailedRuns;
+
+        /// <summary>The number of new camera frames skipped by the job's <see cref="RenderJobSamplingMode"/>.</summary>
+        public readonly ulong SkippedFrames;
+    }
+
+    /// <summary>Regions rendered by a <see cref="RenderJobMode.CropBatch"/> job, as (x, y, width, height) in normalized UV coordinates.</summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public unsafe struct RenderJobCropBatch
+    {
+        /// <summary>The maximum number of crops in a batch.</summary>
+        public const int MaxCount = 16;
+
+        /// <summary>The number of crops in the batch.</summary>
+        public int Count;
+
+        /// <summary>The regions of the camera image to read, four floats per crop.</summary>
+        public fixed float SourceRects[MaxCount * 4];
+
+        /// <summary>The regions of the render texture to write, four floats per crop.</summary>
+        public fixed float TargetRects[MaxCount * 4];
+    }
+
+    /// <summary>Display-time pose used by jobs set up with <see cref="RenderJobFlags.Reproject"/>.</summary>
+    /// <remarks>
+    /// The capture-time head rotation is looked up from the poses given to <see cref="GLESAPI.PushHeadPose(long, Quaternion, Vector3)"/>.
+    /// The warp is rotation-only, so it is exact for distant content and approximate for nearby content.
+    /// </remarks>
+    [StructLayout(LayoutKind.Sequential)]
+    public struct RenderJobReprojection
+    {
+        /// <summary>The predicted head rotation when the output will be displayed, in the same space as the pushed head poses.</summary>
+        public Quaternion DisplayRotation;
+
+        /// <summary>The rotation of the camera relative to the head.</summary>
+        public Quaternion CameraRotation;
+
+        /// <summary>The camera intrinsics (fx, fy, cx, cy), divided by the camera image resolution.</summary>
+        /// <remarks>The camera looks down +z, with UV x along +x and UV y along +y.</remarks>
+        public Vector4 Intrinsics;
+    }
+
+    /// <summary>Double buffer of <see cref="RenderJobReprojection"/>, which is read by the render thread while it is updated.</summary>
+    /// <remarks>
+    /// To update it, write the pose at index <c>(<see cref="Published"/> + 1) % 2</c>, then increment <see cref="Published"/> with a release write.
+    /// The render thread copies the pose at index <c><see cref="Published"/> % 2</c>, and retries if <see cref="Published"/> changed meanwhile.
+    /// </remarks>
+    [StructLayout(LayoutKind.Sequential)]
+    public struct RenderJobReprojectionBuffer
+    {
+        /// <summary>The number of poses published, which selects the pose read by the render thread.</summary>
+        public uint Published;
+
+        /// <summary>The pose read when <see cref="Published"/> is even.</summary>
+        public RenderJobReprojection Pose0;
+
+        /// <summary>The pose read when <see cref="Published"/> is odd.</summary>
+        public RenderJobReprojection Pose1;
+    }
+
+    /// <summary>Per-frame values from a camera capture result, recorded natively for lookup by frame timestamp.</summary>
+    /// <remarks>Durations are in nanoseconds. Values the camera did not report are -1.</remarks>
+    [StructLayout(LayoutKind.Sequential)]
+    public readonly struct CaptureMetadataRecord
+    {
+        /// <summary>The frame number of the capture.</summary>
+        public readonly long FrameNumber;
+
+        /// <summary>The exposure time of the capture.</summary>
+        public readonly long ExposureTime;
+
+        /// <summary>The duration from the start of this frame to the start of the next.</summary>
+        public readonly long FrameDuration;
+
+        /// <summary>The time between the start of exposure of the first and last rows of the image.</summary>
+        public readonly long RollingShutterSkew;
+
+        /// <summary>The ISO sensitivity of the capture.</summary>
+        public readonly int Sensitivity;
+    }
+
+    /// <summary>Clocks that timestamps can be converted between with <see cref="GLESClocks"/>. All are in nanoseconds.</summary>
+    public enum ClockDomain
+    {
+        /// <summary>The clock of camera frame timestamps, like <see cref="RenderJobFrameInfo.Timestamp"/>.</summary>
+        Camera      = 0,
+
+        /// <summary>The system's <c>CLOCK_MONOTONIC</c>, which all other clocks are mapped to.</summary>
+        Monotonic   = 1,
+
+        /// <summary><see cref="Time.realtimeSinceStartupAsDouble"/>, in nanoseconds.</summary>
+        Unity       = 2,
+    }
+
+    /// <summary>Estimated linear mapping from a <see cref="ClockDomain"/> to <see cref="ClockDomain.Monotonic"/>.</summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public readonly struct ClockFit
+    {
+        /// <summary>A source clock reading.</summary>
+        public readonly long SourceReference;
+
+        /// <summary>The monotonic clock reading at <see cref="SourceReference"/>.</summary>
+        public readonly long TargetReference;
+
+        /// <summary>The rate of the monotonic clock relative to the source clock.</summary>
+        public readonly double Slope;
+
+        /// <summary>The RMS distance of the samples used for the fit from the fit, in nanoseconds.</summary>
+        public readonly long ResidualRms;
+
+        /// <summary>The largest distance of a sample used for the fit from the fit, in nanoseconds.</summary>
+        public readonly long ResidualMax;
+
+        /// <summary>The number of samples in the fitting window.</summary>
+        public readonly int SampleCount;
+
+        /// <summary>The number of samples which were not rejected as outliers.</summary>
+        public readonly int InlierCount;
+
+        /// <summary>The drift of the monotonic clock relative to the source clock, in parts per million.</summary>
+        public double DriftPpm => (Slope - 1.0) * 1e6;
+    }
+
+    /// <summary>Summary of a window of durations, in nanoseconds.</summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public readonly struct JitterStats
+    {
+        /// <summary>The mean duration.</summary>
+        public readonly long Mean;
+
+        /// <summary>The standard deviation of the durations, i.e. the jitter.</summary>
+        public readonly long StandardDeviation;
+
+        /// <summary>The shortest duration.</summary>
+        public readonly long Minimum;
+
+        /// <summary>The longest duration.</summary>
+        public readonly long Maximum;
+
+        /// <summary>The number of durations summarized.</summary>
+        public readonly int Count;
+    }
+
+    /// <summary>A frame of one eye's job, paired by <see cref="GLESStereoSynchronizer"/>.</summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public readonly struct StereoFrame
+    {
+        /// <summary>The ID of the job which rendered the frame.</summary>
+        public readonly uint JobId;
+
+        /// <summary>The job's sequence number of the frame, like <see cref="RenderJobFrameInfo.Sequence"/>.</summary>
+        public readonly ulong Sequence;
+
+        /// <summary>The capture timestamp of the frame.</summary>
+        public readonly long Timestamp;
+    }
+
+    /// <summary>Frames of both cameras captured within a <see cref="GLESStereoSynchronizer"/>'s tolerance.</summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public readonly struct StereoFramePair
+    {
+        /// <summary>The left eye's frame.</summary>
+        public readonly StereoFrame Left;
+
+        /// <summary>The right eye's frame.</summary>
+        public readonly StereoFrame Right;
+
+        /// <summary>The right timestamp minus the left timestamp, in nanoseconds.</summary>
+        public readonly long Delta;
+    }
+
+    /// <summary>Counters of a <see cref="GLESStereoSynchronizer"/>.</summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public readonly struct StereoSyncStats
+    {
+        /// <summary>The number of pairs matched.</summary>
+        public readonly ulong Pairs;
+
+        /// <summary>The number of left frames dropped without a right frame within the tolerance.</summary>
+        public readonly ulong UnpairedLeft;
+
+        /// <summary>The number of right frames dropped without a left frame within the tolerance.</summary>
+        public readonly ulong UnpairedRight;
+
+        /// <summary>The number of pairs replaced in the full queue before being polled.</summary>
+        public readonly ulong DroppedPairs;
+
+        /// <summary>The number of pairs waiting to be polled.</summary>
+        public readonly uint Queued;
+    }
+
+    /// <summary>Counters of the native plugin's logging, see <see cref="GLESAPI.GetNativeLogStats"/>.</summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public readonly struct NativeLogStats
+    {
+        /// <summary>The number of messages logged.</summary>
+        public readonly ulong Logged;
+
+        /// <summary>The number of messages dropped because their call site logged too often.</summary>
+        public readonly ulong Suppressed;
+
+        /// <summary>The number of messages dropped because the log ring was full.</summary>
+        public readonly ulong Overflowed;
+    }
+
     /// <summary>Data for <see cref="RenderJobEvent.Run"/>.</summary>
     [StructLayout(LayoutKind.Sequential)]
     public readonly struct RenderJobRunData
@@ -73,15 +495,33 @@ namespace Uralstech.UXR.QuestCamera.GLES
         /// <summary>Method with signature of <see cref="Callback"/>.</summary>
         public readonly IntPtr OnDone;
 
+        /// <summary>Optional pointer to a <see cref="RenderJobFrameInfo"/>, which is filled before <see cref="OnDone"/> is called.</summary>
+        public readonly IntPtr FrameInfo;
+
+        /// <summary>Pointer to a <see cref="RenderJobCropBatch"/>, for <see cref="RenderJobMode.CropBatch"/> jobs.</summary>
+        public readonly IntPtr CropBatch;
+
+        /// <summary>Pointer to a <see cref="RenderJobReprojectionBuffer"/>, for jobs set up with <see cref="RenderJobFlags.Reproject"/>.</summary>
+        public readonly IntPtr Reprojection;
+
         /// <summary>Callback for when the job finishes rendering or the process fails.</summary>
         /// <param name="timestamp">The timestamp returned by the SurfaceTexture, or -1 if the operation failed.</param>
         /// <param name="renderTextureId"><see cref="RenderTextureId"/>, for lookup.</param>
         public delegate void Callback(long timestamp, uint renderTextureId);
 
-        public RenderJobRunData(uint renderTextureId, IntPtr onDone)
+        public RenderJobRunData(uint renderTextureId, IntPtr onDone) : this(renderTextureId, onDone, IntPtr.Zero) { }
+
+        public RenderJobRunData(uint renderTextureId, IntPtr onDone, IntPtr frameInfo) : this(renderTextureId, onDone, frameInfo, IntPtr.Zero) { }
+
+        public RenderJobRunData(uint renderTextureId, IntPtr onDone, IntPtr frameInfo, IntPtr cropBatch) : this(renderTextureId, onDone, frameInfo, cropBatch, IntPtr.Zero) { }
+
+        public RenderJobRunData(uint renderTextureId, IntPtr onDone, IntPtr frameInfo, IntPtr cropBatch, IntPtr reprojection)
         {
             RenderTextureId = renderTextureId;
             OnDone = onDone;
+            FrameInfo = frameInfo;
+            CropBatch = cropBatch;
+            Reprojection = reprojection;
         }
     }
 
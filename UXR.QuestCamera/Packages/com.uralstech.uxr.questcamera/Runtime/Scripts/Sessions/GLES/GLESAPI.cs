@@ -16,6 +16,8 @@ using AOT;
 using System;
 using System.Collections.Concurrent;
 using System.Runtime.InteropServices;
+using System.Text;
+using System.Threading;
 using UnityEngine;
 
 #nullable enable
@@ -25,9 +27,146 @@ namespace Uralstech.UXR.QuestCamera.GLES
     public static class GLESAPI
     {
         /// <summary>Returns a pointer to the native render job management function.</summary>
+        /// <remarks>Events are run by the backend of Unity's active renderer, see <see cref="ActiveBackend"/>.</remarks>
+        [DllImport("UXRQC_NativeConverters")]
+        public static extern IntPtr getManageConverterJobEvent();
+
+        /// <inheritdoc cref="getManageConverterJobEvent"/>
         [DllImport("UXRQC_NativeConverters")]
         public static extern IntPtr getGLESManageConverterJobEvent();
 
+        [DllImport("UXRQC_NativeConverters")]
+        private static extern int getConverterBackend();
+
+        /// <summary>The native backend which runs job events.</summary>
+        /// <remarks>Selected by the native plugin when Unity creates its graphics device.</remarks>
+        public static ConverterBackend ActiveBackend => (ConverterBackend)getConverterBackend();
+
+        [DllImport("UXRQC_NativeConverters")]
+        [return: MarshalAs(UnmanagedType.U1)]
+        private static extern bool getGLESJobCounters(uint jobId, out RenderJobCounters counters);
+
+        /// <summary>Gets the counters of a job.</summary>
+        /// <remarks>This can be called from any thread.</remarks>
+        /// <returns><see langword="true"/> if the job exists; <see langword="false"/> otherwise.</returns>
+        public static bool TryGetJobCounters(uint jobId, out RenderJobCounters counters) => getGLESJobCounters(jobId, out counters);
+
+        [DllImport("UXRQC_NativeConverters")]
+        private static extern void setGLESDebugOutput([MarshalAs(UnmanagedType.U1)] bool enabled);
+
+        /// <summary>Turns KHR_debug instrumentation of the native converters on or off.</summary>
+        /// <remarks>
+        /// While enabled, GL errors and performance warnings are reported asynchronously by the driver with context,
+        /// converter GL objects are labelled and conversions are wrapped in debug groups, which shows them in GPU captures.
+        /// The render path also stops polling <c>glGetError</c>, so failed renders are only reported in the logs.
+        /// Applied on the render thread when the next job event runs.
+        /// </remarks>
+        public static void SetDebugOutput(bool enabled) => setGLESDebugOutput(enabled);
+
+        [DllImport("UXRQC_NativeConverters")]
+        private static extern void getNativeLogStats(out NativeLogStats stats);
+
+        /// <summary>Gets the counters of the native plugin's logging.</summary>
+        /// <remarks>
+        /// Native messages are rate limited per call site and written to logcat from a background thread,
+        /// so a job failing every frame does not flood logcat from the render thread.
+        /// </remarks>
+        public static NativeLogStats GetNativeLogStats()
+        {
+            getNativeLogStats(out NativeLogStats stats);
+            return stats;
+        }
+
+        [DllImport("UXRQC_NativeConverters")]
+        private static extern unsafe int dumpNativeLogs(byte* buffer, int size);
+
+        /// <summary>Gets the most recent messages logged by the native plugin, oldest first, one per line.</summary>
+        /// <remarks>Useful for attaching to bug reports. Messages dropped by rate limiting are not included.</remarks>
+        public static unsafe string DumpNativeLogs()
+        {
+            byte[] buffer = new byte[32 * 1024];
+            fixed (byte* bufferPtr = buffer)
+            {
+                int length = dumpNativeLogs(bufferPtr, buffer.Length);
+                return Encoding.UTF8.GetString(buffer, 0, Math.Min(length, buffer.Length - 1));
+            }
+        }
+
+        [DllImport("UXRQC_NativeConverters")]
+        [return: MarshalAs(UnmanagedType.U1)]
+        private static extern bool setGLESJobSampling(uint jobId, RenderJobSamplingMode mode, uint interval, float changeThreshold);
+
+        /// <summary>Sets which new camera frames a job processes.</summary>
+        /// <remarks>This can be called from any thread. The next new camera frame is processed in any mode, and <see cref="RenderJobSamplingMode.OnChange"/> drops its previous reference frame.</remarks>
+        /// <returns><see langword="true"/> if the job exists and the parameters are valid; <see langword="false"/> otherwise.</returns>
+        public static bool SetJobSampling(uint jobId, RenderJobSamplingMode mode, uint interval, float changeThreshold) =>
+            setGLESJobSampling(jobId, mode, interval, changeThreshold);
+
+        [DllImport("UXRQC_NativeConverters")]
+        [return: MarshalAs(UnmanagedType.U1)]
+        private static extern bool requestGLESJobBurst(uint jobId, uint frameCount);
+
+        /// <summary>Makes a job process the next consecutive camera frames, regardless of its sampling mode.</summary>
+        /// <remarks>This can be called from any thread. Requests add to any burst still in progress.</remarks>
+        /// <returns><see langword="true"/> if the job exists; <see langword="false"/> otherwise.</returns>
+        public static bool RequestJobBurst(uint jobId, uint frameCount) => requestGLESJobBurst(jobId, frameCount);
+
+        [DllImport("UXRQC_NativeConverters")]
+        private static extern void pushGLESHeadPose(long timestamp, float rx, float ry, float rz, float rw, float px, float py, float pz);
+
+        /// <summary>Records a head pose, used by <see cref="RenderJobFlags.Reproject"/> jobs to find the pose each frame was captured at.</summary>
+        /// <remarks>
+        /// Must be called from one thread only, with increasing timestamps in the same clock as capture timestamps (nanoseconds).
+        /// The last <c>512</c> poses are kept, so poses should be pushed at least as often as frames are captured.
+        /// </remarks>
+        /// <param name="timestamp">When the pose was sampled, in the camera's timestamp clock.</param>
+        /// <param name="rotation">The head rotation.</param>
+        /// <param name="position">The head position.</param>
+        public static void PushHeadPose(long timestamp, Quaternion rotation, Vector3 position) =>
+            pushGLESHeadPose(timestamp, rotation.x, rotation.y, rotation.z, rotation.w, position.x, position.y, position.z);
+
+        [DllImport("UXRQC_NativeConverters")]
+        [return: MarshalAs(UnmanagedType.U1)]
+        private static extern unsafe bool sampleGLESHeadPose(long timestamp, float* rotation, float* position);
+
+        [DllImport("UXRQC_NativeConverters")]
+        [return: MarshalAs(UnmanagedType.U1)]
+        private static extern bool getGLESCaptureMetadata(uint jobId, long timestamp, long maxDelta, out long sensorTimestamp, out CaptureMetadataRecord metadata);
+
+        /// <summary>Interpolates the head pose at a timestamp from the poses given to <see cref="PushHeadPose(long, Quaternion, Vector3)"/>.</summary>
+        /// <remarks>This does not block the thread pushing poses, and can be called from any thread.</remarks>
+        /// <param name="timestamp">The timestamp to sample, in the camera's timestamp clock.</param>
+        /// <param name="rotation">The interpolated head rotation.</param>
+        /// <param name="position">The interpolated head position.</param>
+        /// <returns><see langword="true"/> if <paramref name="timestamp"/> is within the recorded poses; <see langword="false"/> otherwise.</returns>
+        public static unsafe bool TrySampleHeadPose(long timestamp, out Quaternion rotation, out Vector3 position)
+        {
+            float* rawRotation = stackalloc float[4];
+            float* rawPosition = stackalloc float[3];
+
+            if (!sampleGLESHeadPose(timestamp, rawRotation, rawPosition))
+            {
+                rotation = Quaternion.identity;
+                position = Vector3.zero;
+                return false;
+            }
+
+            rotation = new Quaternion(rawRotation[0], rawRotation[1], rawRotation[2], rawRotation[3]);
+            position = new Vector3(rawPosition[0], rawPosition[1], rawPosition[2]);
+            return true;
+        }
+
+        /// <summary>Finds the capture result of the frame closest to a timestamp, for the camera stream read by a job.</summary>
+        /// <remarks>The last <c>64</c> capture results of each stream are kept. This can be called from any thread.</remarks>
+        /// <param name="jobId">The ID of any job reading from the camera stream.</param>
+        /// <param name="timestamp">The frame timestamp, like <see cref="RenderJobFrameInfo.Timestamp"/>.</param>
+        /// <param name="metadata">The capture result of the closest frame.</param>
+        /// <param name="sensorTimestamp">The timestamp of the closest frame.</param>
+        /// <param name="maxDelta">The maximum difference between <paramref name="timestamp"/> and <paramref name="sensorTimestamp"/>, in nanoseconds.</param>
+        /// <returns><see langword="true"/> if a capture result was found; <see langword="false"/> otherwise.</returns>
+        public static bool TryGetCaptureMetadata(uint jobId, long timestamp, out CaptureMetadataRecord metadata, out long sensorTimestamp, long maxDelta = 1_000_000) =>
+            getGLESCaptureMetadata(jobId, timestamp, maxDelta, out sensorTimestamp, out metadata);
+
         /// <summary>Registry of job setup callbacks. This is a single-call registry, i.e. the entry is removed after the callback occurs.</summary>
         public static readonly ConcurrentDictionary<uint, RenderJobSetupData.Callback>      SetupCallbacksRegistry     = new();
 
@@ -37,6 +176,14 @@ namespace Uralstech.UXR.QuestCamera.GLES
         /// <summary>Registry of job run callbacks.</summary>
         public static readonly ConcurrentDictionary<uint, RenderJobRunData.Callback>        RunCallbacksRegistry       = new();
 
+        /// <summary>First ID handed out by <see cref="ReserveVirtualJobId"/>, well above any real GLES texture name.</summary>
+        public const uint FirstVirtualJobId = 0x80000000;
+
+        private static int s_lastVirtualJobId = unchecked((int)(FirstVirtualJobId - 1));
+
+        /// <summary>Reserves a unique ID for a job which does not render into a texture, like <see cref="RenderJobMode.Passthrough"/> jobs.</summary>
+        public static uint ReserveVirtualJobId() => unchecked((uint)Interlocked.Increment(ref s_lastVirtualJobId));
+
         /// <summary>Static marshalled pointer to <see cref="OnRenderJobSetup"/>.</summary>
         public static readonly IntPtr RenderJobSetupCallbackPtr     = Marshal.GetFunctionPointerForDelegate<RenderJobSetupData.Callback>(OnRenderJobSetup);
 
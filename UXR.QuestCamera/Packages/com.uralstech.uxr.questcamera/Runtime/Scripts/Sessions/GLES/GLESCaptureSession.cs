@@ -13,12 +13,10 @@
 // limitations under the License.
 
 using System;
-using System.Runtime.InteropServices;
 using System.Threading;
 using System.Threading.Tasks;
 using UnityEngine;
 using UnityEngine.Experimental.Rendering;
-using UnityEngine.Rendering;
 
 #nullable enable
 namespace Uralstech.UXR.QuestCamera.GLES
@@ -32,218 +30,198 @@ namespace Uralstech.UXR.QuestCamera.GLES
 
         private const string ClassName = "com.uralstech.uxr.questcamera.GLESCaptureSessionManager";
 
-        private static readonly int s_largestDataStructSize = Marshal.SizeOf<RenderJobSetupData>();
-
         /// <summary>Callback for when a frame has been processed, with the frame texture and capture timestamp.</summary>
-        public event Action<Texture2D, long>? OnFrameProcessed;
+        public event Action<Texture2D, long>? OnFrameProcessed
+        {
+            add => Job.OnFrameProcessed += value;
+            remove => Job.OnFrameProcessed -= value;
+        }
 
         /// <summary><see langword="true"/> if a capture was processed this frame; <see langword="false"/> otherwise.</summary>
-        public bool HasNewFrame => _lastUpdateFrame == Time.frameCount;
+        public bool HasNewFrame => Job.HasNewFrame;
 
         /// <summary>The output texture with converted frames.</summary>
         public readonly Texture2D Texture;
 
         /// <summary>The capture timestamp of the last processed frame.</summary>
-        public long CaptureTimestamp { get; private set; }
-
-        private readonly uint _textureId;
-        private int _lastUpdateFrame;
-
-        private readonly CancellationTokenSource _runsCancellation = new();
-        private readonly SemaphoreSlim _eventsSemaphore = new(1, 1);
-
-        private readonly CommandBuffer _eventsCommandBuffer;
-        private readonly IntPtr _eventsDataPtr;
+        public long CaptureTimestamp => Job.CaptureTimestamp;
 
-        private bool _isJobDisposed;
-        private Task? _runsLoop;
+        /// <summary>The native job which owns the camera source and renders into <see cref="Texture"/>.</summary>
+        public readonly GLESConverterJob Job;
 
         private static Proxy MakeProxy(out Proxy proxy) => proxy = new Proxy();
 
-        private static int MakeTexture(Resolution resolution, GraphicsFormat textureFormat, out Texture2D texture, out uint textureId)
-        {
-            if (textureFormat == GraphicsFormat.None)
-                textureFormat = GraphicsFormatUtility.GetGraphicsFormat(RenderTextureFormat.ARGB32, RenderTextureReadWrite.Default);
-
-            if (!GraphicsUtils.IsGraphicsFormatSupportedForRender(textureFormat))
-                throw new ArgumentException($"Format {textureFormat} is not supported on device.", nameof(textureFormat));
+        /// <summary>The sample format of the camera stream.</summary>
+        public readonly CaptureFormat CaptureFormat;
 
-            texture = new Texture2D(resolution.width, resolution.height, textureFormat, TextureCreationFlags.DontUploadUponCreate | TextureCreationFlags.DontInitializePixels);
-            return (int)(textureId = (uint)texture.GetNativeTexturePtr());
+        private static int MakeJob(Resolution resolution, GraphicsFormat textureFormat, CaptureFormat captureFormat, out GLESConverterJob job)
+        {
+            // Jobs created later from this one's source inherit its color conversion natively.
+            RenderJobFlags flags = captureFormat == CaptureFormat.P010 ? RenderJobFlags.BT2020 : RenderJobFlags.None;
+            job = new GLESConverterJob(resolution, textureFormat, 0, new Rect(0f, 0f, 1f, 1f), flags: flags);
+            return (int)job.Id;
         }
 
         /// <param name="textureFormat">If not specified, uses equivalent of <see cref="RenderTextureFormat.ARGB32"/>.</param>
-        public GLESCaptureSession(Resolution resolution, GraphicsFormat textureFormat = GraphicsFormat.None)
-            : base(MakeProxy(out Proxy proxy), new(ClassName, MakeTexture(resolution, textureFormat, out Texture2D texture, out uint textureId), proxy))
+        /// <param name="captureFormat">The sample format of the camera stream, which must match the format the session is initialized with.</param>
+        public GLESCaptureSession(Resolution resolution, GraphicsFormat textureFormat = GraphicsFormat.None, CaptureFormat captureFormat = CaptureFormat.YUV420_888)
+            : base(MakeProxy(out Proxy proxy), new(ClassName, MakeJob(resolution, textureFormat, captureFormat, out GLESConverterJob job), proxy))
         {
-            Texture = texture;
-            _textureId = textureId;
-            
-            _eventsCommandBuffer = new CommandBuffer();
-            _eventsDataPtr = Marshal.AllocHGlobal(s_largestDataStructSize);
-
-            OnFrameProcessed += LastUpdateFrameCallback;
+            Job = job;
+            Texture = job.Texture;
+            CaptureFormat = captureFormat;
         }
 
         /// <summary>Registers the texture and creates a job in the native C++ manager.</summary>
         /// <returns>The ID of the source texture created for the job, which the capture session will render to, or 0 if the operation failed.</returns>
-        public async ValueTask<uint> SetupJobAsync()
+        public ValueTask<uint> SetupJobAsync()
         {
             ThrowIfDisposed();
-            await _eventsSemaphore.WaitAsync();
-
-            try
-            {
-                TaskCompletionSource<uint> tcs = new(TaskCreationOptions.RunContinuationsAsynchronously);
-                void OnComplete(uint textureId, uint _) => tcs.SetResult(textureId);
-
-                GLESAPI.SetupCallbacksRegistry[_textureId] = OnComplete;
-
-                RenderJobSetupData data = new(_textureId, Texture.width, Texture.height, GLESAPI.RenderJobSetupCallbackPtr);
-                Marshal.StructureToPtr(data, _eventsDataPtr, false);
-
-                _eventsCommandBuffer.IssuePluginEventAndData(GLESAPI.getGLESManageConverterJobEvent(), (int)RenderJobEvent.Setup, _eventsDataPtr);
-                Graphics.ExecuteCommandBuffer(_eventsCommandBuffer);
-
-                uint result = await tcs.Task;
-                if (result == 0) // Failure, consider the job disposed.
-                    _isJobDisposed = true;
-                
-                return result;
-            }
-            catch (Exception ex)
-            {
-                Debug.LogException(ex);
-                return 0;
-            }
-            finally
-            {
-                _eventsCommandBuffer.Clear();
-                _eventsSemaphore.Release();
-            }
+            return Job.SetupAsync();
         }
-        /// <summary>Starts continuous frame processing.</summary>
-        /// <param name="maxFramerate">The maximum rate at which frames will be processed by the GLES pipeline.</param>
-        /// <exception cref="InvalidOperationException">Thrown if continuous processing is already active.</exception>
+
+        /// <inheritdoc cref="GLESConverterJob.StartContinuousProcessing(int)"/>
         public void StartContinuousProcessing(int maxFramerate = 60)
         {
             ThrowIfDisposed();
-            if (_runsLoop != null)
-                throw new InvalidOperationException($"Cannot call {nameof(StartContinuousProcessing)} twice!");
+            Job.StartContinuousProcessing(maxFramerate);
+        }
 
-            GLESAPI.RunCallbacksRegistry[_textureId] = OnFrameProcessedNative;
-            _runsLoop = RunsLoopAsync(maxFramerate, _runsCancellation.Token);
+        /// <inheritdoc cref="GLESConverterJob.ProcessSingleFrameAsync(CancellationToken)"/>
+        public ValueTask<(long, Texture2D)> ProcessSingleFrameAsync(CancellationToken token = default)
+        {
+            ThrowIfDisposed();
+            return Job.ProcessSingleFrameAsync(token);
         }
 
-        /// <summary>Processes a single frame and returns the result.</summary>
-        /// <returns>Capture timestamp and updated texture. Timestamp will be -1 if the capture could not be processed.</returns>
-        /// <exception cref="InvalidOperationException">Thrown if continuous processing is active.</exception>
+        /// <inheritdoc cref="GLESAPI.TryGetCaptureMetadata(uint, long, out CaptureMetadataRecord, out long, long)"/>
         /// <exception cref="ObjectDisposedException"/>
-        /// <exception cref="TimeoutException"/>
-        public async ValueTask<(long, Texture2D)> ProcessSingleFrameAsync(CancellationToken token = default)
+        public bool TryGetCaptureMetadata(long timestamp, out CaptureMetadataRecord metadata, out long sensorTimestamp, long maxDelta = 1_000_000)
         {
             ThrowIfDisposed();
-            if (_runsLoop != null)
-                throw new InvalidOperationException($"Cannot call {nameof(ProcessSingleFrameAsync)} on a looping session!");
-
-            TaskCompletionSource<long> tcs = new(TaskCreationOptions.RunContinuationsAsynchronously);
-            void OnComplete(long timestamp, uint _) => tcs.TrySetResult(timestamp);
+            return GLESAPI.TryGetCaptureMetadata(Job.Id, timestamp, out metadata, out sensorTimestamp, maxDelta);
+        }
 
-            if (!await _eventsSemaphore.WaitAsync(1000, token))
-                throw new TimeoutException("Timed out waiting for semaphore!");
+        /// <inheritdoc cref="GLESClocks.TryGetFrameTiming(uint, out JitterStats, out JitterStats)"/>
+        /// <exception cref="ObjectDisposedException"/>
+        public bool TryGetFrameTiming(out JitterStats latency, out JitterStats interval)
+        {
+            ThrowIfDisposed();
+            return GLESClocks.TryGetFrameTiming(Job.Id, out latency, out interval);
+        }
 
-            try
-            {
-                GLESAPI.RunCallbacksRegistry[_textureId] = OnComplete;
+        /// <inheritdoc cref="GLESClocks.TryGetFirstFrameDelay(uint, out long)"/>
+        /// <exception cref="ObjectDisposedException"/>
+        public bool TryGetFirstFrameDelay(out long delay)
+        {
+            ThrowIfDisposed();
+            return GLESClocks.TryGetFirstFrameDelay(Job.Id, out delay);
+        }
 
-                RenderJobRunData data = new(_textureId, GLESAPI.RenderJobRunCallbackPtr);
-                Marshal.StructureToPtr(data, _eventsDataPtr, false);
+        /// <summary>Creates an additional conversion job which reads from this session's camera stream.</summary>
+        /// <remarks>
+        /// The camera frame is only latched once, no matter how many jobs read from it, so this is much
+        /// cheaper than opening another session. The job must be disposed separately with <see cref="GLESConverterJob.DisposeAsync"/>.
+        /// </remarks>
+        /// <param name="resolution">The resolution of the job's output texture.</param>
+        /// <param name="cropRect">The region of the camera image to convert, in normalized UV coordinates. Defaults to the full image.</param>
+        /// <param name="textureFormat">If not specified, uses equivalent of <see cref="RenderTextureFormat.ARGB32"/>.</param>
+        /// <param name="filter">The filter used to resample the camera image. Use <see cref="RenderJobFilter.Box"/> or <see cref="RenderJobFilter.Bicubic"/> for large downscales.</param>
+        /// <param name="sharpness">Strength of the contrast-adaptive sharpening applied during conversion, in [0, 1]. 0 disables sharpening.</param>
+        /// <param name="reproject">Whether frames should be warped to a display-time pose, see <see cref="GLESConverterJob.SetReprojection(Quaternion, Quaternion, Vector4)"/>.</param>
+        /// <returns>The created job, or <see langword="null"/> if creation failed.</returns>
+        /// <exception cref="ObjectDisposedException"/>
+        /// <exception cref="ArgumentOutOfRangeException">Thrown if <paramref name="sharpness"/> is outside [0, 1].</exception>
+        public async ValueTask<GLESConverterJob?> CreateConverterJobAsync(Resolution resolution, Rect? cropRect = null, GraphicsFormat textureFormat = GraphicsFormat.None,
+            RenderJobFilter filter = RenderJobFilter.Bilinear, float sharpness = 0f, bool reproject = false)
+        {
+            ThrowIfDisposed();
+            if (sharpness < 0f || sharpness > 1f)
+                throw new ArgumentOutOfRangeException(nameof(sharpness), "Sharpness must be in the range [0, 1].");
 
-                _eventsCommandBuffer.IssuePluginEventAndData(GLESAPI.getGLESManageConverterJobEvent(), (int)RenderJobEvent.Run, _eventsDataPtr);
-                Graphics.ExecuteCommandBuffer(_eventsCommandBuffer);
+            GLESConverterJob job = new(resolution, textureFormat, Job.Id, cropRect ?? new Rect(0f, 0f, 1f, 1f), filter, sharpness, reproject);
+            if (await job.SetupAsync() != 0)
+                return job;
 
-                long timestamp;
-                using (CancellationTokenRegistration _ = token.Register(tcs.SetCanceled))
-                    timestamp = await tcs.Task;
+            await job.DisposeAsync();
+            return null;
+        }
 
-                return (timestamp, Texture);
-            }
-            finally
-            {
-                _eventsSemaphore.Release();
-                _eventsCommandBuffer.Clear();
-                GLESAPI.RunCallbacksRegistry.TryRemove(_textureId, out _);
-            }
+        /// <summary>Creates a job which converts a batch of regions of this session's camera stream into the slots of one atlas texture.</summary>
+        /// <remarks>The job must be disposed separately with <see cref="GLESJobBase.DisposeAsync"/>.</remarks>
+        /// <param name="slotSize">The resolution of each crop.</param>
+        /// <param name="slotColumns">The number of slot columns in the atlas.</param>
+        /// <param name="slotRows">The number of slot rows in the atlas. There can be at most <see cref="GLESCropBatchJob.MaxCrops"/> slots.</param>
+        /// <param name="textureFormat">If not specified, uses equivalent of <see cref="RenderTextureFormat.ARGB32"/>.</param>
+        /// <param name="filter">The filter used to resample the camera regions.</param>
+        /// <returns>The created job, or <see langword="null"/> if creation failed.</returns>
+        /// <exception cref="ObjectDisposedException"/>
+        /// <exception cref="ArgumentOutOfRangeException">Thrown if the atlas has no slots or too many slots.</exception>
+        public ValueTask<GLESCropBatchJob?> CreateCropBatchJobAsync(Resolution slotSize, int slotColumns, int slotRows,
+            GraphicsFormat textureFormat = GraphicsFormat.None, RenderJobFilter filter = RenderJobFilter.Bilinear)
+        {
+            ThrowIfDisposed();
+            return GLESCropBatchJob.CreateAsync(Job.Id, slotSize, slotColumns, slotRows, textureFormat, filter);
         }
 
-        private async Task RunsLoopAsync(int maxFramerate, CancellationToken token)
+        /// <summary>Creates a job which converts each new frame of this session's camera stream into the next layer of a texture array ring.</summary>
+        /// <remarks>The job must be disposed separately with <see cref="GLESJobBase.DisposeAsync"/>.</remarks>
+        /// <param name="resolution">The resolution of each layer. Can be smaller than the session's own output, to save memory.</param>
+        /// <param name="layers">The number of frames kept in the ring, at least 2.</param>
+        /// <param name="cropRect">The region of the camera image to convert, in normalized UV coordinates. Defaults to the full image.</param>
+        /// <param name="textureFormat">If not specified, uses equivalent of <see cref="RenderTextureFormat.ARGB32"/>.</param>
+        /// <param name="filter">The filter used to resample the camera image. Use <see cref="RenderJobFilter.Box"/> or <see cref="RenderJobFilter.Bicubic"/> for large downscales.</param>
+        /// <returns>The created job, or <see langword="null"/> if creation failed.</returns>
+        /// <exception cref="ObjectDisposedException"/>
+        /// <exception cref="ArgumentOutOfRangeException">Thrown if the ring has too few or too many layers.</exception>
+        public ValueTask<GLESHistoryJob?> CreateHistoryJobAsync(Resolution resolution, int layers, Rect? cropRect = null,
+            GraphicsFormat textureFormat = GraphicsFormat.None, RenderJobFilter filter = RenderJobFilter.Bilinear)
         {
-            try
-            {
-                const float IntervalMargin = 1f / 72f;
-                float minInterval = 1f / maxFramerate;
-
-                RenderJobRunData data = new(_textureId, GLESAPI.RenderJobRunCallbackPtr);
-                Marshal.StructureToPtr(data, _eventsDataPtr, false);
-
-                _eventsCommandBuffer.IssuePluginEventAndData(GLESAPI.getGLESManageConverterJobEvent(), (int)RenderJobEvent.Run, _eventsDataPtr);
-
-                float jobDispatchTime = Time.time;
-                while (!token.IsCancellationRequested)
-                {
-                    if (!await _eventsSemaphore.WaitAsync(1000, token))
-                    {
-                        Debug.LogError("Timed out waiting for job run!");
-                        _eventsSemaphore.Release();
-                        return;
-                    }
-
-                    try
-                    {
-                        float elapsed = Time.time - jobDispatchTime;
-                        float additionalWait = minInterval - elapsed;
-
-                        if (additionalWait > IntervalMargin)
-                        {
-#if UNITY_6000_0_OR_NEWER
-                            await Awaitable.WaitForSecondsAsync(additionalWait, token);
-#else
-                            await Task.Delay((int)(additionalWait * 1000), token);
-#endif
-                        }
-
-                        Graphics.ExecuteCommandBuffer(_eventsCommandBuffer);
-                        jobDispatchTime = Time.time;
-                    }
-                    catch
-                    {
-                        _eventsSemaphore.Release();
-                        throw;
-                    }
-                }
-            }
-            catch (OperationCanceledException) { }
-            catch (Exception ex)
-            {
-                Debug.LogException(ex);
-            }
-            finally
-            {
-                _eventsCommandBuffer.Clear();
-            }
+            ThrowIfDisposed();
+            return GLESHistoryJob.CreateAsync(Job.Id, resolution, layers, cropRect ?? new Rect(0f, 0f, 1f, 1f), textureFormat, filter);
         }
 
-        private void OnFrameProcessedNative(long timestamp, uint renderTextureId)
+        /// <summary>Creates a job which renders this session's camera stream as R8 luma and half-resolution RG8 chroma textures.</summary>
+        /// <remarks>
+        /// Use this for materials which convert YUV to RGB when sampling, with the <c>QuestCameraYUV.hlsl</c> include.
+        /// The job must be disposed separately with <see cref="GLESJobBase.DisposeAsync"/>.
+        /// </remarks>
+        /// <param name="resolution">The resolution of the job's luma texture. The chroma texture is half as large, rounded up.</param>
+        /// <param name="cropRect">The region of the camera image to render, in normalized UV coordinates. Defaults to the full image.</param>
+        /// <param name="filter">The filter used to resample the camera image.</param>
+        /// <param name="sharpness">Strength of the contrast-adaptive sharpening applied to luma, in [0, 1]. 0 disables sharpening.</param>
+        /// <returns>The created job, or <see langword="null"/> if creation failed.</returns>
+        /// <exception cref="ObjectDisposedException"/>
+        /// <exception cref="ArgumentOutOfRangeException">Thrown if <paramref name="sharpness"/> is outside [0, 1].</exception>
+        /// <exception cref="NotSupportedException">Thrown if the device can't render to R8 or RG8 textures.</exception>
+        public ValueTask<GLESPlanarJob?> CreatePlanarJobAsync(Resolution resolution, Rect? cropRect = null,
+            RenderJobFilter filter = RenderJobFilter.Bilinear, float sharpness = 0f)
         {
-            _eventsSemaphore.Release();
-            if (timestamp == -1 || timestamp == CaptureTimestamp)
-                return;
+            ThrowIfDisposed();
+            if (sharpness < 0f || sharpness > 1f)
+                throw new ArgumentOutOfRangeException(nameof(sharpness), "Sharpness must be in the range [0, 1].");
 
-            CaptureTimestamp = timestamp;
-            OnFrameProcessed?.OnMainThread(Texture, timestamp).Forget();
+            return GLESPlanarJob.CreateAsync(Job.Id, resolution, cropRect ?? new Rect(0f, 0f, 1f, 1f), filter, sharpness);
         }
 
-        private void LastUpdateFrameCallback(Texture2D _, long __) => _lastUpdateFrame = Time.frameCount;
+        /// <summary>Creates a job which exposes this session's external camera texture directly, without any conversion.</summary>
+        /// <remarks>
+        /// If the session's own output is not needed, <see cref="StartContinuousProcessing(int)"/> does not have to be called;
+        /// the passthrough job latches camera frames by itself. The job must be disposed separately with <see cref="GLESJobBase.DisposeAsync"/>.
+        /// </remarks>
+        /// <returns>The created job, or <see langword="null"/> if creation failed.</returns>
+        /// <exception cref="ObjectDisposedException"/>
+        public async ValueTask<GLESPassthroughJob?> CreatePassthroughJobAsync()
+        {
+            ThrowIfDisposed();
+
+            GLESPassthroughJob job = new(new Resolution() { width = Texture.width, height = Texture.height }, Job.Id);
+            if (await job.SetupExternalTextureAsync())
+                return job;
+
+            await job.DisposeAsync();
+            return null;
+        }
 
         /// <inheritdoc/>
         public override async ValueTask DisposeAsync()
@@ -254,10 +232,7 @@ namespace Uralstech.UXR.QuestCamera.GLES
             _disposed = true;
             State = ResourceState.Invalid;
 
-            _runsCancellation.Cancel();
-            _runsCancellation.Dispose();
-            if (_runsLoop != null)
-                await _runsLoop;
+            await Job.StopProcessingAsync();
 
             try
             {
@@ -265,51 +240,10 @@ namespace Uralstech.UXR.QuestCamera.GLES
             }
             finally
             {
-                GLESAPI.RunCallbacksRegistry.TryRemove(_textureId, out _);
-
-                if (!_isJobDisposed)
-                    await DisposeJobAsync();
-
-                _eventsSemaphore.Dispose();
-                _eventsCommandBuffer.Dispose();
-
-                Marshal.FreeHGlobal(_eventsDataPtr);
-                UnityEngine.Object.Destroy(Texture);
+                await Job.DisposeAsync();
             }
 
             GC.SuppressFinalize(this);
         }
-
-        private async ValueTask DisposeJobAsync()
-        {
-            await _eventsSemaphore.WaitAsync();
-            
-            try
-            {
-                TaskCompletionSource<bool> tcs = new(TaskCreationOptions.RunContinuationsAsynchronously);
-                void OnComplete(bool result, uint _) => tcs.TrySetResult(result);
-
-                GLESAPI.DisposeCallbacksRegistry[_textureId] = OnComplete;
-
-                RenderJobDisposeData data = new(_textureId, GLESAPI.RenderJobDisposeCallbackPtr);
-                Marshal.StructureToPtr(data, _eventsDataPtr, false);
-
-                _eventsCommandBuffer.IssuePluginEventAndData(GLESAPI.getGLESManageConverterJobEvent(), (int)RenderJobEvent.Dispose, _eventsDataPtr);
-                Graphics.ExecuteCommandBuffer(_eventsCommandBuffer);
-
-                if (!await tcs.Task)
-                    Debug.LogWarning("Native job disposal failed, check previous logs for more details.");
-            }
-            catch (Exception ex)
-            {
-                Debug.LogException(ex);
-            }
-            finally
-            {
-                _isJobDisposed = true;
-                _eventsCommandBuffer.Clear();
-                _eventsSemaphore.Release();
-            }
-        }
     }
 }
\ No newline at end of file
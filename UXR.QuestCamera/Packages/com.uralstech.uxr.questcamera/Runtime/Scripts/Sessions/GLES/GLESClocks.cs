@@ -0,0 +1,91 @@
+// Copyright 2026 URAV ADVANCED LEARNING SYSTEMS PRIVATE LIMITED
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+using System.Runtime.InteropServices;
+using UnityEngine;
+
+#nullable enable
+namespace Uralstech.UXR.QuestCamera.GLES
+{
+    /// <summary>Converts timestamps between the camera, system and Unity clocks.</summary>
+    /// <remarks>
+    /// The camera clock is tracked natively as frames are latched. The Unity clock is only tracked
+    /// while <see cref="SampleUnityTime"/> is called, ideally once every frame.
+    /// </remarks>
+    public static class GLESClocks
+    {
+        [DllImport("UXRQC_NativeConverters")]
+        private static extern void pushGLESUnityTime(long unityTime);
+
+        [DllImport("UXRQC_NativeConverters")]
+        [return: MarshalAs(UnmanagedType.U1)]
+        private static extern bool convertGLESTimestamp(long timestamp, ClockDomain fromDomain, ClockDomain toDomain, out long result);
+
+        [DllImport("UXRQC_NativeConverters")]
+        [return: MarshalAs(UnmanagedType.U1)]
+        private static extern bool getGLESClockFit(ClockDomain domain, out ClockFit fit);
+
+        [DllImport("UXRQC_NativeConverters")]
+        [return: MarshalAs(UnmanagedType.U1)]
+        private static extern bool getGLESFrameTiming(uint jobId, out JitterStats latency, out JitterStats interval);
+
+        [DllImport("UXRQC_NativeConverters")]
+        [return: MarshalAs(UnmanagedType.U1)]
+        private static extern bool getGLESFirstFrameDelay(uint jobId, out long delay);
+
+        /// <summary>The current value of <see cref="Time.realtimeSinceStartupAsDouble"/>, in nanoseconds.</summary>
+        public static long UnityTimeNow => (long)(Time.realtimeSinceStartupAsDouble * 1e9);
+
+        /// <summary>Records a reading of the Unity clock, to track its offset and drift from the system clock.</summary>
+        public static void SampleUnityTime() => pushGLESUnityTime(UnityTimeNow);
+
+        /// <summary>Converts a timestamp between clocks.</summary>
+        /// <param name="timestamp">The timestamp to convert, in nanoseconds.</param>
+        /// <param name="from">The clock of <paramref name="timestamp"/>.</param>
+        /// <param name="to">The clock to convert to.</param>
+        /// <param name="result">The converted timestamp, in nanoseconds.</param>
+        /// <returns><see langword="true"/> if both clocks are being tracked; <see langword="false"/> otherwise.</returns>
+        public static bool TryConvert(long timestamp, ClockDomain from, ClockDomain to, out long result) =>
+            convertGLESTimestamp(timestamp, from, to, out result);
+
+        /// <summary>Converts a camera timestamp to Unity's realtime clock.</summary>
+        /// <param name="cameraTimestamp">The camera timestamp, like <see cref="RenderJobFrameInfo.Timestamp"/>.</param>
+        /// <param name="unityTime">The equivalent <see cref="Time.realtimeSinceStartupAsDouble"/> value.</param>
+        /// <returns><see langword="true"/> if both clocks are being tracked; <see langword="false"/> otherwise.</returns>
+        public static bool TryGetUnityTime(long cameraTimestamp, out double unityTime)
+        {
+            bool result = TryConvert(cameraTimestamp, ClockDomain.Camera, ClockDomain.Unity, out long unityTimestamp);
+            unityTime = unityTimestamp / 1e9;
+            return result;
+        }
+
+        /// <summary>Gets the current estimated mapping from a clock to <see cref="ClockDomain.Monotonic"/>.</summary>
+        /// <returns><see langword="true"/> if the clock is being tracked; <see langword="false"/> otherwise.</returns>
+        public static bool TryGetFit(ClockDomain domain, out ClockFit fit) => getGLESClockFit(domain, out fit);
+
+        /// <summary>Gets the timing statistics of the last 120 frames of a camera stream.</summary>
+        /// <param name="jobId">The ID of any job reading from the camera stream.</param>
+        /// <param name="latency">Time from capture to the frame being latched for conversion.</param>
+        /// <param name="interval">Time between the captures of consecutive frames.</param>
+        /// <returns><see langword="true"/> if the job exists; <see langword="false"/> otherwise.</returns>
+        public static bool TryGetFrameTiming(uint jobId, out JitterStats latency, out JitterStats interval) =>
+            getGLESFrameTiming(jobId, out latency, out interval);
+
+        /// <summary>Gets the time from a camera stream being bound to its first frame being latched, i.e. the session's time to first frame.</summary>
+        /// <param name="jobId">The ID of any job reading from the camera stream.</param>
+        /// <param name="delay">The delay in nanoseconds, or -1 if no frame has been latched yet.</param>
+        /// <returns><see langword="true"/> if the job exists; <see langword="false"/> otherwise.</returns>
+        public static bool TryGetFirstFrameDelay(uint jobId, out long delay) => getGLESFirstFrameDelay(jobId, out delay);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,170 @@
+// Copyright 2026 URAV ADVANCED LEARNING SYSTEMS PRIVATE LIMITED
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+using System;
+using System.Runtime.InteropServices;
+using System.Threading;
+using System.Threading.Tasks;
+using UnityEngine;
+using UnityEngine.Experimental.Rendering;
+
+#nullable enable
+namespace Uralstech.UXR.QuestCamera.GLES
+{
+    /// <summary>A native GLES job which converts camera frames from a SurfaceTexture source into <see cref="Texture"/>.</summary>
+    /// <remarks>
+    /// Every <see cref="GLESCaptureSession"/> owns one job. Additional jobs can be created with
+    /// <see cref="GLESCaptureSession.CreateConverterJobAsync(Resolution, Rect?, GraphicsFormat, RenderJobFilter, float, bool)"/>
+    /// to get differently sized or cropped outputs from the same camera stream, without opening another capture session.
+    /// </remarks>
+    public sealed class GLESConverterJob : GLESJobBase
+    {
+        /// <summary>Callback for when a frame has been processed, with the frame texture and capture timestamp.</summary>
+        public event Action<Texture2D, long>? OnFrameProcessed;
+
+        /// <summary>The output texture with converted frames.</summary>
+        public readonly Texture2D Texture;
+
+        /// <summary>The region of the camera image converted by this job, in normalized UV coordinates.</summary>
+        public readonly Rect CropRect;
+
+        /// <summary>The filter used to resample the camera image to the size of <see cref="Texture"/>.</summary>
+        public readonly RenderJobFilter Filter;
+
+        /// <summary>Strength of the sharpening applied during conversion, in [0, 1].</summary>
+        public readonly float Sharpness;
+
+        /// <summary>Whether this job warps frames to the pose given to <see cref="SetReprojection(Quaternion, Quaternion, Vector4)"/>.</summary>
+        public readonly bool Reproject;
+
+        private readonly IntPtr _reprojectionPtr;
+        private readonly object _reprojectionLock = new();
+        private readonly RenderJobFlags _flags;
+
+        /// <inheritdoc/>
+        protected override IntPtr ReprojectionPtr => _reprojectionPtr;
+
+        /// <param name="resolution">The resolution of <see cref="Texture"/>.</param>
+        /// <param name="textureFormat">If not specified, uses equivalent of <see cref="RenderTextureFormat.ARGB32"/>.</param>
+        /// <param name="sourceJobId">The job whose camera source this job reads from, or 0 if this job owns a new source.</param>
+        /// <param name="cropRect">The region of the camera image to convert, in normalized UV coordinates.</param>
+        /// <param name="filter">The filter used to resample the camera image.</param>
+        /// <param name="sharpness">Strength of the sharpening applied during conversion, in [0, 1]. 0 disables sharpening.</param>
+        /// <param name="reproject">Whether frames should be warped to the pose given to <see cref="SetReprojection(Quaternion, Quaternion, Vector4)"/>.</param>
+        /// <param name="flags">Additional flags for the job, combined with <see cref="RenderJobFlags.Reproject"/> if <paramref name="reproject"/> is set.</param>
+        internal GLESConverterJob(Resolution resolution, GraphicsFormat textureFormat, uint sourceJobId, Rect cropRect,
+            RenderJobFilter filter = RenderJobFilter.Bilinear, float sharpness = 0f, bool reproject = false, RenderJobFlags flags = RenderJobFlags.None)
+            : this(CreateTexture(resolution, textureFormat), sourceJobId, cropRect, filter, sharpness, reproject, flags) { }
+
+        private GLESConverterJob(Texture2D texture, uint sourceJobId, Rect cropRect, RenderJobFilter filter, float sharpness, bool reproject, RenderJobFlags flags)
+            : base((uint)texture.GetNativeTexturePtr(), sourceJobId)
+        {
+            Texture = texture;
+            CropRect = cropRect;
+            Filter = filter;
+            Sharpness = sharpness;
+            Reproject = reproject;
+            _flags = reproject ? flags | RenderJobFlags.Reproject : flags;
+
+            // Zeroed until SetReprojection is called, which the native job treats as "no reprojection yet".
+            if (reproject)
+            {
+                _reprojectionPtr = Marshal.AllocHGlobal(Marshal.SizeOf<RenderJobReprojectionBuffer>());
+                Marshal.StructureToPtr(new RenderJobReprojectionBuffer(), _reprojectionPtr, false);
+            }
+
+            OnFrameProcessed += LastUpdateFrameCallback;
+        }
+
+        private static Texture2D CreateTexture(Resolution resolution, GraphicsFormat textureFormat)
+        {
+            if (textureFormat == GraphicsFormat.None)
+                textureFormat = GraphicsFormatUtility.GetGraphicsFormat(RenderTextureFormat.ARGB32, RenderTextureReadWrite.Default);
+
+            if (!GraphicsUtils.IsGraphicsFormatSupportedForRender(textureFormat))
+                throw new ArgumentException($"Format {textureFormat} is not supported on device.", nameof(textureFormat));
+
+            return new Texture2D(resolution.width, resolution.height, textureFormat, TextureCreationFlags.DontUploadUponCreate | TextureCreationFlags.DontInitializePixels);
+        }
+
+        /// <inheritdoc/>
+        protected override RenderJobSetupData CreateSetupData(IntPtr onDone) =>
+            new(Id, Texture.width, Texture.height, _sourceJobId, 0, CropRect, RenderJobMode.Convert, Filter, Sharpness, _flags, onDone);
+
+        /// <summary>Sets the pose that following frames are warped to.</summary>
+        /// <remarks>
+        /// Frames are warped from the head rotation at their capture time, interpolated from the poses given to
+        /// <see cref="GLESAPI.PushHeadPose(long, Quaternion, Vector3)"/>. If no pose is recorded for a frame, it is not warped.
+        /// Call this every frame with the predicted display pose, before the job runs.
+        /// </remarks>
+        /// <param name="displayRotation">The predicted head rotation when the output will be displayed.</param>
+        /// <param name="cameraRotation">The rotation of the camera relative to the head.</param>
+        /// <param name="intrinsics">The camera intrinsics (fx, fy, cx, cy), divided by the camera image resolution.</param>
+        /// <exception cref="InvalidOperationException">Thrown if the job was not created with reprojection enabled.</exception>
+        /// <exception cref="ObjectDisposedException"/>
+        public unsafe void SetReprojection(Quaternion displayRotation, Quaternion cameraRotation, Vector4 intrinsics)
+        {
+            ThrowIfDisposed();
+            if (!Reproject)
+                throw new InvalidOperationException("Job was not created with reprojection enabled.");
+
+            RenderJobReprojection pose = new()
+            {
+                DisplayRotation = displayRotation,
+                CameraRotation = cameraRotation,
+                Intrinsics = intrinsics,
+            };
+
+            // The render thread may be reading the published pose, so the other one is written and then published.
+            lock (_reprojectionLock)
+            {
+                RenderJobReprojectionBuffer* buffer = (RenderJobReprojectionBuffer*)_reprojectionPtr;
+                uint next = buffer->Published + 1;
+
+                if ((next & 1) == 0)
+                    buffer->Pose0 = pose;
+                else
+                    buffer->Pose1 = pose;
+
+                Volatile.Write(ref buffer->Published, next);
+            }
+        }
+
+        /// <summary>Processes a single frame and returns the result.</summary>
+        /// <returns>Capture timestamp and updated texture. Timestamp will be -1 if the capture could not be processed.</returns>
+        /// <exception cref="InvalidOperationException">Thrown if continuous processing is active.</exception>
+        /// <exception cref="ObjectDisposedException"/>
+        /// <exception cref="TimeoutException"/>
+        public async ValueTask<(long, Texture2D)> ProcessSingleFrameAsync(CancellationToken token = default)
+        {
+            (long timestamp, RenderJobFrameInfo _) = await RunSingleAsync(token);
+            return (timestamp, Texture);
+        }
+
+        /// <inheritdoc/>
+        protected override void OnFrameProcessedNative(in RenderJobFrameInfo frameInfo) =>
+            OnFrameProcessed?.OnMainThread(Texture, frameInfo.Timestamp).Forget();
+
+        private void LastUpdateFrameCallback(Texture2D _, long __) => MarkNewFrame();
+
+        /// <inheritdoc/>
+        protected override void ReleaseResources()
+        {
+            if (_reprojectionPtr != IntPtr.Zero)
+                Marshal.FreeHGlobal(_reprojectionPtr);
+
+            UnityEngine.Object.Destroy(Texture);
+        }
+    }
+}
\ No newline at end of file
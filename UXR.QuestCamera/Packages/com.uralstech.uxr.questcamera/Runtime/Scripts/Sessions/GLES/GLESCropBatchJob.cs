@@ -0,0 +1,189 @@
+// Copyright 2026 URAV ADVANCED LEARNING SYSTEMS PRIVATE LIMITED
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+using System;
+using System.Collections.Generic;
+using System.Runtime.InteropServices;
+using System.Threading;
+using System.Threading.Tasks;
+using UnityEngine;
+using UnityEngine.Experimental.Rendering;
+
+#nullable enable
+namespace Uralstech.UXR.QuestCamera.GLES
+{
+    /// <summary>A native GLES job which converts a batch of camera regions into fixed-size slots of one atlas texture.</summary>
+    /// <remarks>
+    /// All crops are rendered with a single instanced draw per run, which makes this suitable for feeding
+    /// many regions of interest (like detector outputs) into a second-stage model. Call <see cref="SetCrops(IReadOnlyList{Rect})"/>
+    /// on the main thread before each run; crops persist until they are replaced.
+    /// </remarks>
+    public sealed class GLESCropBatchJob : GLESJobBase
+    {
+        /// <summary>The maximum number of crops in one batch.</summary>
+        public const int MaxCrops = RenderJobCropBatch.MaxCount;
+
+        /// <summary>Callback for when a batch has been processed, with the atlas texture and capture timestamp.</summary>
+        public event Action<Texture2D, long>? OnFrameProcessed;
+
+        /// <summary>The output atlas texture, with <see cref="SlotColumns"/> x <see cref="SlotRows"/> slots of <see cref="SlotSize"/>.</summary>
+        public readonly Texture2D Texture;
+
+        /// <summary>The resolution of each slot in <see cref="Texture"/>.</summary>
+        public readonly Resolution SlotSize;
+
+        /// <summary>The number of slot columns in <see cref="Texture"/>.</summary>
+        public readonly int SlotColumns;
+
+        /// <summary>The number of slot rows in <see cref="Texture"/>.</summary>
+        public readonly int SlotRows;
+
+        /// <summary>The total number of slots in <see cref="Texture"/>.</summary>
+        public int SlotCount => SlotColumns * SlotRows;
+
+        /// <summary>The filter used to resample the camera regions to <see cref="SlotSize"/>.</summary>
+        public readonly RenderJobFilter Filter;
+
+        private readonly IntPtr _cropBatchPtr;
+
+        /// <inheritdoc/>
+        protected override IntPtr CropBatchPtr => _cropBatchPtr;
+
+        private GLESCropBatchJob(Texture2D texture, Resolution slotSize, int slotColumns, int slotRows, uint sourceJobId, RenderJobFilter filter)
+            : base((uint)texture.GetNativeTexturePtr(), sourceJobId)
+        {
+            Texture = texture;
+            SlotSize = slotSize;
+            SlotColumns = slotColumns;
+            SlotRows = slotRows;
+            Filter = filter;
+
+            _cropBatchPtr = Marshal.AllocHGlobal(Marshal.SizeOf<RenderJobCropBatch>());
+            Marshal.StructureToPtr(new RenderJobCropBatch(), _cropBatchPtr, false);
+
+            OnFrameProcessed += LastUpdateFrameCallback;
+        }
+
+        /// <summary>Creates and sets up a crop batch job.</summary>
+        /// <param name="sourceJobId">The job whose camera source this job reads from.</param>
+        /// <param name="slotSize">The resolution of each crop.</param>
+        /// <param name="slotColumns">The number of slot columns in the atlas.</param>
+        /// <param name="slotRows">The number of slot rows in the atlas.</param>
+        /// <param name="textureFormat">If not specified, uses equivalent of <see cref="RenderTextureFormat.ARGB32"/>.</param>
+        /// <param name="filter">The filter used to resample the camera regions.</param>
+        /// <returns>The created job, or <see langword="null"/> if creation failed.</returns>
+        internal static async ValueTask<GLESCropBatchJob?> CreateAsync(uint sourceJobId, Resolution slotSize, int slotColumns, int slotRows,
+            GraphicsFormat textureFormat, RenderJobFilter filter)
+        {
+            if (slotColumns < 1 || slotRows < 1 || slotColumns * slotRows > MaxCrops)
+                throw new ArgumentOutOfRangeException(nameof(slotColumns), $"The atlas must have between 1 and {MaxCrops} slots.");
+
+            if (textureFormat == GraphicsFormat.None)
+                textureFormat = GraphicsFormatUtility.GetGraphicsFormat(RenderTextureFormat.ARGB32, RenderTextureReadWrite.Default);
+
+            if (!GraphicsUtils.IsGraphicsFormatSupportedForRender(textureFormat))
+                throw new ArgumentException($"Format {textureFormat} is not supported on device.", nameof(textureFormat));
+
+            Texture2D texture = new(slotSize.width * slotColumns, slotSize.height * slotRows, textureFormat, TextureCreationFlags.DontUploadUponCreate | TextureCreationFlags.DontInitializePixels);
+            GLESCropBatchJob job = new(texture, slotSize, slotColumns, slotRows, sourceJobId, filter);
+
+            if (await job.SetupAsync() != 0)
+                return job;
+
+            await job.DisposeAsync();
+            return null;
+        }
+
+        /// <summary>Gets the region of <see cref="Texture"/> covered by a slot, in normalized UV coordinates.</summary>
+        /// <exception cref="ArgumentOutOfRangeException"/>
+        public Rect GetSlotRect(int slot)
+        {
+            if (slot < 0 || slot >= SlotCount)
+                throw new ArgumentOutOfRangeException(nameof(slot));
+
+            float width = 1f / SlotColumns;
+            float height = 1f / SlotRows;
+            return new Rect(slot % SlotColumns * width, slot / SlotColumns * height, width, height);
+        }
+
+        /// <summary>Sets the camera regions to crop in the next runs, where crop <c>i</c> is written to slot <c>i</c>.</summary>
+        /// <param name="sourceRects">The regions of the camera image, in normalized UV coordinates.</param>
+        /// <exception cref="ArgumentException">Thrown if there are more regions than slots.</exception>
+        /// <exception cref="ObjectDisposedException"/>
+        public void SetCrops(IReadOnlyList<Rect> sourceRects) => SetCrops(sourceRects, null);
+
+        /// <summary>Sets the camera regions to crop in the next runs.</summary>
+        /// <param name="sourceRects">The regions of the camera image, in normalized UV coordinates.</param>
+        /// <param name="slots">The slot each region is written to, or <see langword="null"/> to use slot <c>i</c> for region <c>i</c>.</param>
+        /// <exception cref="ArgumentException">Thrown if there are more regions than slots, or the slot list does not match the regions.</exception>
+        /// <exception cref="ArgumentOutOfRangeException">Thrown if a slot index is invalid.</exception>
+        /// <exception cref="ObjectDisposedException"/>
+        public unsafe void SetCrops(IReadOnlyList<Rect> sourceRects, IReadOnlyList<int>? slots)
+        {
+            ThrowIfDisposed();
+            if (sourceRects.Count > SlotCount)
+                throw new ArgumentException($"Cannot crop more than {SlotCount} regions.", nameof(sourceRects));
+
+            if (slots != null && slots.Count != sourceRects.Count)
+                throw new ArgumentException("Each region must have a slot.", nameof(slots));
+
+            RenderJobCropBatch* batch = (RenderJobCropBatch*)_cropBatchPtr;
+            for (int i = 0; i < sourceRects.Count; i++)
+            {
+                Rect source = sourceRects[i];
+                Rect target = GetSlotRect(slots?[i] ?? i);
+
+                batch->SourceRects[i * 4 + 0] = source.x;
+                batch->SourceRects[i * 4 + 1] = source.y;
+                batch->SourceRects[i * 4 + 2] = source.width;
+                batch->SourceRects[i * 4 + 3] = source.height;
+
+                batch->TargetRects[i * 4 + 0] = target.x;
+                batch->TargetRects[i * 4 + 1] = target.y;
+                batch->TargetRects[i * 4 + 2] = target.width;
+                batch->TargetRects[i * 4 + 3] = target.height;
+            }
+
+            batch->Count = sourceRects.Count;
+        }
+
+        /// <inheritdoc/>
+        protected override RenderJobSetupData CreateSetupData(IntPtr onDone) =>
+            new(Id, Texture.width, Texture.height, _sourceJobId, 0, new Rect(0f, 0f, 1f, 1f), RenderJobMode.CropBatch, Filter, 0f, onDone);
+
+        /// <summary>Converts the current crops of a single frame and returns the result.</summary>
+        /// <returns>Capture timestamp and updated atlas texture. Timestamp will be -1 if the capture could not be processed.</returns>
+        /// <exception cref="InvalidOperationException">Thrown if continuous processing is active.</exception>
+        /// <exception cref="ObjectDisposedException"/>
+        /// <exception cref="TimeoutException"/>
+        public async ValueTask<(long, Texture2D)> ProcessSingleFrameAsync(CancellationToken token = default)
+        {
+            (long timestamp, RenderJobFrameInfo _) = await RunSingleAsync(token);
+            return (timestamp, Texture);
+        }
+
+        /// <inheritdoc/>
+        protected override void OnFrameProcessedNative(in RenderJobFrameInfo frameInfo) =>
+            OnFrameProcessed?.OnMainThread(Texture, frameInfo.Timestamp).Forget();
+
+        private void LastUpdateFrameCallback(Texture2D _, long __) => MarkNewFrame();
+
+        /// <inheritdoc/>
+        protected override void ReleaseResources()
+        {
+            Marshal.FreeHGlobal(_cropBatchPtr);
+            UnityEngine.Object.Destroy(Texture);
+        }
+    }
+}
\ No newline at end of file
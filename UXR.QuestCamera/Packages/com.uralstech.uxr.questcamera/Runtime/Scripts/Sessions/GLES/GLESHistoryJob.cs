@@ -0,0 +1,184 @@
+// Copyright 2026 URAV ADVANCED LEARNING SYSTEMS PRIVATE LIMITED
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+using System;
+using System.Threading;
+using System.Threading.Tasks;
+using UnityEngine;
+using UnityEngine.Experimental.Rendering;
+
+#nullable enable
+namespace Uralstech.UXR.QuestCamera.GLES
+{
+    /// <summary>A native GLES job which converts each new camera frame into the next layer of a <see cref="Texture2DArray"/> ring.</summary>
+    /// <remarks>
+    /// The ring keeps the last <see cref="Layers"/> frames on the GPU without any copies, for temporal effects like motion trails,
+    /// frame differencing or rewinding. Use <see cref="GetLayer(int)"/> to find the layer of an older frame, and pass the layer
+    /// index to shaders sampling <see cref="Texture"/>. The ring can be smaller or use a cheaper format than the session's own output.
+    /// </remarks>
+    public sealed class GLESHistoryJob : GLESJobBase
+    {
+        /// <summary>Callback for when a frame has been processed, with the texture array, the layer holding the frame and its capture timestamp.</summary>
+        public event Action<Texture2DArray, int, long>? OnFrameProcessed;
+
+        /// <summary>The output texture array, with one frame per layer.</summary>
+        public readonly Texture2DArray Texture;
+
+        /// <summary>The number of frames kept in <see cref="Texture"/>.</summary>
+        public int Layers => Texture.depth;
+
+        /// <summary>The region of the camera image converted by this job, in normalized UV coordinates.</summary>
+        public readonly Rect CropRect;
+
+        /// <summary>The filter used to resample the camera image to the size of <see cref="Texture"/>.</summary>
+        public readonly RenderJobFilter Filter;
+
+        /// <summary>The layer holding the newest frame, or -1 if no frame has been processed yet.</summary>
+        public int LatestLayer
+        {
+            get
+            {
+                lock (_layerTimestamps)
+                    return _latestLayer;
+            }
+        }
+
+        /// <summary>The number of layers which hold a frame, up to <see cref="Layers"/>.</summary>
+        public int FilledLayers
+        {
+            get
+            {
+                lock (_layerTimestamps)
+                    return _filledLayers;
+            }
+        }
+
+        // Written from render thread callbacks, read from the main thread.
+        private readonly long[] _layerTimestamps;
+        private int _latestLayer = -1;
+        private int _filledLayers;
+
+        private GLESHistoryJob(Texture2DArray texture, uint sourceJobId, Rect cropRect, RenderJobFilter filter)
+            : base((uint)texture.GetNativeTexturePtr(), sourceJobId)
+        {
+            Texture = texture;
+            CropRect = cropRect;
+            Filter = filter;
+
+            _layerTimestamps = new long[texture.depth];
+            OnFrameProcessed += LastUpdateFrameCallback;
+        }
+
+        /// <summary>Creates and sets up a history job.</summary>
+        /// <param name="sourceJobId">The job whose camera source this job reads from.</param>
+        /// <param name="resolution">The resolution of each layer of <see cref="Texture"/>.</param>
+        /// <param name="layers">The number of frames kept in the ring.</param>
+        /// <param name="cropRect">The region of the camera image to convert, in normalized UV coordinates.</param>
+        /// <param name="textureFormat">If not specified, uses equivalent of <see cref="RenderTextureFormat.ARGB32"/>.</param>
+        /// <param name="filter">The filter used to resample the camera image.</param>
+        /// <returns>The created job, or <see langword="null"/> if creation failed.</returns>
+        internal static async ValueTask<GLESHistoryJob?> CreateAsync(uint sourceJobId, Resolution resolution, int layers, Rect cropRect,
+            GraphicsFormat textureFormat, RenderJobFilter filter)
+        {
+            if (layers < 2 || layers > SystemInfo.maxTextureArraySlices)
+                throw new ArgumentOutOfRangeException(nameof(layers), $"The ring must have between 2 and {SystemInfo.maxTextureArraySlices} layers.");
+
+            if (textureFormat == GraphicsFormat.None)
+                textureFormat = GraphicsFormatUtility.GetGraphicsFormat(RenderTextureFormat.ARGB32, RenderTextureReadWrite.Default);
+
+            if (!GraphicsUtils.IsGraphicsFormatSupportedForRender(textureFormat))
+                throw new ArgumentException($"Format {textureFormat} is not supported on device.", nameof(textureFormat));
+
+            Texture2DArray texture = new(resolution.width, resolution.height, layers, textureFormat, TextureCreationFlags.DontUploadUponCreate | TextureCreationFlags.DontInitializePixels);
+            GLESHistoryJob job = new(texture, sourceJobId, cropRect, filter);
+
+            if (await job.SetupAsync() != 0)
+                return job;
+
+            await job.DisposeAsync();
+            return null;
+        }
+
+        /// <summary>Gets the layer holding the frame processed <paramref name="age"/> frames before the newest one.</summary>
+        /// <param name="age">0 for the newest frame, up to <see cref="FilledLayers"/> - 1 for the oldest.</param>
+        /// <exception cref="ArgumentOutOfRangeException">Thrown if no frame of that age is kept.</exception>
+        public int GetLayer(int age)
+        {
+            lock (_layerTimestamps)
+            {
+                if (age < 0 || age >= _filledLayers)
+                    throw new ArgumentOutOfRangeException(nameof(age), $"Only {_filledLayers} frames are kept.");
+
+                return (_latestLayer - age + Layers) % Layers;
+            }
+        }
+
+        /// <summary>Gets the capture timestamp of the frame in a layer, or 0 if the layer does not hold a frame yet.</summary>
+        /// <exception cref="ArgumentOutOfRangeException"/>
+        public long GetLayerTimestamp(int layer)
+        {
+            lock (_layerTimestamps)
+                return _layerTimestamps[layer];
+        }
+
+        /// <inheritdoc/>
+        protected override RenderJobSetupData CreateSetupData(IntPtr onDone) =>
+            new(Id, Texture.width, Texture.height, _sourceJobId, 0, CropRect, RenderJobMode.Convert, Filter, 0f,
+                RenderJobFlags.None, onDone, IntPtr.Zero, 0, Layers);
+
+        /// <summary>Processes a single frame and returns the result.</summary>
+        /// <returns>
+        /// Capture timestamp, the layer holding the frame and the texture array.
+        /// Timestamp will be -1 and the layer will be <see cref="LatestLayer"/> if the capture could not be processed.
+        /// </returns>
+        /// <exception cref="InvalidOperationException">Thrown if continuous processing is active.</exception>
+        /// <exception cref="ObjectDisposedException"/>
+        /// <exception cref="TimeoutException"/>
+        public async ValueTask<(long, int, Texture2DArray)> ProcessSingleFrameAsync(CancellationToken token = default)
+        {
+            (long timestamp, RenderJobFrameInfo frameInfo) = await RunSingleAsync(token);
+            if (timestamp == -1)
+                return (timestamp, LatestLayer, Texture);
+
+            RecordFrame(frameInfo.HistoryLayer, timestamp);
+            return (timestamp, frameInfo.HistoryLayer, Texture);
+        }
+
+        /// <inheritdoc/>
+        protected override void OnFrameProcessedNative(in RenderJobFrameInfo frameInfo)
+        {
+            RecordFrame(frameInfo.HistoryLayer, frameInfo.Timestamp);
+            OnFrameProcessed?.OnMainThread(Texture, frameInfo.HistoryLayer, frameInfo.Timestamp).Forget();
+        }
+
+        // Repeated frames are rendered into the newest layer again, so only a new layer adds to the ring.
+        private void RecordFrame(int layer, long timestamp)
+        {
+            lock (_layerTimestamps)
+            {
+                if (layer != _latestLayer)
+                    _filledLayers = Math.Min(_filledLayers + 1, _layerTimestamps.Length);
+
+                _latestLayer = layer;
+                _layerTimestamps[layer] = timestamp;
+            }
+        }
+
+        private void LastUpdateFrameCallback(Texture2DArray _, int __, long ___) => MarkNewFrame();
+
+        /// <inheritdoc/>
+        protected override void ReleaseResources() => UnityEngine.Object.Destroy(Texture);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,385 @@
+// Copyright 2026 URAV ADVANCED LEARNING SYSTEMS PRIVATE LIMITED
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+using System;
+using System.Runtime.InteropServices;
+using System.Threading;
+using System.Threading.Tasks;
+using UnityEngine;
+using UnityEngine.Rendering;
+
+#nullable enable
+namespace Uralstech.UXR.QuestCamera.GLES
+{
+    /// <summary>Base class for native GLES Render Jobs, which handles the setup, run and dispose events of the job.</summary>
+    public abstract class GLESJobBase : IAsyncDisposable
+    {
+        private static readonly int s_largestDataStructSize = Math.Max(Marshal.SizeOf<RenderJobSetupData>(), Marshal.SizeOf<RenderJobRunData>());
+        private static readonly int s_frameInfoSize = Marshal.SizeOf<RenderJobFrameInfo>();
+
+        /// <summary><see langword="true"/> if a capture was processed this frame; <see langword="false"/> otherwise.</summary>
+        public bool HasNewFrame => _lastUpdateFrame == Time.frameCount;
+
+        /// <summary>The capture timestamp of the last processed frame.</summary>
+        public long CaptureTimestamp { get; private set; }
+
+        /// <summary>Details of the last processed frame, including its sequence number and dropped frames.</summary>
+        public RenderJobFrameInfo LastFrameInfo { get; private set; }
+
+        /// <summary>The ID of this job in the native manager.</summary>
+        internal readonly uint Id;
+
+        /// <summary>The job whose camera source this job reads from, or 0 if this job owns its source.</summary>
+        protected readonly uint _sourceJobId;
+
+        private int _lastUpdateFrame;
+
+        private readonly CancellationTokenSource _runsCancellation = new();
+        private readonly SemaphoreSlim _eventsSemaphore = new(1, 1);
+
+        private readonly CommandBuffer _eventsCommandBuffer;
+        private readonly IntPtr _eventsDataPtr;
+        private readonly IntPtr _frameInfoPtr;
+
+        private bool _isJobDisposed;
+        private bool _disposed;
+        private Task? _runsLoop;
+
+        /// <param name="id">The ID of the job, which is the render texture for jobs that have one.</param>
+        /// <param name="sourceJobId">The job whose camera source this job reads from, or 0 if this job owns a new source.</param>
+        protected GLESJobBase(uint id, uint sourceJobId)
+        {
+            Id = id;
+            _sourceJobId = sourceJobId;
+
+            _eventsCommandBuffer = new CommandBuffer();
+            _eventsDataPtr = Marshal.AllocHGlobal(s_largestDataStructSize);
+            _frameInfoPtr = Marshal.AllocHGlobal(s_frameInfoSize);
+        }
+
+        /// <summary>Creates the data for the <see cref="RenderJobEvent.Setup"/> event of this job.</summary>
+        protected abstract RenderJobSetupData CreateSetupData(IntPtr onDone);
+
+        /// <summary>The native function which handles the events of this job.</summary>
+        /// <remarks>By default, the function which routes events to the backend of Unity's active renderer.</remarks>
+        protected virtual IntPtr ManageEventFunction => GLESAPI.getManageConverterJobEvent();
+
+        /// <summary>Extra data passed with every <see cref="RenderJobEvent.Run"/> event, like <see cref="RenderJobRunData.CropBatch"/>.</summary>
+        protected virtual IntPtr CropBatchPtr => IntPtr.Zero;
+
+        /// <summary>Extra data passed with every <see cref="RenderJobEvent.Run"/> event, see <see cref="RenderJobRunData.Reprojection"/>.</summary>
+        protected virtual IntPtr ReprojectionPtr => IntPtr.Zero;
+
+        /// <summary>Called on the render thread when continuous processing produces a new frame.</summary>
+        /// <param name="frameInfo">Details of the frame, only valid for the duration of the call.</param>
+        protected abstract void OnFrameProcessedNative(in RenderJobFrameInfo frameInfo);
+
+        /// <summary>Marks the current Unity frame as having a new capture, for <see cref="HasNewFrame"/>. Call on the main thread.</summary>
+        protected void MarkNewFrame() => _lastUpdateFrame = Time.frameCount;
+
+        /// <summary>Registers and creates the job in the native C++ manager.</summary>
+        /// <returns>The ID of the source texture the job reads from, or 0 if the operation failed.</returns>
+        internal async ValueTask<uint> SetupAsync()
+        {
+            ThrowIfDisposed();
+            await _eventsSemaphore.WaitAsync();
+
+            try
+            {
+                TaskCompletionSource<uint> tcs = new(TaskCreationOptions.RunContinuationsAsynchronously);
+                void OnComplete(uint textureId, uint _) => tcs.SetResult(textureId);
+
+                GLESAPI.SetupCallbacksRegistry[Id] = OnComplete;
+
+                RenderJobSetupData data = CreateSetupData(GLESAPI.RenderJobSetupCallbackPtr);
+                Marshal.StructureToPtr(data, _eventsDataPtr, false);
+
+                _eventsCommandBuffer.IssuePluginEventAndData(ManageEventFunction, (int)RenderJobEvent.Setup, _eventsDataPtr);
+                Graphics.ExecuteCommandBuffer(_eventsCommandBuffer);
+
+                uint result = await tcs.Task;
+                if (result == 0) // Failure, consider the job disposed.
+                    _isJobDisposed = true;
+
+                return result;
+            }
+            catch (Exception ex)
+            {
+                Debug.LogException(ex);
+                return 0;
+            }
+            finally
+            {
+                _eventsCommandBuffer.Clear();
+                _eventsSemaphore.Release();
+            }
+        }
+
+        /// <summary>Starts continuous frame processing.</summary>
+        /// <param name="maxFramerate">The maximum rate at which frames will be processed by the GLES pipeline.</param>
+        /// <exception cref="InvalidOperationException">Thrown if continuous processing is already active.</exception>
+        /// <exception cref="ObjectDisposedException"/>
+        public void StartContinuousProcessing(int maxFramerate = 60)
+        {
+            ThrowIfDisposed();
+            if (_runsLoop != null)
+                throw new InvalidOperationException($"Cannot call {nameof(StartContinuousProcessing)} twice!");
+
+            GLESAPI.RunCallbacksRegistry[Id] = OnRunCompletedNative;
+            _runsLoop = RunsLoopAsync(maxFramerate, _runsCancellation.Token);
+        }
+
+        /// <summary>Runs the job once.</summary>
+        /// <returns>Capture timestamp and frame details. Timestamp will be -1 if the capture could not be processed.</returns>
+        /// <exception cref="InvalidOperationException">Thrown if continuous processing is active.</exception>
+        /// <exception cref="ObjectDisposedException"/>
+        /// <exception cref="TimeoutException"/>
+        protected async ValueTask<(long, RenderJobFrameInfo)> RunSingleAsync(CancellationToken token)
+        {
+            ThrowIfDisposed();
+            if (_runsLoop != null)
+                throw new InvalidOperationException("Cannot process single frames on a looping job!");
+
+            TaskCompletionSource<(long, RenderJobFrameInfo)> tcs = new(TaskCreationOptions.RunContinuationsAsynchronously);
+            void OnComplete(long timestamp, uint _)
+            {
+                RenderJobFrameInfo frameInfo = Marshal.PtrToStructure<RenderJobFrameInfo>(_frameInfoPtr);
+                if (timestamp != -1)
+                    LastFrameInfo = frameInfo;
+
+                tcs.TrySetResult((timestamp, frameInfo));
+            }
+
+            if (!await _eventsSemaphore.WaitAsync(1000, token))
+                throw new TimeoutException("Timed out waiting for semaphore!");
+
+            try
+            {
+                GLESAPI.RunCallbacksRegistry[Id] = OnComplete;
+
+                RenderJobRunData data = new(Id, GLESAPI.RenderJobRunCallbackPtr, _frameInfoPtr, CropBatchPtr, ReprojectionPtr);
+                Marshal.StructureToPtr(data, _eventsDataPtr, false);
+
+                _eventsCommandBuffer.IssuePluginEventAndData(ManageEventFunction, (int)RenderJobEvent.Run, _eventsDataPtr);
+                Graphics.ExecuteCommandBuffer(_eventsCommandBuffer);
+
+                using (CancellationTokenRegistration _ = token.Register(tcs.SetCanceled))
+                    return await tcs.Task;
+            }
+            finally
+            {
+                _eventsSemaphore.Release();
+                _eventsCommandBuffer.Clear();
+                GLESAPI.RunCallbacksRegistry.TryRemove(Id, out _);
+            }
+        }
+
+        private async Task RunsLoopAsync(int maxFramerate, CancellationToken token)
+        {
+            try
+            {
+                const float IntervalMargin = 1f / 72f;
+                float minInterval = 1f / maxFramerate;
+
+                RenderJobRunData data = new(Id, GLESAPI.RenderJobRunCallbackPtr, _frameInfoPtr, CropBatchPtr, ReprojectionPtr);
+                Marshal.StructureToPtr(data, _eventsDataPtr, false);
+
+                _eventsCommandBuffer.IssuePluginEventAndData(ManageEventFunction, (int)RenderJobEvent.Run, _eventsDataPtr);
+
+                float jobDispatchTime = Time.time;
+                while (!token.IsCancellationRequested)
+                {
+                    if (!await _eventsSemaphore.WaitAsync(1000, token))
+                    {
+                        Debug.LogError("Timed out waiting for job run!");
+                        _eventsSemaphore.Release();
+                        return;
+                    }
+
+                    try
+                    {
+                        float elapsed = Time.time - jobDispatchTime;
+                        float additionalWait = minInterval - elapsed;
+
+                        if (additionalWait > IntervalMargin)
+                        {
+#if UNITY_6000_0_OR_NEWER
+                            await Awaitable.WaitForSecondsAsync(additionalWait, token);
+#else
+                            await Task.Delay((int)(additionalWait * 1000), token);
+#endif
+                        }
+
+                        Graphics.ExecuteCommandBuffer(_eventsCommandBuffer);
+                        jobDispatchTime = Time.time;
+                    }
+                    catch
+                    {
+                        _eventsSemaphore.Release();
+                        throw;
+                    }
+                }
+            }
+            catch (OperationCanceledException) { }
+            catch (Exception ex)
+            {
+                Debug.LogException(ex);
+            }
+            finally
+            {
+                _eventsCommandBuffer.Clear();
+            }
+        }
+
+        private void OnRunCompletedNative(long timestamp, uint renderTextureId)
+        {
+            _eventsSemaphore.Release();
+            if (timestamp == -1 || timestamp == CaptureTimestamp)
+                return;
+
+            CaptureTimestamp = timestamp;
+
+            RenderJobFrameInfo frameInfo = Marshal.PtrToStructure<RenderJobFrameInfo>(_frameInfoPtr);
+            LastFrameInfo = frameInfo;
+            OnFrameProcessedNative(frameInfo);
+        }
+
+        /// <summary>Gets the counters of this job since it was set up.</summary>
+        /// <returns><see langword="true"/> if the native job exists; <see langword="false"/> otherwise.</returns>
+        public bool TryGetCounters(out RenderJobCounters counters) => GLESAPI.TryGetJobCounters(Id, out counters);
+
+        /// <summary>Sets which new camera frames this job processes.</summary>
+        /// <remarks>
+        /// Runs on skipped frames complete with a timestamp of -1, like runs before the camera's first frame.
+        /// <see cref="RenderJobSamplingMode.OnChange"/> compares small thumbnails which are read back asynchronously,
+        /// so its decisions lag the camera by one or two frames.
+        /// The next new camera frame after this call is processed in any mode.
+        /// </remarks>
+        /// <param name="mode">Which frames to process.</param>
+        /// <param name="interval">For <see cref="RenderJobSamplingMode.EveryNth"/>, the number of camera frames per processed frame.</param>
+        /// <param name="changeThreshold">For <see cref="RenderJobSamplingMode.OnChange"/>, the mean luma difference in [0, 1] needed to process a frame.</param>
+        /// <returns><see langword="true"/> if the native job exists; <see langword="false"/> otherwise.</returns>
+        /// <exception cref="ArgumentOutOfRangeException">Thrown if <paramref name="interval"/> is less than 1 or <paramref name="changeThreshold"/> is outside [0, 1].</exception>
+        /// <exception cref="ObjectDisposedException"/>
+        public bool SetSampling(RenderJobSamplingMode mode, int interval = 1, float changeThreshold = 0.02f)
+        {
+            ThrowIfDisposed();
+            if (interval < 1)
+                throw new ArgumentOutOfRangeException(nameof(interval), "Interval must be at least 1.");
+
+            if (changeThreshold < 0f || changeThreshold > 1f)
+                throw new ArgumentOutOfRangeException(nameof(changeThreshold), "Change threshold must be in the range [0, 1].");
+
+            return GLESAPI.SetJobSampling(Id, mode, (uint)interval, changeThreshold);
+        }
+
+        /// <summary>Makes this job process the next <paramref name="frameCount"/> camera frames, regardless of its sampling mode.</summary>
+        /// <returns><see langword="true"/> if the native job exists; <see langword="false"/> otherwise.</returns>
+        /// <exception cref="ArgumentOutOfRangeException">Thrown if <paramref name="frameCount"/> is less than 1.</exception>
+        /// <exception cref="ObjectDisposedException"/>
+        public bool RequestBurst(int frameCount)
+        {
+            ThrowIfDisposed();
+            if (frameCount < 1)
+                throw new ArgumentOutOfRangeException(nameof(frameCount), "Frame count must be at least 1.");
+
+            return GLESAPI.RequestJobBurst(Id, (uint)frameCount);
+        }
+
+        /// <summary>Stops continuous processing, if active, without disposing the native job.</summary>
+        internal async ValueTask StopProcessingAsync()
+        {
+            if (_runsCancellation.IsCancellationRequested)
+                return;
+
+            _runsCancellation.Cancel();
+            if (_runsLoop != null)
+                await _runsLoop;
+
+            GLESAPI.RunCallbacksRegistry.TryRemove(Id, out _);
+        }
+
+        /// <summary>Releases managed resources of the job after the native job has been disposed.</summary>
+        protected virtual void ReleaseResources() { }
+
+        /// <summary>Stops processing, disposes the native job and releases its resources.</summary>
+        /// <remarks>A job owning its camera source (the one created by <see cref="GLESCaptureSession"/>) can only be disposed after its session has been closed.</remarks>
+        public async ValueTask DisposeAsync()
+        {
+            if (_disposed)
+                return;
+
+            _disposed = true;
+
+            try
+            {
+                await StopProcessingAsync();
+                _runsCancellation.Dispose();
+
+                if (!_isJobDisposed)
+                    await DisposeJobAsync();
+            }
+            finally
+            {
+                _eventsSemaphore.Dispose();
+                _eventsCommandBuffer.Dispose();
+
+                Marshal.FreeHGlobal(_eventsDataPtr);
+                Marshal.FreeHGlobal(_frameInfoPtr);
+                ReleaseResources();
+            }
+
+            GC.SuppressFinalize(this);
+        }
+
+        private async ValueTask DisposeJobAsync()
+        {
+            await _eventsSemaphore.WaitAsync();
+
+            try
+            {
+                TaskCompletionSource<bool> tcs = new(TaskCreationOptions.RunContinuationsAsynchronously);
+                void OnComplete(bool result, uint _) => tcs.TrySetResult(result);
+
+                GLESAPI.DisposeCallbacksRegistry[Id] = OnComplete;
+
+                RenderJobDisposeData data = new(Id, GLESAPI.RenderJobDisposeCallbackPtr);
+                Marshal.StructureToPtr(data, _eventsDataPtr, false);
+
+                _eventsCommandBuffer.IssuePluginEventAndData(ManageEventFunction, (int)RenderJobEvent.Dispose, _eventsDataPtr);
+                Graphics.ExecuteCommandBuffer(_eventsCommandBuffer);
+
+                if (!await tcs.Task)
+                    Debug.LogWarning("Native job disposal failed, check previous logs for more details.");
+            }
+            catch (Exception ex)
+            {
+                Debug.LogException(ex);
+            }
+            finally
+            {
+                _isJobDisposed = true;
+                _eventsCommandBuffer.Clear();
+                _eventsSemaphore.Release();
+            }
+        }
+
+        /// <exception cref="ObjectDisposedException"/>
+        protected void ThrowIfDisposed()
+        {
+            if (_disposed)
+                throw new ObjectDisposedException(GetType().Name);
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,133 @@
+// Copyright 2026 URAV ADVANCED LEARNING SYSTEMS PRIVATE LIMITED
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+using System;
+using System.Runtime.InteropServices;
+using System.Threading;
+using System.Threading.Tasks;
+using UnityEngine;
+using UnityEngine.Experimental.Rendering;
+
+#nullable enable
+namespace Uralstech.UXR.QuestCamera.GLES
+{
+    /// <summary>A camera capture session opened natively with the NDK's Camera2 API, which renders into a <see cref="GLESConverterJob"/>.</summary>
+    /// <remarks>
+    /// Frames go from the camera straight into the job's source through an <c>AImageReader</c>, without the Kotlin plugin
+    /// or any JVM callbacks. Optionally, YUV_420_888 images of every frame are also published to the native frame bus for
+    /// native processing stages. Unlike <see cref="GLESCaptureSession"/>, this session does not use <see cref="CameraDevice"/>,
+    /// so <see cref="StreamUseCase"/> and camera permissions must be handled by the app. Use <see cref="GLESCaptureSession"/>
+    /// as a fallback if <see cref="OpenAsync"/> fails.
+    /// </remarks>
+    public sealed class GLESNativeCaptureSession : IAsyncDisposable
+    {
+        [DllImport("UXRQC_NativeConverters")]
+        private static extern uint openNativeCameraSession(string cameraId, int width, int height, CaptureTemplate captureTemplate,
+            uint glesJobId, [MarshalAs(UnmanagedType.U1)] bool publishCpuFrames);
+
+        [DllImport("UXRQC_NativeConverters")]
+        private static extern NativeCameraState getNativeCameraSessionState(uint sessionId);
+
+        [DllImport("UXRQC_NativeConverters")]
+        private static extern void closeNativeCameraSession(uint sessionId);
+
+        /// <summary>The native job which owns the camera source and renders into <see cref="Texture"/>.</summary>
+        public readonly GLESConverterJob Job;
+
+        /// <summary>The output texture with converted frames.</summary>
+        public Texture2D Texture => Job.Texture;
+
+        /// <summary>The current state of the camera.</summary>
+        /// <remarks>Updated from the camera's threads, poll this to wait for the stream to start.</remarks>
+        public NativeCameraState State => _disposed ? NativeCameraState.Closed : getNativeCameraSessionState(_sessionId);
+
+        private readonly uint _sessionId;
+        private bool _disposed;
+
+        private GLESNativeCaptureSession(GLESConverterJob job, uint sessionId)
+        {
+            Job = job;
+            _sessionId = sessionId;
+        }
+
+        /// <summary>Opens a camera natively and sets up a job to convert its frames.</summary>
+        /// <param name="cameraId">The ID of the camera to open, like <see cref="CameraInfo.CameraId"/>.</param>
+        /// <param name="resolution">The resolution of the camera stream and <see cref="Texture"/>.</param>
+        /// <param name="captureTemplate">The template of the repeating capture request.</param>
+        /// <param name="textureFormat">If not specified, uses equivalent of <see cref="RenderTextureFormat.ARGB32"/>.</param>
+        /// <param name="publishCpuFrames">Whether YUV_420_888 images of every frame should be published to the native frame bus.</param>
+        /// <returns>The session, or <see langword="null"/> if the job could not be set up or the camera could not be opened.</returns>
+        public static async ValueTask<GLESNativeCaptureSession?> OpenAsync(string cameraId, Resolution resolution,
+            CaptureTemplate captureTemplate = CaptureTemplate.Preview, GraphicsFormat textureFormat = GraphicsFormat.None, bool publishCpuFrames = false)
+        {
+            GLESConverterJob job = new(resolution, textureFormat, 0, new Rect(0f, 0f, 1f, 1f));
+            if (await job.SetupAsync() == 0)
+            {
+                await job.DisposeAsync();
+                return null;
+            }
+
+            uint sessionId = openNativeCameraSession(cameraId, resolution.width, resolution.height, captureTemplate, job.Id, publishCpuFrames);
+            if (sessionId == 0)
+            {
+                await job.DisposeAsync();
+                return null;
+            }
+
+            return new GLESNativeCaptureSession(job, sessionId);
+        }
+
+        /// <inheritdoc cref="GLESConverterJob.StartContinuousProcessing(int)"/>
+        public void StartContinuousProcessing(int maxFramerate = 60)
+        {
+            ThrowIfDisposed();
+            Job.StartContinuousProcessing(maxFramerate);
+        }
+
+        /// <inheritdoc cref="GLESConverterJob.ProcessSingleFrameAsync(CancellationToken)"/>
+        public ValueTask<(long, Texture2D)> ProcessSingleFrameAsync(CancellationToken token = default)
+        {
+            ThrowIfDisposed();
+            return Job.ProcessSingleFrameAsync(token);
+        }
+
+        /// <summary>Closes the camera and disposes <see cref="Job"/>.</summary>
+        public async ValueTask DisposeAsync()
+        {
+            if (_disposed)
+                return;
+
+            _disposed = true;
+            await Job.StopProcessingAsync();
+
+            try
+            {
+                closeNativeCameraSession(_sessionId);
+            }
+            finally
+            {
+                await Job.DisposeAsync();
+            }
+
+            GC.SuppressFinalize(this);
+        }
+
+        /// <exception cref="ObjectDisposedException"/>
+        private void ThrowIfDisposed()
+        {
+            if (_disposed)
+                throw new ObjectDisposedException(GetType().Name);
+        }
+    }
+}
\ No newline at end of file
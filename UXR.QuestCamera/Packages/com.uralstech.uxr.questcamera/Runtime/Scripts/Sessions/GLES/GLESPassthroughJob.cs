@@ -0,0 +1,104 @@
+// Copyright 2026 URAV ADVANCED LEARNING SYSTEMS PRIVATE LIMITED
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+using System;
+using System.Threading;
+using System.Threading.Tasks;
+using UnityEngine;
+
+#nullable enable
+namespace Uralstech.UXR.QuestCamera.GLES
+{
+    /// <summary>A native GLES job which exposes the camera's external (<c>GL_TEXTURE_EXTERNAL_OES</c>) texture directly, without any conversion draw.</summary>
+    /// <remarks>
+    /// The job only latches new camera frames into <see cref="ExternalTexture"/>, so it is the cheapest way to display
+    /// the camera feed. <see cref="ExternalTexture"/> must be sampled with <c>samplerExternalOES</c> in a GLSL shader,
+    /// using <see cref="TransformMatrix"/> to transform its UVs, like the included <c>Uralstech/UXR/QuestCamera/ExternalCameraTexture</c> shader.
+    /// It cannot be used with <see cref="Graphics.Blit(Texture, RenderTexture)"/>, compute shaders or CPU readbacks; use a <see cref="GLESConverterJob"/> for those.
+    /// </remarks>
+    public sealed class GLESPassthroughJob : GLESJobBase
+    {
+        /// <summary>Callback for when a new frame has been latched, with the external texture, its UV transform matrix and the capture timestamp.</summary>
+        public event Action<Texture2D, Matrix4x4, long>? OnFrameProcessed;
+
+        /// <summary>Wrapper for the camera's external texture, available after setup.</summary>
+        public Texture2D? ExternalTexture { get; private set; }
+
+        /// <summary>The UV transform matrix of the last latched frame, returned by the SurfaceTexture.</summary>
+        public Matrix4x4 TransformMatrix { get; private set; } = Matrix4x4.identity;
+
+        private readonly Resolution _resolution;
+
+        /// <param name="resolution">The resolution of the camera stream.</param>
+        /// <param name="sourceJobId">The job whose camera source this job reads from.</param>
+        internal GLESPassthroughJob(Resolution resolution, uint sourceJobId) : base(GLESAPI.ReserveVirtualJobId(), sourceJobId)
+        {
+            _resolution = resolution;
+            OnFrameProcessed += LastUpdateFrameCallback;
+        }
+
+        /// <summary>Registers the job in the native C++ manager and wraps the source texture in <see cref="ExternalTexture"/>.</summary>
+        /// <returns><see langword="true"/> if the job was set up successfully.</returns>
+        internal async ValueTask<bool> SetupExternalTextureAsync()
+        {
+            uint sourceTexture = await SetupAsync();
+            if (sourceTexture == 0)
+                return false;
+
+            ExternalTexture = Texture2D.CreateExternalTexture(_resolution.width, _resolution.height, TextureFormat.RGBA32, false, false, (IntPtr)sourceTexture);
+            return true;
+        }
+
+        /// <inheritdoc/>
+        protected override RenderJobSetupData CreateSetupData(IntPtr onDone) =>
+            new(Id, _resolution.width, _resolution.height, _sourceJobId, new Rect(0f, 0f, 1f, 1f), RenderJobMode.Passthrough, onDone);
+
+        /// <summary>Latches a single frame and returns its details.</summary>
+        /// <returns>Capture timestamp and UV transform matrix. Timestamp will be -1 if no frame could be latched.</returns>
+        /// <exception cref="InvalidOperationException">Thrown if continuous processing is active.</exception>
+        /// <exception cref="ObjectDisposedException"/>
+        /// <exception cref="TimeoutException"/>
+        public async ValueTask<(long, Matrix4x4)> ProcessSingleFrameAsync(CancellationToken token = default)
+        {
+            (long timestamp, RenderJobFrameInfo frameInfo) = await RunSingleAsync(token);
+            if (timestamp != -1)
+                TransformMatrix = frameInfo.TransformMatrix;
+
+            return (timestamp, TransformMatrix);
+        }
+
+        /// <inheritdoc/>
+        protected override void OnFrameProcessedNative(in RenderJobFrameInfo frameInfo)
+        {
+            if (ExternalTexture == null)
+                return;
+
+            OnFrameProcessed?.OnMainThread(ExternalTexture, frameInfo.TransformMatrix, frameInfo.Timestamp).Forget();
+        }
+
+        private void LastUpdateFrameCallback(Texture2D _, Matrix4x4 transformMatrix, long __)
+        {
+            TransformMatrix = transformMatrix;
+            MarkNewFrame();
+        }
+
+        /// <inheritdoc/>
+        protected override void ReleaseResources()
+        {
+            // Only destroys the wrapper, the native texture is owned by the camera source.
+            if (ExternalTexture != null)
+                UnityEngine.Object.Destroy(ExternalTexture);
+        }
+    }
+}
\ No newline at end of file
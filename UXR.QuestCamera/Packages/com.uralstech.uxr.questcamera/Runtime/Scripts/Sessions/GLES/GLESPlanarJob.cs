@@ -0,0 +1,117 @@
+// Copyright 2026 URAV ADVANCED LEARNING SYSTEMS PRIVATE LIMITED
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+using System;
+using System.Threading;
+using System.Threading.Tasks;
+using UnityEngine;
+using UnityEngine.Experimental.Rendering;
+
+#nullable enable
+namespace Uralstech.UXR.QuestCamera.GLES
+{
+    /// <summary>A native GLES job which renders camera frames as planar YUV, to be converted when sampled in shaders.</summary>
+    /// <remarks>
+    /// Luma is written to the R8 <see cref="LumaTexture"/> and chroma to the half-resolution RG8 <see cref="ChromaTexture"/>, which use
+    /// 60% less memory and bandwidth than RGBA32. Sample both with the <c>QuestCameraYUV.hlsl</c> include to get RGB in materials.
+    /// Values are full range, except for <see cref="CaptureFormat.P010"/> sessions, whose narrow range BT.2020 samples are
+    /// quantized to 8 bits and must be converted with <c>QuestCameraP010ToRGB</c>.
+    /// </remarks>
+    public sealed class GLESPlanarJob : GLESJobBase
+    {
+        /// <summary>Callback for when a frame has been processed, with the luma texture, chroma texture and capture timestamp.</summary>
+        public event Action<Texture2D, Texture2D, long>? OnFrameProcessed;
+
+        /// <summary>The R8 output texture with the luma of converted frames.</summary>
+        public readonly Texture2D LumaTexture;
+
+        /// <summary>The RG8 output texture with the chroma (U, V) of converted frames, at half the resolution of <see cref="LumaTexture"/>.</summary>
+        public readonly Texture2D ChromaTexture;
+
+        /// <summary>The region of the camera image rendered by this job, in normalized UV coordinates.</summary>
+        public readonly Rect CropRect;
+
+        /// <summary>The filter used to resample the camera image to the size of <see cref="LumaTexture"/>.</summary>
+        public readonly RenderJobFilter Filter;
+
+        /// <summary>Strength of the sharpening applied to luma, in [0, 1].</summary>
+        public readonly float Sharpness;
+
+        private GLESPlanarJob(Texture2D lumaTexture, Texture2D chromaTexture, uint sourceJobId, Rect cropRect, RenderJobFilter filter, float sharpness)
+            : base((uint)lumaTexture.GetNativeTexturePtr(), sourceJobId)
+        {
+            LumaTexture = lumaTexture;
+            ChromaTexture = chromaTexture;
+            CropRect = cropRect;
+            Filter = filter;
+            Sharpness = sharpness;
+
+            OnFrameProcessed += LastUpdateFrameCallback;
+        }
+
+        /// <summary>Creates and sets up a planar job.</summary>
+        /// <param name="sourceJobId">The job whose camera source this job reads from.</param>
+        /// <param name="resolution">The resolution of <see cref="LumaTexture"/>.</param>
+        /// <param name="cropRect">The region of the camera image to render, in normalized UV coordinates.</param>
+        /// <param name="filter">The filter used to resample the camera image.</param>
+        /// <param name="sharpness">Strength of the sharpening applied to luma, in [0, 1]. 0 disables sharpening.</param>
+        /// <returns>The created job, or <see langword="null"/> if creation failed.</returns>
+        internal static async ValueTask<GLESPlanarJob?> CreateAsync(uint sourceJobId, Resolution resolution, Rect cropRect, RenderJobFilter filter, float sharpness)
+        {
+            if (!GraphicsUtils.IsGraphicsFormatSupportedForRender(GraphicsFormat.R8_UNorm) || !GraphicsUtils.IsGraphicsFormatSupportedForRender(GraphicsFormat.R8G8_UNorm))
+                throw new NotSupportedException("R8 and RG8 render textures are not supported on device.");
+
+            const TextureCreationFlags flags = TextureCreationFlags.DontUploadUponCreate | TextureCreationFlags.DontInitializePixels;
+            Texture2D lumaTexture = new(resolution.width, resolution.height, GraphicsFormat.R8_UNorm, flags);
+            Texture2D chromaTexture = new((resolution.width + 1) / 2, (resolution.height + 1) / 2, GraphicsFormat.R8G8_UNorm, flags);
+
+            GLESPlanarJob job = new(lumaTexture, chromaTexture, sourceJobId, cropRect, filter, sharpness);
+            if (await job.SetupAsync() != 0)
+                return job;
+
+            await job.DisposeAsync();
+            return null;
+        }
+
+        /// <inheritdoc/>
+        protected override RenderJobSetupData CreateSetupData(IntPtr onDone) =>
+            new(Id, LumaTexture.width, LumaTexture.height, _sourceJobId, 0, CropRect, RenderJobMode.Planar, Filter, Sharpness,
+                RenderJobFlags.None, onDone, IntPtr.Zero, (uint)ChromaTexture.GetNativeTexturePtr());
+
+        /// <summary>Processes a single frame and returns the result.</summary>
+        /// <returns>Capture timestamp and updated luma and chroma textures. Timestamp will be -1 if the capture could not be processed.</returns>
+        /// <exception cref="InvalidOperationException">Thrown if continuous processing is active.</exception>
+        /// <exception cref="ObjectDisposedException"/>
+        /// <exception cref="TimeoutException"/>
+        public async ValueTask<(long, Texture2D, Texture2D)> ProcessSingleFrameAsync(CancellationToken token = default)
+        {
+            (long timestamp, RenderJobFrameInfo _) = await RunSingleAsync(token);
+            return (timestamp, LumaTexture, ChromaTexture);
+        }
+
+        /// <inheritdoc/>
+        protected override void OnFrameProcessedNative(in RenderJobFrameInfo frameInfo) =>
+            OnFrameProcessed?.OnMainThread(LumaTexture, ChromaTexture, frameInfo.Timestamp).Forget();
+
+        private void LastUpdateFrameCallback(Texture2D _, Texture2D __, long ___) => MarkNewFrame();
+
+        /// <inheritdoc/>
+        protected override void ReleaseResources()
+        {
+            UnityEngine.Object.Destroy(LumaTexture);
+            UnityEngine.Object.Destroy(ChromaTexture);
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,118 @@
+// Copyright 2026 URAV ADVANCED LEARNING SYSTEMS PRIVATE LIMITED
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+using System;
+using System.Threading;
+using System.Threading.Tasks;
+using UnityEngine;
+using UnityEngine.Experimental.Rendering;
+
+#nullable enable
+namespace Uralstech.UXR.QuestCamera.GLES
+{
+    /// <summary>A native GLES job which converts the frames of two capture sessions into the layers of a 2-layer <see cref="Texture2DArray"/>.</summary>
+    /// <remarks>
+    /// Both layers are rendered in a single draw with <c>GL_OVR_multiview2</c>, which is the layout stereo XR shaders expect,
+    /// so no per-eye copies are needed. Layer 0 is read from the left session and layer 1 from the right session.
+    /// </remarks>
+    public sealed class GLESStereoConverterJob : GLESJobBase
+    {
+        /// <summary>Callback for when a stereo frame has been processed, with the texture array and the left capture timestamp.</summary>
+        public event Action<Texture2DArray, long>? OnFrameProcessed;
+
+        /// <summary>The output texture array, with the left eye in layer 0 and the right eye in layer 1.</summary>
+        public readonly Texture2DArray Texture;
+
+        /// <summary>The region of the camera images converted by this job, in normalized UV coordinates.</summary>
+        public readonly Rect CropRect;
+
+        /// <summary>The filter used to resample the camera images to the size of <see cref="Texture"/>.</summary>
+        public readonly RenderJobFilter Filter;
+
+        /// <summary>Strength of the sharpening applied during conversion, in [0, 1].</summary>
+        public readonly float Sharpness;
+
+        private readonly uint _secondSourceJobId;
+
+        private GLESStereoConverterJob(Texture2DArray texture, uint leftJobId, uint rightJobId, Rect cropRect, RenderJobFilter filter, float sharpness) : base((uint)texture.GetNativeTexturePtr(), leftJobId)
+        {
+            Texture = texture;
+            CropRect = cropRect;
+            Filter = filter;
+            Sharpness = sharpness;
+            _secondSourceJobId = rightJobId;
+
+            OnFrameProcessed += LastUpdateFrameCallback;
+        }
+
+        /// <summary>Creates a stereo conversion job which reads from the camera streams of two sessions.</summary>
+        /// <remarks>The job must be disposed before either session, with <see cref="GLESJobBase.DisposeAsync"/>.</remarks>
+        /// <param name="left">The session rendered into layer 0.</param>
+        /// <param name="right">The session rendered into layer 1. Must be a different session than <paramref name="left"/>.</param>
+        /// <param name="resolution">The resolution of each layer of <see cref="Texture"/>.</param>
+        /// <param name="cropRect">The region of the camera images to convert, in normalized UV coordinates. Defaults to the full images.</param>
+        /// <param name="textureFormat">If not specified, uses equivalent of <see cref="RenderTextureFormat.ARGB32"/>.</param>
+        /// <param name="filter">The filter used to resample the camera images.</param>
+        /// <param name="sharpness">Strength of the sharpening applied during conversion, in [0, 1]. 0 disables sharpening.</param>
+        /// <returns>The created job, or <see langword="null"/> if creation failed, for example if <c>GL_OVR_multiview2</c> is not supported.</returns>
+        public static async ValueTask<GLESStereoConverterJob?> CreateAsync(GLESCaptureSession left, GLESCaptureSession right, Resolution resolution,
+            Rect? cropRect = null, GraphicsFormat textureFormat = GraphicsFormat.None, RenderJobFilter filter = RenderJobFilter.Bilinear, float sharpness = 0f)
+        {
+            if (left == right)
+                throw new ArgumentException("The left and right sessions must be different.", nameof(right));
+
+            if (sharpness < 0f || sharpness > 1f)
+                throw new ArgumentOutOfRangeException(nameof(sharpness), "Sharpness must be in the range [0, 1].");
+
+            if (textureFormat == GraphicsFormat.None)
+                textureFormat = GraphicsFormatUtility.GetGraphicsFormat(RenderTextureFormat.ARGB32, RenderTextureReadWrite.Default);
+
+            if (!GraphicsUtils.IsGraphicsFormatSupportedForRender(textureFormat))
+                throw new ArgumentException($"Format {textureFormat} is not supported on device.", nameof(textureFormat));
+
+            Texture2DArray texture = new(resolution.width, resolution.height, 2, textureFormat, TextureCreationFlags.DontUploadUponCreate | TextureCreationFlags.DontInitializePixels);
+            GLESStereoConverterJob job = new(texture, left.Job.Id, right.Job.Id, cropRect ?? new Rect(0f, 0f, 1f, 1f), filter, sharpness);
+
+            if (await job.SetupAsync() != 0)
+                return job;
+
+            await job.DisposeAsync();
+            return null;
+        }
+
+        /// <inheritdoc/>
+        protected override RenderJobSetupData CreateSetupData(IntPtr onDone) =>
+            new(Id, Texture.width, Texture.height, _sourceJobId, _secondSourceJobId, CropRect, RenderJobMode.Stereo, Filter, Sharpness, onDone);
+
+        /// <summary>Processes a single stereo frame and returns the result.</summary>
+        /// <returns>Left capture timestamp and updated texture array. Timestamp will be -1 if the captures could not be processed.</returns>
+        /// <exception cref="InvalidOperationException">Thrown if continuous processing is active.</exception>
+        /// <exception cref="ObjectDisposedException"/>
+        /// <exception cref="TimeoutException"/>
+        public async ValueTask<(long, Texture2DArray)> ProcessSingleFrameAsync(CancellationToken token = default)
+        {
+            (long timestamp, RenderJobFrameInfo _) = await RunSingleAsync(token);
+            return (timestamp, Texture);
+        }
+
+        /// <inheritdoc/>
+        protected override void OnFrameProcessedNative(in RenderJobFrameInfo frameInfo) =>
+            OnFrameProcessed?.OnMainThread(Texture, frameInfo.Timestamp).Forget();
+
+        private void LastUpdateFrameCallback(Texture2DArray _, long __) => MarkNewFrame();
+
+        /// <inheritdoc/>
+        protected override void ReleaseResources() => UnityEngine.Object.Destroy(Texture);
+    }
+}
\ No newline at end of file
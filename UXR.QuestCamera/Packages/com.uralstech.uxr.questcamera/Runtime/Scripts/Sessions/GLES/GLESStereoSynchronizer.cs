@@ -0,0 +1,100 @@
+// Copyright 2026 URAV ADVANCED LEARNING SYSTEMS PRIVATE LIMITED
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+using System;
+using System.Runtime.InteropServices;
+
+#nullable enable
+namespace Uralstech.UXR.QuestCamera.GLES
+{
+    /// <summary>Pairs the frames of two converting jobs, one per camera, by capture timestamp.</summary>
+    /// <remarks>
+    /// Frames are matched natively as the jobs render them, in constant time per frame. Frames without a frame of the other
+    /// camera within the tolerance are dropped and counted in <see cref="StereoSyncStats"/>. Matched pairs are queued until
+    /// polled, and the oldest pair is replaced when the queue is full. Each job's texture holds its latest frame, so compare
+    /// the sequences of a pair with <see cref="GLESJobBase.LastFrameInfo"/> before using the textures together.
+    /// </remarks>
+    public sealed class GLESStereoSynchronizer : IDisposable
+    {
+        [DllImport("UXRQC_NativeConverters")]
+        private static extern uint createGLESStereoSynchronizer(uint leftJobId, uint rightJobId, long tolerance, uint queueDepth);
+
+        [DllImport("UXRQC_NativeConverters")]
+        [return: MarshalAs(UnmanagedType.U1)]
+        private static extern bool pollGLESStereoPair(uint syncId, out StereoFramePair pair);
+
+        [DllImport("UXRQC_NativeConverters")]
+        [return: MarshalAs(UnmanagedType.U1)]
+        private static extern bool getGLESStereoSyncStats(uint syncId, out StereoSyncStats stats);
+
+        [DllImport("UXRQC_NativeConverters")]
+        private static extern void destroyGLESStereoSynchronizer(uint syncId);
+
+        /// <summary>The maximum number of queued pairs.</summary>
+        public const int MaxQueueDepth = 16;
+
+        private readonly uint _id;
+        private bool _disposed;
+
+        private GLESStereoSynchronizer(uint id) => _id = id;
+
+        /// <summary>Starts pairing the frames of two jobs.</summary>
+        /// <param name="left">The left camera's job, which must have been set up.</param>
+        /// <param name="right">The right camera's job, which must have been set up.</param>
+        /// <param name="tolerance">The maximum difference between paired timestamps, in nanoseconds. Should be under half the frame period.</param>
+        /// <param name="queueDepth">The number of pairs kept until polled, in [1, <see cref="MaxQueueDepth"/>].</param>
+        /// <returns>The synchronizer, or <see langword="null"/> if either job is not a set up <see cref="GLESConverterJob"/> or the parameters are invalid.</returns>
+        public static GLESStereoSynchronizer? Create(GLESConverterJob left, GLESConverterJob right, long tolerance = 5_000_000, int queueDepth = 4)
+        {
+            uint id = createGLESStereoSynchronizer(left.Id, right.Id, tolerance, (uint)Math.Max(queueDepth, 0));
+            return id != 0 ? new GLESStereoSynchronizer(id) : null;
+        }
+
+        /// <summary>Takes the oldest queued pair.</summary>
+        /// <remarks>This can be called from any thread.</remarks>
+        /// <returns><see langword="true"/> if a pair was queued; <see langword="false"/> otherwise.</returns>
+        /// <exception cref="ObjectDisposedException"/>
+        public bool TryPoll(out StereoFramePair pair)
+        {
+            ThrowIfDisposed();
+            return pollGLESStereoPair(_id, out pair);
+        }
+
+        /// <summary>Gets the counters of the synchronizer.</summary>
+        /// <exception cref="ObjectDisposedException"/>
+        public StereoSyncStats GetStats()
+        {
+            ThrowIfDisposed();
+            getGLESStereoSyncStats(_id, out StereoSyncStats stats);
+            return stats;
+        }
+
+        /// <summary>Stops pairing frames. Must be called before either job is disposed.</summary>
+        public void Dispose()
+        {
+            if (_disposed)
+                return;
+
+            _disposed = true;
+            destroyGLESStereoSynchronizer(_id);
+        }
+
+        /// <exception cref="ObjectDisposedException"/>
+        private void ThrowIfDisposed()
+        {
+            if (_disposed)
+                throw new ObjectDisposedException(GetType().Name);
+        }
+    }
+}
\ No newline at end of file
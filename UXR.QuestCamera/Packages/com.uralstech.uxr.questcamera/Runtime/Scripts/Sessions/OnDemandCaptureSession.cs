@@ -12,7 +12,11 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+using AOT;
 using System;
+using System.Collections.Concurrent;
+using System.Runtime.InteropServices;
+using System.Threading.Tasks;
 using UnityEngine;
 
 #nullable enable
@@ -44,7 +48,138 @@ namespace Uralstech.UXR.QuestCamera
             }
         }
 
-        public OnDemandCaptureSession(Resolution resolution) : base(resolution, ClassName) { }
+        /// <summary>A capture copied into a preallocated native buffer by <see cref="EnableNativeBuffers(int)"/>.</summary>
+        /// <remarks>The planes stay valid until the capture is released with <see cref="ReleaseNativeCapture(in NativeCaptureImage)"/>.</remarks>
+        [StructLayout(LayoutKind.Sequential)]
+        public readonly struct NativeCaptureImage
+        {
+            /// <summary>Pointer to the Y plane.</summary>
+            public readonly IntPtr YPlane;
+
+            /// <summary>Pointer to the U plane.</summary>
+            public readonly IntPtr UPlane;
+
+            /// <summary>Pointer to the V plane.</summary>
+            public readonly IntPtr VPlane;
+
+            /// <summary>Size of the Y plane, in bytes.</summary>
+            public readonly long YPlaneSize;
+
+            /// <summary>Size of the U and V planes, in bytes.</summary>
+            public readonly long UVPlaneSize;
+
+            /// <summary>Row stride of the Y plane.</summary>
+            public readonly int YRowStride;
+
+            /// <summary>Row stride of the U and V planes.</summary>
+            public readonly int UVRowStride;
+
+            /// <summary>Pixel stride of the U and V planes.</summary>
+            public readonly int UVPixelStride;
+
+            /// <summary>Width of the image.</summary>
+            public readonly int Width;
+
+            /// <summary>Height of the image.</summary>
+            public readonly int Height;
+
+            /// <summary>Capture timestamp, in nanoseconds.</summary>
+            public readonly long Timestamp;
+
+            /// <summary>Sequence ID of the request which captured the image, or -1 if the image arrived before it was known.</summary>
+            public readonly int SequenceId;
+
+            /// <summary>The buffer slot holding the image.</summary>
+            public readonly int Slot;
+        }
+
+        /// <summary>Counters of the native buffers enabled by <see cref="EnableNativeBuffers(int)"/>.</summary>
+        [StructLayout(LayoutKind.Sequential)]
+        public readonly struct NativeCaptureStats
+        {
+            /// <summary>The number of captures copied into native buffers.</summary>
+            public readonly ulong Captures;
+
+            /// <summary>The number of captures dropped because no buffer was armed for them.</summary>
+            public readonly ulong Dropped;
+        }
+
+        /// <summary>Callback for native buffer captures, on the camera's image thread.</summary>
+        public delegate void OnNativeCaptureReadyCallback(in NativeCaptureImage image);
+
+        /// <summary>Called on the camera's image thread when a capture has been copied into a native buffer.</summary>
+        /// <remarks>The capture must be released with <see cref="ReleaseNativeCapture(in NativeCaptureImage)"/> once it has been used.</remarks>
+        public event OnNativeCaptureReadyCallback? OnNativeCaptureReady;
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        private delegate void NativeCaptureCallback(uint ringId, IntPtr image);
+
+        [DllImport("UXRQC_NativeConverters")]
+        private static extern uint createCaptureBufferRing(int width, int height, uint slotCount, IntPtr onCapture);
+
+        [DllImport("UXRQC_NativeConverters")]
+        [return: MarshalAs(UnmanagedType.U1)]
+        private static extern bool releaseCaptureBuffer(uint ringId, int slot);
+
+        [DllImport("UXRQC_NativeConverters")]
+        [return: MarshalAs(UnmanagedType.U1)]
+        private static extern bool getCaptureBufferRingStats(uint ringId, out NativeCaptureStats stats);
+
+        [DllImport("UXRQC_NativeConverters")]
+        private static extern void destroyCaptureBufferRing(uint ringId);
+
+        private static readonly ConcurrentDictionary<uint, OnDemandCaptureSession> s_ringSessions = new();
+        private static readonly IntPtr s_nativeCaptureCallbackPtr = Marshal.GetFunctionPointerForDelegate<NativeCaptureCallback>(OnNativeCapture);
+
+        private readonly Resolution _resolution;
+        private uint _ringId;
+
+        public OnDemandCaptureSession(Resolution resolution) : base(resolution, ClassName)
+        {
+            _resolution = resolution;
+        }
+
+        /// <summary>Copies captures into preallocated native buffers instead of calling <see cref="ContinuousCaptureSession.Proxy.OnFrameReady"/>.</summary>
+        /// <remarks>
+        /// A buffer is reserved before each request is sent and tagged with the request's sequence ID, so nothing is allocated
+        /// between <see cref="RequestCapture(CaptureTemplate)"/> and the capture being reported by <see cref="OnNativeCaptureReady"/>.
+        /// Requests fail with <see cref="CaptureSessionBase{TProxy}.ErrorCode.OutOfResourcesError"/> while every buffer is waiting or held.
+        /// </remarks>
+        /// <param name="slotCount">The number of captures which can be in flight or held at once, up to 8.</param>
+        /// <returns><see langword="true"/> if the buffers were allocated; <see langword="false"/> otherwise.</returns>
+        /// <exception cref="InvalidOperationException">Thrown if native buffers are already enabled.</exception>
+        /// <exception cref="ObjectDisposedException"/>
+        public bool EnableNativeBuffers(int slotCount = 3)
+        {
+            ThrowIfDisposed();
+            if (_ringId != 0)
+                throw new InvalidOperationException("Native buffers are already enabled.");
+
+            uint ringId = createCaptureBufferRing(_resolution.width, _resolution.height, (uint)slotCount, s_nativeCaptureCallbackPtr);
+            if (ringId == 0)
+                return false;
+
+            s_ringSessions[ringId] = this;
+            _ringId = ringId;
+            _native.Call("setNativeCaptureRing", (int)ringId);
+            return true;
+        }
+
+        /// <summary>Returns the buffer of a native capture to the session.</summary>
+        /// <returns><see langword="true"/> if the buffer was held; <see langword="false"/> otherwise.</returns>
+        public bool ReleaseNativeCapture(in NativeCaptureImage image) => ReleaseNativeCapture(image.Slot);
+
+        /// <inheritdoc cref="ReleaseNativeCapture(in NativeCaptureImage)"/>
+        /// <param name="slot">The <see cref="NativeCaptureImage.Slot"/> of the capture.</param>
+        public bool ReleaseNativeCapture(int slot) => _ringId != 0 && releaseCaptureBuffer(_ringId, slot);
+
+        /// <summary>Gets the counters of the native buffers.</summary>
+        /// <returns><see langword="true"/> if native buffers are enabled; <see langword="false"/> otherwise.</returns>
+        public bool TryGetNativeCaptureStats(out NativeCaptureStats stats)
+        {
+            stats = default;
+            return _ringId != 0 && getCaptureBufferRingStats(_ringId, out stats);
+        }
 
         /// <summary>Requests a new capture from the session.</summary>
         /// <param name="errorCode">Error code if the operation was unsuccessful.</param>
@@ -77,5 +212,38 @@ namespace Uralstech.UXR.QuestCamera
                 status == 0
             );
         }
+
+        /// <inheritdoc/>
+        /// <remarks>Native captures which have not been released become invalid.</remarks>
+        public override async ValueTask DisposeAsync()
+        {
+            await base.DisposeAsync();
+            if (_ringId == 0)
+                return;
+
+            s_ringSessions.TryRemove(_ringId, out _);
+            destroyCaptureBufferRing(_ringId);
+            _ringId = 0;
+        }
+
+        [MonoPInvokeCallback(typeof(NativeCaptureCallback))]
+        private static void OnNativeCapture(uint ringId, IntPtr image)
+        {
+            if (!s_ringSessions.TryGetValue(ringId, out OnDemandCaptureSession? session))
+            {
+                Debug.LogWarning($"Dangling {nameof(OnNativeCapture)} for capture ring ID {ringId}.");
+                return;
+            }
+
+            NativeCaptureImage captureImage = Marshal.PtrToStructure<NativeCaptureImage>(image);
+            try
+            {
+                session.OnNativeCaptureReady?.Invoke(captureImage);
+            }
+            catch (Exception ex)
+            {
+                Debug.LogException(ex);
+            }
+        }
     }
 }
\ No newline at end of file
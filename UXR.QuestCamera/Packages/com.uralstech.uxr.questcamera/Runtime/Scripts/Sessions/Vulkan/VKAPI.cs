@@ -0,0 +1,79 @@
+// Copyright 2026 URAV ADVANCED LEARNING SYSTEMS PRIVATE LIMITED
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+using System;
+using System.Runtime.InteropServices;
+using Uralstech.UXR.QuestCamera.GLES;
+
+#nullable enable
+namespace Uralstech.UXR.QuestCamera.Vulkan
+{
+    /// <summary>Output texture formats of native plane converters.</summary>
+    public enum VKPlaneOutputFormat
+    {
+        /// <summary><see cref="UnityEngine.Experimental.Rendering.GraphicsFormat.R8G8B8A8_UNorm"/> or <see cref="UnityEngine.Experimental.Rendering.GraphicsFormat.R8G8B8A8_SRGB"/>.</summary>
+        RGBA8   = 0,
+
+        /// <summary><see cref="UnityEngine.Experimental.Rendering.GraphicsFormat.A2B10G10R10_UNormPack32"/>.</summary>
+        RGB10A2 = 1,
+
+        /// <summary><see cref="UnityEngine.Experimental.Rendering.GraphicsFormat.R16G16B16A16_SFloat"/>.</summary>
+        RGBA16F = 2,
+    }
+
+    /// <summary>Exposes the native Vulkan Texture Conversion API.</summary>
+    public static class VKAPI
+    {
+        [DllImport("UXRQC_NativeConverters")]
+        [return: MarshalAs(UnmanagedType.U1)]
+        private static extern bool isVKConverterAvailable();
+
+        /// <summary>
+        /// <see langword="true"/> if Unity is rendering with Vulkan, and its device supports importing camera buffers.
+        /// </summary>
+        /// <remarks>
+        /// The native plugin asks Unity to enable the extensions it needs when it is loaded, which only works if it is loaded
+        /// before Unity creates its Vulkan device.
+        /// </remarks>
+        public static bool IsAvailable => isVKConverterAvailable();
+
+        /// <summary>Creates a native converter for CPU-side YUV 4:2:0 planes, which renders into the given texture.</summary>
+        /// <remarks>
+        /// Must be called after Unity's Vulkan device has been created. The texture must be a <see cref="UnityEngine.RenderTexture"/> of
+        /// <paramref name="outputFormat"/> with random write enabled. P010 planes are unpacked to 10-bit samples as they are submitted.
+        /// </remarks>
+        /// <returns>The converter's ID, or 0 if it could not be created, like if the device can't write <paramref name="outputFormat"/> from shaders.</returns>
+        [DllImport("UXRQC_NativeConverters")]
+        public static extern uint createVKPlaneConverter(IntPtr nativeTexture, int width, int height, CaptureFormat sampleFormat, VKPlaneOutputFormat outputFormat);
+
+        /// <summary>Copies a frame's planes into the converter's staging memory, to be converted by its next <see cref="RenderJobEvent.Run"/> event.</summary>
+        /// <remarks>The planes are only read during the call, so this can be called from the camera thread which owns them.</remarks>
+        /// <returns><see langword="true"/> if the frame was staged; <see langword="false"/> if it was dropped.</returns>
+        [DllImport("UXRQC_NativeConverters")]
+        [return: MarshalAs(UnmanagedType.U1)]
+        public static extern bool submitVKPlaneFrame(uint converterId,
+            IntPtr yPlane, long yPlaneSize,
+            IntPtr uPlane, IntPtr vPlane, long uvPlaneSize,
+            int yRowStride, int uvRowStride, int uvPixelStride,
+            long timestamp);
+
+        /// <summary>Returns a pointer to the native plane converter management function.</summary>
+        /// <remarks>
+        /// Supports the <see cref="RenderJobEvent.Run"/> and <see cref="RenderJobEvent.Dispose"/> events, with the converter's ID
+        /// passed as the event data instead of a pointer.
+        /// </remarks>
+        [DllImport("UXRQC_NativeConverters")]
+        public static extern IntPtr getVKPlaneConverterEvent();
+    }
+}
\ No newline at end of file
@@ -0,0 +1,113 @@
+// Copyright 2026 URAV ADVANCED LEARNING SYSTEMS PRIVATE LIMITED
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+using System;
+using System.Threading;
+using System.Threading.Tasks;
+using UnityEngine;
+using UnityEngine.Experimental.Rendering;
+
+#nullable enable
+namespace Uralstech.UXR.QuestCamera.Vulkan
+{
+    /// <summary>Manages a camera capture session with a repeating request, converting frames in native Vulkan.</summary>
+    /// <remarks>Requires Unity to render with Vulkan, see <see cref="VKAPI.IsAvailable"/>.</remarks>
+    public sealed class VKCaptureSession : CaptureSessionBase<VKCaptureSession.Proxy>
+    {
+        /// <inheritdoc/>
+        public sealed class Proxy : ProxyBase { }
+
+        private const string ClassName = "com.uralstech.uxr.questcamera.VKCaptureSessionManager";
+
+        /// <summary>Callback for when a frame has been processed, with the frame texture and capture timestamp.</summary>
+        public event Action<Texture2D, long>? OnFrameProcessed
+        {
+            add => Job.OnFrameProcessed += value;
+            remove => Job.OnFrameProcessed -= value;
+        }
+
+        /// <summary><see langword="true"/> if a capture was processed this frame; <see langword="false"/> otherwise.</summary>
+        public bool HasNewFrame => Job.HasNewFrame;
+
+        /// <summary>The output texture with converted frames.</summary>
+        public readonly Texture2D Texture;
+
+        /// <summary>The capture timestamp of the last processed frame.</summary>
+        public long CaptureTimestamp => Job.CaptureTimestamp;
+
+        /// <summary>The native job which owns the camera source and renders into <see cref="Texture"/>.</summary>
+        public readonly VKConverterJob Job;
+
+        private static Proxy MakeProxy(out Proxy proxy) => proxy = new Proxy();
+
+        private static int MakeJob(Resolution resolution, GraphicsFormat textureFormat, out VKConverterJob job)
+        {
+            job = new VKConverterJob(resolution, textureFormat, new Rect(0f, 0f, 1f, 1f));
+            return (int)job.Id;
+        }
+
+        /// <param name="textureFormat">If not specified, uses equivalent of <see cref="RenderTextureFormat.ARGB32"/>.</param>
+        public VKCaptureSession(Resolution resolution, GraphicsFormat textureFormat = GraphicsFormat.None)
+            : base(MakeProxy(out Proxy proxy), new(ClassName, MakeJob(resolution, textureFormat, out VKConverterJob job), proxy))
+        {
+            Job = job;
+            Texture = job.Texture;
+        }
+
+        /// <summary>Creates the job and its image reader in the native C++ manager.</summary>
+        /// <returns>The ID of the job, or 0 if the operation failed.</returns>
+        public ValueTask<uint> SetupJobAsync()
+        {
+            ThrowIfDisposed();
+            return Job.SetupAsync();
+        }
+
+        /// <inheritdoc cref="GLES.GLESJobBase.StartContinuousProcessing(int)"/>
+        public void StartContinuousProcessing(int maxFramerate = 60)
+        {
+            ThrowIfDisposed();
+            Job.StartContinuousProcessing(maxFramerate);
+        }
+
+        /// <inheritdoc cref="VKConverterJob.ProcessSingleFrameAsync(CancellationToken)"/>
+        public ValueTask<(long, Texture2D)> ProcessSingleFrameAsync(CancellationToken token = default)
+        {
+            ThrowIfDisposed();
+            return Job.ProcessSingleFrameAsync(token);
+        }
+
+        /// <inheritdoc/>
+        public override async ValueTask DisposeAsync()
+        {
+            if (_disposed)
+                return;
+
+            _disposed = true;
+            State = ResourceState.Invalid;
+
+            await Job.StopProcessingAsync();
+
+            try
+            {
+                await CloseWork();
+            }
+            finally
+            {
+                await Job.DisposeAsync();
+            }
+
+            GC.SuppressFinalize(this);
+        }
+    }
+}
\ No newline at end of file
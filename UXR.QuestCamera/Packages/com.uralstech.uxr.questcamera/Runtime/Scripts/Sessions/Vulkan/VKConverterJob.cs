@@ -0,0 +1,86 @@
+// Copyright 2026 URAV ADVANCED LEARNING SYSTEMS PRIVATE LIMITED
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+using System;
+using System.Threading;
+using System.Threading.Tasks;
+using Uralstech.UXR.QuestCamera.GLES;
+using UnityEngine;
+using UnityEngine.Experimental.Rendering;
+
+#nullable enable
+namespace Uralstech.UXR.QuestCamera.Vulkan
+{
+    /// <summary>A native Vulkan job which converts camera frames from an AImageReader source into <see cref="Texture"/>.</summary>
+    /// <remarks>
+    /// Camera buffers are imported into Vulkan without copies and converted with a YCbCr sampler. Only full conversions of one
+    /// crop rect are supported, so the sampling, counter, metadata and frame bus APIs of GLES jobs do not apply to this job.
+    /// </remarks>
+    public sealed class VKConverterJob : GLESJobBase
+    {
+        private static int s_lastId;
+
+        /// <summary>Callback for when a frame has been processed, with the frame texture and capture timestamp.</summary>
+        public event Action<Texture2D, long>? OnFrameProcessed;
+
+        /// <summary>The output texture with converted frames.</summary>
+        public readonly Texture2D Texture;
+
+        /// <summary>The region of the camera image converted by this job, in normalized UV coordinates.</summary>
+        public readonly Rect CropRect;
+
+        /// <param name="resolution">The resolution of <see cref="Texture"/> and of the camera stream.</param>
+        /// <param name="textureFormat">If not specified, uses equivalent of <see cref="RenderTextureFormat.ARGB32"/>.</param>
+        /// <param name="cropRect">The region of the camera image to convert, in normalized UV coordinates.</param>
+        internal VKConverterJob(Resolution resolution, GraphicsFormat textureFormat, Rect cropRect)
+            : base((uint)Interlocked.Increment(ref s_lastId), 0)
+        {
+            if (textureFormat == GraphicsFormat.None)
+                textureFormat = GraphicsFormatUtility.GetGraphicsFormat(RenderTextureFormat.ARGB32, RenderTextureReadWrite.Default);
+
+            if (!GraphicsUtils.IsGraphicsFormatSupportedForRender(textureFormat))
+                throw new ArgumentException($"Format {textureFormat} is not supported on device.", nameof(textureFormat));
+
+            Texture = new Texture2D(resolution.width, resolution.height, textureFormat, TextureCreationFlags.DontUploadUponCreate | TextureCreationFlags.DontInitializePixels);
+            CropRect = cropRect;
+
+            OnFrameProcessed += LastUpdateFrameCallback;
+        }
+
+        /// <inheritdoc/>
+        protected override RenderJobSetupData CreateSetupData(IntPtr onDone) =>
+            new(Id, Texture.width, Texture.height, 0, 0, CropRect, RenderJobMode.Convert, RenderJobFilter.Bilinear, 0f,
+                RenderJobFlags.None, onDone, Texture.GetNativeTexturePtr());
+
+        /// <summary>Processes a single frame and returns the result.</summary>
+        /// <returns>Capture timestamp and updated texture. Timestamp will be -1 if the capture could not be processed.</returns>
+        /// <exception cref="InvalidOperationException">Thrown if continuous processing is active.</exception>
+        /// <exception cref="ObjectDisposedException"/>
+        /// <exception cref="TimeoutException"/>
+        public async ValueTask<(long, Texture2D)> ProcessSingleFrameAsync(CancellationToken token = default)
+        {
+            (long timestamp, RenderJobFrameInfo _) = await RunSingleAsync(token);
+            return (timestamp, Texture);
+        }
+
+        /// <inheritdoc/>
+        protected override void OnFrameProcessedNative(in RenderJobFrameInfo frameInfo) =>
+            OnFrameProcessed?.OnMainThread(Texture, frameInfo.Timestamp).Forget();
+
+        private void LastUpdateFrameCallback(Texture2D _, long __) => MarkNewFrame();
+
+        /// <inheritdoc/>
+        protected override void ReleaseResources() => UnityEngine.Object.Destroy(Texture);
+    }
+}
\ No newline at end of file
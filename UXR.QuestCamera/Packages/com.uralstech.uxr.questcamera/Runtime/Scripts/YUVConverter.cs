@@ -21,6 +21,8 @@ using Unity.Collections.LowLevel.Unsafe;
 using UnityEngine;
 using UnityEngine.Experimental.Rendering;
 using UnityEngine.Rendering;
+using Uralstech.UXR.QuestCamera.GLES;
+using Uralstech.UXR.QuestCamera.Vulkan;
 
 #if !UNITY_6000_0_OR_NEWER
 using Utilities.Async;
@@ -30,6 +32,10 @@ using Utilities.Async;
 namespace Uralstech.UXR.QuestCamera
 {
     /// <summary>Converts raw camera capture session frames to Unity-supported RGBA.</summary>
+    /// <remarks>
+    /// When Unity renders with Vulkan and the converter uses the default kernel, frames are converted natively: the planes are
+    /// copied once, straight into GPU-visible staging memory, and converted by a native compute shader. See <see cref="IsNative"/>.
+    /// </remarks>
     public sealed class YUVConverter : IDisposable
     {
         private static readonly int s_shaderYBufferId = Shader.PropertyToID("YBuffer");
@@ -68,6 +74,7 @@ namespace Uralstech.UXR.QuestCamera
         public event Action<RenderTexture, long>? OnFrameProcessed;
 
         /// <summary>The shader used for conversion.</summary>
+        /// <remarks>Setting this switches a native converter back to Unity's compute path.</remarks>
         public ComputeShaderKernel ShaderKernel
         {
             get => _kernel;
@@ -80,6 +87,7 @@ namespace Uralstech.UXR.QuestCamera
                     throw new ArgumentException("Provided kernel is invalid.", nameof(value));
 
                 _kernel = value;
+                ReleaseNativeConverter();
                 ConfigureCommandBuffer();
             }
         }
@@ -93,31 +101,55 @@ namespace Uralstech.UXR.QuestCamera
         /// <summary>The capture timestamp of the last processed frame.</summary>
         public long CaptureTimestamp { get; private set; }
 
+        /// <summary><see langword="true"/> if frames are converted by the native Vulkan compute path instead of <see cref="ShaderKernel"/>.</summary>
+        public bool IsNative => _nativeConverterId != 0;
+
+        /// <summary>The sample format of the frames given to this converter.</summary>
+        public readonly CaptureFormat InputFormat;
+
         private ComputeShaderKernel _kernel;
 
         private readonly CommandBuffer _commandBuffer;
-        private readonly GraphicsBuffer _strideParams, _yBuffer, _uBuffer, _vBuffer;
-        private readonly NativeArray<byte> _yCopyBuffer, _uCopyBuffer, _vCopyBuffer;
         private readonly int _yBufferSize, _uvBufferSize;
 
+        // Only created for Unity's compute path.
+        private GraphicsBuffer? _strideParams, _yBuffer, _uBuffer, _vBuffer;
+        private NativeArray<byte> _yCopyBuffer, _uCopyBuffer, _vCopyBuffer;
+
+        private volatile uint _nativeConverterId;
+
         private int _lastUpdateFrame;
         private int _isProcessing;
         private bool _disposed;
 
-        private static ComputeShaderKernel GetDefaultKernel()
+        private static ComputeShaderKernel GetDefaultKernel(CaptureFormat inputFormat)
         {
             QuestCameraManager cameraManager = QuestCameraManager.Instance;
-            return cameraManager != null
-                ? cameraManager.ConversionKernel
-                : throw new InvalidOperationException($"Cannot create {nameof(YUVConverter)}: no shader kernel provided and {nameof(QuestCameraManager)} is missing.");
+            if (cameraManager == null)
+                throw new InvalidOperationException($"Cannot create {nameof(YUVConverter)}: no shader kernel provided and {nameof(QuestCameraManager)} is missing.");
+
+            // The default shader has a P010 variant of its kernel.
+            return inputFormat == CaptureFormat.P010
+                ? new ComputeShaderKernel(cameraManager.ConversionKernel.Shader, "CSMainP010")
+                : cameraManager.ConversionKernel;
         }
 
         /// <summary>Creates a new converter with the shader and kernel described in the scene instance of <see cref="QuestCameraManager"/>.</summary>
-        /// <param name="textureFormat">If not specified, uses equivalent of <see cref="RenderTextureFormat.ARGB32"/>.</param>
-        public YUVConverter(Resolution resolution, GraphicsFormat textureFormat = GraphicsFormat.None) : this(resolution, GetDefaultKernel(), textureFormat) { }
+        /// <remarks>Uses the native Vulkan compute path instead of the kernel if <see cref="VKAPI.IsAvailable"/>.</remarks>
+        /// <param name="textureFormat">
+        /// If not specified, uses equivalent of <see cref="RenderTextureFormat.ARGB32"/>. The native path supports
+        /// <see cref="GraphicsFormat.R8G8B8A8_UNorm"/>, <see cref="GraphicsFormat.A2B10G10R10_UNormPack32"/> and <see cref="GraphicsFormat.R16G16B16A16_SFloat"/>.
+        /// </param>
+        /// <param name="inputFormat">The sample format of the frames given to <see cref="OnFrameReady"/>.</param>
+        public YUVConverter(Resolution resolution, GraphicsFormat textureFormat = GraphicsFormat.None, CaptureFormat inputFormat = CaptureFormat.YUV420_888)
+            : this(resolution, GetDefaultKernel(inputFormat), textureFormat, inputFormat, VKAPI.IsAvailable) { }
 
         /// <param name="textureFormat">If not specified, uses equivalent of <see cref="RenderTextureFormat.ARGB32"/>.</param>
-        public YUVConverter(Resolution resolution, ComputeShaderKernel kernel, GraphicsFormat textureFormat = GraphicsFormat.None)
+        /// <param name="inputFormat">The sample format of the frames given to <see cref="OnFrameReady"/>, which <paramref name="kernel"/> must read.</param>
+        public YUVConverter(Resolution resolution, ComputeShaderKernel kernel, GraphicsFormat textureFormat = GraphicsFormat.None, CaptureFormat inputFormat = CaptureFormat.YUV420_888)
+            : this(resolution, kernel, textureFormat, inputFormat, false) { }
+
+        private YUVConverter(Resolution resolution, ComputeShaderKernel kernel, GraphicsFormat textureFormat, CaptureFormat inputFormat, bool preferNative)
         {
             if (kernel == null)
                 throw new ArgumentNullException(nameof(kernel));
@@ -140,31 +172,59 @@ namespace Uralstech.UXR.QuestCamera
             if (!Texture.Create())
                 throw new UnityException("Could not create RenderTexture.");
 
-            _yBufferSize = resolution.width * resolution.height;
+            // P010 samples are two bytes each.
+            InputFormat = inputFormat;
+            int sampleBytes = inputFormat == CaptureFormat.P010 ? 2 : 1;
+
+            _yBufferSize = resolution.width * resolution.height * sampleBytes;
             _uvBufferSize = Mathf.CeilToInt(_yBufferSize / 2f);
 
             _commandBuffer = new CommandBuffer();
-            
-            _strideParams = new GraphicsBuffer(GraphicsBuffer.Target.Raw, GraphicsBuffer.UsageFlags.LockBufferForWrite, 1, s_strideParamsStructSize);
 
-            int alignedYBufferSize = Mathf.CeilToInt(_yBufferSize / 4f);
-            int alignedUVBufferSize = Mathf.CeilToInt(_uvBufferSize / 4f);
-
-            _yBuffer = new GraphicsBuffer(GraphicsBuffer.Target.Raw, GraphicsBuffer.UsageFlags.LockBufferForWrite, alignedYBufferSize, sizeof(uint));
-            _uBuffer = new GraphicsBuffer(GraphicsBuffer.Target.Raw, GraphicsBuffer.UsageFlags.LockBufferForWrite, alignedUVBufferSize, sizeof(uint));
-            _vBuffer = new GraphicsBuffer(GraphicsBuffer.Target.Raw, GraphicsBuffer.UsageFlags.LockBufferForWrite, alignedUVBufferSize, sizeof(uint));
-
-            _yCopyBuffer = new NativeArray<byte>(_yBufferSize, Allocator.Persistent, NativeArrayOptions.UninitializedMemory);
-            _uCopyBuffer = new NativeArray<byte>(_uvBufferSize, Allocator.Persistent, NativeArrayOptions.UninitializedMemory);
-            _vCopyBuffer = new NativeArray<byte>(_uvBufferSize, Allocator.Persistent, NativeArrayOptions.UninitializedMemory);
+            if (preferNative && TryGetNativeOutputFormat(textureFormat, out VKPlaneOutputFormat outputFormat))
+                _nativeConverterId = VKAPI.createVKPlaneConverter(Texture.GetNativeTexturePtr(), resolution.width, resolution.height, inputFormat, outputFormat);
 
             ConfigureCommandBuffer();
         }
 
+        // The native converter writes the texture through a storage view of one of these formats.
+        private static bool TryGetNativeOutputFormat(GraphicsFormat textureFormat, out VKPlaneOutputFormat outputFormat)
+        {
+            switch (textureFormat)
+            {
+                case GraphicsFormat.R8G8B8A8_UNorm:
+                case GraphicsFormat.R8G8B8A8_SRGB:
+                    outputFormat = VKPlaneOutputFormat.RGBA8;
+                    return true;
+
+                case GraphicsFormat.A2B10G10R10_UNormPack32:
+                    outputFormat = VKPlaneOutputFormat.RGB10A2;
+                    return true;
+
+                case GraphicsFormat.R16G16B16A16_SFloat:
+                    outputFormat = VKPlaneOutputFormat.RGBA16F;
+                    return true;
+
+                default:
+                    outputFormat = default;
+                    return false;
+            }
+        }
+
         private void ConfigureCommandBuffer()
         {
             _commandBuffer.Clear();
 
+            uint nativeConverterId = _nativeConverterId;
+            if (nativeConverterId != 0)
+            {
+                _commandBuffer.IssuePluginEventAndData(VKAPI.getVKPlaneConverterEvent(), (int)RenderJobEvent.Run, (IntPtr)nativeConverterId);
+                return;
+            }
+
+            if (_yBuffer == null)
+                CreateManagedBuffers();
+
             ComputeShader shader = _kernel.Shader;
             int kernelIdx = _kernel.Index;
 
@@ -187,6 +247,44 @@ namespace Uralstech.UXR.QuestCamera
             );
         }
 
+        private void CreateManagedBuffers()
+        {
+            _strideParams = new GraphicsBuffer(GraphicsBuffer.Target.Raw, GraphicsBuffer.UsageFlags.LockBufferForWrite, 1, s_strideParamsStructSize);
+
+            int alignedYBufferSize = Mathf.CeilToInt(_yBufferSize / 4f);
+            int alignedUVBufferSize = Mathf.CeilToInt(_uvBufferSize / 4f);
+
+            _yBuffer = new GraphicsBuffer(GraphicsBuffer.Target.Raw, GraphicsBuffer.UsageFlags.LockBufferForWrite, alignedYBufferSize, sizeof(uint));
+            _uBuffer = new GraphicsBuffer(GraphicsBuffer.Target.Raw, GraphicsBuffer.UsageFlags.LockBufferForWrite, alignedUVBufferSize, sizeof(uint));
+            _vBuffer = new GraphicsBuffer(GraphicsBuffer.Target.Raw, GraphicsBuffer.UsageFlags.LockBufferForWrite, alignedUVBufferSize, sizeof(uint));
+
+            _yCopyBuffer = new NativeArray<byte>(_yBufferSize, Allocator.Persistent, NativeArrayOptions.UninitializedMemory);
+            _uCopyBuffer = new NativeArray<byte>(_uvBufferSize, Allocator.Persistent, NativeArrayOptions.UninitializedMemory);
+            _vCopyBuffer = new NativeArray<byte>(_uvBufferSize, Allocator.Persistent, NativeArrayOptions.UninitializedMemory);
+        }
+
+        private void ReleaseNativeConverter()
+        {
+            uint nativeConverterId = _nativeConverterId;
+            if (nativeConverterId == 0)
+                return;
+
+            // The managed buffers must exist before frames stop going to the native converter.
+            if (_yBuffer == null)
+                CreateManagedBuffers();
+
+            _nativeConverterId = 0;
+            DisposeNativeConverter(nativeConverterId);
+        }
+
+        // Queued before the texture can be released, so the native converter is done with it first.
+        private static void DisposeNativeConverter(uint nativeConverterId)
+        {
+            using CommandBuffer disposeCommandBuffer = new();
+            disposeCommandBuffer.IssuePluginEventAndData(VKAPI.getVKPlaneConverterEvent(), (int)RenderJobEvent.Dispose, (IntPtr)nativeConverterId);
+            Graphics.ExecuteCommandBuffer(disposeCommandBuffer);
+        }
+
         /// <inheritdoc cref="ContinuousCaptureSession.OnFrameReadyCallback"/>
         public void OnFrameReady(
             IntPtr yBuffer, long yBufferSize,
@@ -200,7 +298,19 @@ namespace Uralstech.UXR.QuestCamera
             // THIS IS CALLED FROM A KOTLIN THREAD
             if (_disposed || Interlocked.CompareExchange(ref _isProcessing, 1, 0) == 1)
                 return;
-                
+
+            // The native converter copies the planes straight into its staging memory, so there is nothing to upload later.
+            uint nativeConverterId = _nativeConverterId;
+            if (nativeConverterId != 0)
+            {
+                if (VKAPI.submitVKPlaneFrame(nativeConverterId, yBuffer, yBufferSize, uBuffer, vBuffer, uvBufferSize, yRowStride, uvRowStride, uvPixelStride, timestamp))
+                    DispatchNativeAsync(timestamp).Forget();
+                else
+                    Interlocked.Exchange(ref _isProcessing, 0);
+
+                return;
+            }
+
             MemCpy(yBuffer, yBufferSize,    _yCopyBuffer);
             MemCpy(uBuffer, uvBufferSize,   _uCopyBuffer);
             MemCpy(vBuffer, uvBufferSize,   _vCopyBuffer);
@@ -218,7 +328,7 @@ namespace Uralstech.UXR.QuestCamera
                 await Awaiters.UnityMainThread;
 #endif
 
-                if (_disposed)
+                if (_disposed || _yBuffer == null || _uBuffer == null || _vBuffer == null || _strideParams == null)
                     return;
                 
                 MemCpy(_yCopyBuffer, _yBuffer);
@@ -242,6 +352,33 @@ namespace Uralstech.UXR.QuestCamera
             OnFrameProcessed?.OnMainThread(Texture, timestamp).Forget();
         }
 
+        private async Task DispatchNativeAsync(long timestamp)
+        {
+            try
+            {
+#if UNITY_6000_0_OR_NEWER
+                await Awaitable.MainThreadAsync();
+#else
+                await Awaiters.UnityMainThread;
+#endif
+
+                // The command buffer only runs the native converter while it exists.
+                if (_disposed || _nativeConverterId == 0)
+                    return;
+
+                Graphics.ExecuteCommandBuffer(_commandBuffer);
+
+                CaptureTimestamp = timestamp;
+                _lastUpdateFrame = Time.frameCount;
+            }
+            finally
+            {
+                Interlocked.Exchange(ref _isProcessing, 0);
+            }
+
+            OnFrameProcessed?.OnMainThread(Texture, timestamp).Forget();
+        }
+
         /// <inheritdoc/>
         public void Dispose()
         {
@@ -249,20 +386,30 @@ namespace Uralstech.UXR.QuestCamera
                 return;
 
             _disposed = true;
+
+            uint nativeConverterId = _nativeConverterId;
+            if (nativeConverterId != 0)
+            {
+                _nativeConverterId = 0;
+                DisposeNativeConverter(nativeConverterId);
+            }
             
             Texture.Release();
             UnityEngine.Object.Destroy(Texture);
 
             _commandBuffer.Dispose();
-            _strideParams.Dispose();
+            _strideParams?.Dispose();
 
-            _yBuffer.Dispose();
-            _uBuffer.Dispose();
-            _vBuffer.Dispose();
+            _yBuffer?.Dispose();
+            _uBuffer?.Dispose();
+            _vBuffer?.Dispose();
 
-            _yCopyBuffer.Dispose();
-            _uCopyBuffer.Dispose();
-            _vCopyBuffer.Dispose();
+            if (_yCopyBuffer.IsCreated)
+            {
+                _yCopyBuffer.Dispose();
+                _uCopyBuffer.Dispose();
+                _vCopyBuffer.Dispose();
+            }
 
             GC.SuppressFinalize(this);
         }
@@ -287,4 +434,4 @@ namespace Uralstech.UXR.QuestCamera
             dst.UnlockBufferAfterWrite<byte>(copy);
         }
     }
-}
+}
\ No newline at end of file
@@ -0,0 +1,76 @@
+// Copyright 2026 URAV ADVANCED LEARNING SYSTEMS PRIVATE LIMITED
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Samples the external camera texture of a GLESPassthroughJob. Set _MainTex to
+// GLESPassthroughJob.ExternalTexture and _CameraTransform to GLESPassthroughJob.TransformMatrix.
+// Only supported on OpenGL-ES, as samplerExternalOES has no HLSL equivalent.
+Shader "Uralstech/UXR/QuestCamera/ExternalCameraTexture"
+{
+    Properties
+    {
+        _MainTex ("Camera Texture", 2D) = "black" {}
+        [Toggle] _Linearize ("Convert sRGB to Linear", Float) = 0
+    }
+
+    SubShader
+    {
+        Tags { "RenderType" = "Opaque" }
+        LOD 100
+
+        Pass
+        {
+            GLSLPROGRAM
+            #pragma only_renderers gles3
+            #extension GL_OES_EGL_image_external : require
+            #extension GL_OES_EGL_image_external_essl3 : enable
+
+            precision mediump float;
+
+            #ifdef VERTEX
+            uniform mat4 _CameraTransform;
+            varying vec2 vTexCoord;
+
+            void main()
+            {
+                gl_Position = gl_ModelViewProjectionMatrix * gl_Vertex;
+
+                // The SurfaceTexture matrix maps the quad's UVs to the camera buffer, including flips and crop.
+                vTexCoord = (_CameraTransform * vec4(gl_MultiTexCoord0.xy, 0.0, 1.0)).xy;
+            }
+            #endif
+
+            #ifdef FRAGMENT
+            uniform samplerExternalOES _MainTex;
+            uniform float _Linearize;
+            varying vec2 vTexCoord;
+
+            vec3 srgbToLinear(vec3 color)
+            {
+                vec3 low = color / 12.92;
+                vec3 high = pow((color + 0.055) / 1.055, vec3(2.4));
+                return mix(high, low, vec3(lessThanEqual(color, vec3(0.04045))));
+            }
+
+            void main()
+            {
+                vec4 color = texture2D(_MainTex, vTexCoord);
+                color.rgb = mix(color.rgb, srgbToLinear(color.rgb), _Linearize);
+                gl_FragColor = color;
+            }
+            #endif
+
+            ENDGLSL
+        }
+    }
+}
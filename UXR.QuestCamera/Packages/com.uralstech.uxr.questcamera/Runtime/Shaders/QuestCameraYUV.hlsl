@@ -0,0 +1,69 @@
+// Copyright 2026 URAV ADVANCED LEARNING SYSTEMS PRIVATE LIMITED
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Converts the planar YUV textures of a GLESPlanarJob to RGB when sampling them. Set the luma texture to
+// GLESPlanarJob.LumaTexture and the chroma texture to GLESPlanarJob.ChromaTexture, then call QuestCameraSampleRGB.
+// The result is gamma encoded, like the output of GLESConverterJob, so convert it if the material expects linear color.
+
+#ifndef UXR_QUESTCAMERA_YUV_INCLUDED
+#define UXR_QUESTCAMERA_YUV_INCLUDED
+
+// Converts Full Range BT.601 YUV data to RGB, 0-1 range
+// as per https://www.ecma-international.org/wp-content/uploads/ECMA_TR-98_1st_edition_june_2009.pdf
+float3 QuestCameraYUVToRGB(float3 yuv)
+{
+    const float y = yuv.x;
+    const float cb = yuv.y - 128.0 / 255.0;
+    const float cr = yuv.z - 128.0 / 255.0;
+
+    return saturate(float3(
+        y + 1.402 * cr,
+        y - 0.34414 * cb - 0.71414 * cr,
+        y + 1.772 * cb
+    ));
+}
+
+// Converts Narrow Range BT.2020 YUV data from P010 sessions to RGB, as per https://www.itu.int/rec/R-REC-BT.2020
+// The planes store the high 8 bits of each 10-bit sample. The HLG transfer function of the stream is kept.
+float3 QuestCameraP010ToRGB(float3 yuv)
+{
+    const float3 code = yuv * (65535.0 / 64.0);
+    const float y = (code.x - 64.0) / 876.0;
+    const float cb = (code.y - 512.0) / 896.0;
+    const float cr = (code.z - 512.0) / 896.0;
+
+    return saturate(float3(
+        y + 1.4746 * cr,
+        y - 0.16455 * cb - 0.57135 * cr,
+        y + 1.8814 * cb
+    ));
+}
+
+// Samples the luma and chroma planes at the same UV. The chroma plane is half the size of the luma plane,
+// so bilinear filtering upsamples it.
+float3 QuestCameraSampleYUV(Texture2D lumaTexture, Texture2D chromaTexture, SamplerState samplerState, float2 uv)
+{
+    const float y = lumaTexture.Sample(samplerState, uv).r;
+    const float2 uv2 = chromaTexture.Sample(samplerState, uv).rg;
+    return float3(y, uv2);
+}
+
+// Samples the planes of a GLESPlanarJob and converts them to RGB. Use QuestCameraP010ToRGB instead for P010 sessions.
+float3 QuestCameraSampleRGB(Texture2D lumaTexture, Texture2D chromaTexture, SamplerState samplerState, float2 uv)
+{
+    return QuestCameraYUVToRGB(QuestCameraSampleYUV(lumaTexture, chromaTexture, samplerState, uv));
+}
+
+#endif // UXR_QUESTCAMERA_YUV_INCLUDED